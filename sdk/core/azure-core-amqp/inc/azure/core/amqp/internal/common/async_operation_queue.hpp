@@ -7,11 +7,14 @@
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
-#include <list>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <thread>
 #include <tuple>
+#include <vector>
 
 namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace _internal {
 
@@ -20,6 +23,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
    * It expresses a relatively simple API contract. The code which produces results calls
    * "CompleteOperation" which sets the result, and a consumer calls WaitForResult which reads from
    * the AsyncOperationQueue. WaitForResult will block until a result is available.
+   *
+   * The results are stored inline in the queue, and a waiting consumer sleeps on a condition
+   * variable until a result is queued. Because a Context cannot notify a waiter when it is
+   * cancelled, a waiting consumer also wakes up periodically to check for cancellation.
    */
   template <typename... T> class AsyncOperationQueue final {
   public:
@@ -35,38 +42,51 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     void CompleteOperation(T... operationParameters)
     {
       std::unique_lock<std::mutex> lock(m_operationComplete);
-      m_operationQueue.push_back(std::make_unique<std::tuple<T...>>(
-          std::make_tuple<T...>(std::forward<T>(operationParameters)...)));
+      m_operationQueue.emplace_back(std::forward<T>(operationParameters)...);
       lock.unlock();
       m_operationCondition.notify_one();
     }
 
+    /**
+     * @brief Wait for a result to be available, calling the pollers until it is.
+     *
+     * @param context The context to use for cancellation.
+     * @param pollers The objects whose Poll method produces the result.
+     * @return std::unique_ptr<std::tuple<T...>> The result, or nullptr if the context was
+     * cancelled.
+     *
+     * @remarks Between two polls which produced no result, the caller sleeps for an interval which
+     * starts at 1 millisecond and doubles up to 16 milliseconds, unless a result is queued by
+     * another thread meanwhile.
+     */
     template <class... Poller>
     std::unique_ptr<std::tuple<T...>> WaitForPolledResult(
         Context const& context,
         Poller&... pollers)
     {
+      auto pollInterval = MinPollInterval;
       do
       {
         {
           std::unique_lock<std::mutex> lock(m_operationComplete);
           if (!m_operationQueue.empty())
           {
-            std::unique_ptr<std::tuple<T...>> rv;
-            rv = std::move(m_operationQueue.front());
-            m_operationQueue.pop_front();
-            return rv;
+            return PopResult();
           }
           if (context.IsCancelled())
           {
             return nullptr;
           }
         }
-        std::this_thread::yield();
 
         // Note: We need to call Poll() *outside* the lock because the poller is going to call the
         // CompleteOperation function.
         Poll(pollers...);
+
+        std::unique_lock<std::mutex> lock(m_operationComplete);
+        m_operationCondition.wait_for(
+            lock, pollInterval, [this]() { return !m_operationQueue.empty(); });
+        pollInterval = (std::min)(pollInterval * 2, MaxPollInterval);
       } while (true);
     }
 
@@ -90,27 +110,18 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
         {
           std::unique_lock<std::mutex> lock(m_operationComplete);
 
-          if (!m_operationQueue.empty())
-          {
-            std::unique_ptr<std::tuple<T...>> rv;
-            rv = std::move(m_operationQueue.front());
-            m_operationQueue.pop_front();
-            return rv;
-          }
-
-          // There's nothing in the queue, wait until something is put into the queue.
-          // This will block until either something is put into the queue or the context is
-          // cancelled.
+          // Wait until something is put into the queue. This wakes up periodically to check
+          // whether the context is cancelled.
           m_operationCondition.wait_for(
-              lock, std::chrono::milliseconds(100), [this, &context]() -> bool {
+              lock, CancellationCheckInterval, [this, &context]() -> bool {
                 // If the context is cancelled, we should return immediately.
-                if (context.IsCancelled())
-                {
-                  return true;
-                }
-                return !m_operationQueue.empty();
+                return !m_operationQueue.empty() || context.IsCancelled();
               });
 
+          if (!m_operationQueue.empty())
+          {
+            return PopResult();
+          }
           if (context.IsCancelled())
           {
             return nullptr;
@@ -135,14 +146,43 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
 
       if (!m_operationQueue.empty())
       {
-        std::unique_ptr<std::tuple<T...>> rv;
-        rv = std::move(m_operationQueue.front());
-        m_operationQueue.pop_front();
-        return rv;
+        return PopResult();
       }
       return nullptr;
     }
 
+    /**
+     * @brief Moves the available results to the end of \p results, without waiting.
+     *
+     * @param results The vector receiving the results.
+     * @param maxResults The maximum number of results to move.
+     * @return The number of results moved.
+     *
+     * @remarks The results are taken under a single lock acquisition, which makes this cheaper than
+     * repeated calls to TryWaitForResult when results arrive faster than they are consumed.
+     */
+    size_t TryWaitForResults(std::vector<std::tuple<T...>>& results, size_t maxResults)
+    {
+      std::unique_lock<std::mutex> lock(m_operationComplete);
+      const size_t count = (std::min)(maxResults, m_operationQueue.size());
+      results.reserve(results.size() + count);
+      for (size_t i = 0; i < count; ++i)
+      {
+        results.push_back(std::move(m_operationQueue.front()));
+        m_operationQueue.pop_front();
+      }
+      return count;
+    }
+
+    /**
+     * @brief Gets the number of results which are queued and not consumed yet.
+     */
+    size_t Size()
+    {
+      std::unique_lock<std::mutex> lock(m_operationComplete);
+      return m_operationQueue.size();
+    }
+
     // Clear any pending elements from the queue. This may be needed because some queued elements
     // may have ordering dependencies that need to be cleared before the object containing the queue
     // can be released.
@@ -153,9 +193,21 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     }
 
   private:
+    static constexpr std::chrono::milliseconds CancellationCheckInterval{100};
+    static constexpr std::chrono::milliseconds MinPollInterval{1};
+    static constexpr std::chrono::milliseconds MaxPollInterval{16};
+
     std::mutex m_operationComplete;
     std::condition_variable m_operationCondition;
-    std::list<std::unique_ptr<std::tuple<T...>>> m_operationQueue;
+    std::deque<std::tuple<T...>> m_operationQueue;
+
+    // Must be called with m_operationComplete held, and the queue not empty.
+    std::unique_ptr<std::tuple<T...>> PopResult()
+    {
+      auto rv = std::make_unique<std::tuple<T...>>(std::move(m_operationQueue.front()));
+      m_operationQueue.pop_front();
+      return rv;
+    }
 
     void Poll() {}
 
@@ -165,4 +217,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
       Poll(rest...);
     }
   };
+
+  template <typename... T>
+  constexpr std::chrono::milliseconds AsyncOperationQueue<T...>::CancellationCheckInterval;
+  template <typename... T>
+  constexpr std::chrono::milliseconds AsyncOperationQueue<T...>::MinPollInterval;
+  template <typename... T>
+  constexpr std::chrono::milliseconds AsyncOperationQueue<T...>::MaxPollInterval;
 }}}}} // namespace Azure::Core::Amqp::Common::_internal
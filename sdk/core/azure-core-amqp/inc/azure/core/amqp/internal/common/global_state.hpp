@@ -6,6 +6,8 @@
 #include <azure/core/azure_assert.hpp>
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -49,8 +51,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
 #if ENABLE_UAMQP
     std::list<std::shared_ptr<Pollable>> m_pollables;
     std::mutex m_pollablesMutex;
+    // Wakes the polling thread when a pollable is added, a poll is requested, or the global state
+    // is destroyed.
+    std::condition_variable m_pollingWakeup;
+    // Signaled every time the polling thread completes a pass over the pollables.
+    std::condition_variable m_pollingCompleted;
     std::thread m_pollingThread;
-    std::atomic<bool> m_activelyPolling;
+    bool m_activelyPolling{false};
+    bool m_pollRequested{false};
+    // Number of passes over the pollables completed by the polling thread.
+    std::uint64_t m_pollCount{0};
     bool m_stopped{false};
 #elif ENABLE_RUST_AMQP
     RustRuntimeContext m_runtimeContext;
@@ -69,6 +79,12 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     void AddPollable(std::shared_ptr<Pollable> pollable);
 
     void RemovePollable(std::shared_ptr<Pollable> pollable);
+
+    /**
+     * @brief Wakes the polling thread so that work just queued on a pollable, such as an outgoing
+     * transfer, is processed immediately instead of at the next scheduled poll.
+     */
+    void RequestPoll();
 #elif ENABLE_RUST_AMQP
     Azure::Core::Amqp::_detail::RustRuntimeContext* GetRuntimeContext()
     {
@@ -81,6 +81,20 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
      * client. */
     uint32_t MaxLinkCredit{};
 
+    /** @brief The maximum number of bytes of messages buffered by the message receiver, including
+     * the messages which the service can send with the link credit granted.
+     *
+     * When non-zero, the link credit is sized by the receiver, within MaxLinkCredit, from this
+     * budget, from the average size of the received messages and from the rate at which the
+     * messages are taken by the caller, and it is issued in batches. When zero, the link credit is
+     * replenished to MaxLinkCredit whenever it runs out, regardless of the messages waiting to be
+     * processed.
+     *
+     * @remarks The link credit is only sized by the receiver when messages are received with
+     * WaitForIncomingMessage and its variants, not with a MessageReceiverEvents callback.
+     */
+    uint64_t MaxBufferedBytes{};
+
     /** @brief Attach properties for the link associated with the message receiver. */
     Models::AmqpMap Properties;
 
@@ -91,6 +105,35 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     bool AuthenticationRequired{true};
   };
 
+  /** @brief Queue depth and link credit statistics of a MessageReceiver. */
+  struct MessageReceiverStatistics final
+  {
+    /** @brief The number of received messages waiting to be processed. */
+    uint64_t QueuedMessages{};
+
+    /** @brief The size of the received messages waiting to be processed, in bytes. */
+    uint64_t QueuedBytes{};
+
+    /** @brief The number of messages the service can still send with the link credit granted. */
+    uint32_t LinkCredit{};
+
+    /** @brief The number of messages which can be buffered or in flight, for which credit is
+     * granted. */
+    uint32_t CreditWindow{};
+
+    /** @brief The number of messages taken by the caller per second. */
+    double DrainRate{};
+
+    /** @brief The average size of the received messages, in bytes. */
+    uint64_t AverageMessageSize{};
+
+    /** @brief The number of messages received. */
+    uint64_t MessagesReceived{};
+
+    /** @brief The number of times link credit was granted. */
+    uint64_t CreditIssueCount{};
+  };
+
 #if ENABLE_UAMQP
   class MessageReceiverEvents {
   protected:
@@ -161,6 +204,12 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
      * @return The name of the underlying link object.
      */
     std::string GetLinkName() const;
+
+    /** @brief Gets the queue depth and link credit statistics of the message receiver.
+     *
+     * @return The statistics of the message receiver.
+     */
+    MessageReceiverStatistics GetStatistics() const;
 #endif
     /** @brief Gets the Address of the message receiver's source node.
      *
@@ -185,6 +234,24 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
 
+    /** @brief Moves the messages waiting to be processed to the end of a vector, without waiting.
+     *
+     * This takes the messages under a single lock acquisition, which is cheaper than repeated calls
+     * to TryWaitForIncomingMessage when messages arrive faster than they are processed.
+     *
+     * @param messages The vector receiving pairs of a received message and the error if any, as
+     * returned by TryWaitForIncomingMessage.
+     * @param maxMessages The maximum number of messages to move.
+     *
+     * @return The number of pairs added to \p messages. If zero, no messages are available and the
+     * caller should call WaitForIncomingMessage.
+     */
+    size_t TryWaitForIncomingMessages(
+        std::vector<
+            std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+            messages,
+        size_t maxMessages);
+
   private:
     MessageReceiver(std::shared_ptr<_detail::MessageReceiverImpl> impl) : m_impl{impl} {}
     friend class _detail::MessageReceiverFactory;
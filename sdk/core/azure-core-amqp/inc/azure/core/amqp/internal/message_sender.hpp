@@ -122,6 +122,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
      */
     Nullable<uint32_t> InitialDeliveryCount;
 
+    /** @brief The maximum number of messages sent with SendAsync which may be unsettled at once.
+     *
+     * When this many messages are pending, SendAsync blocks until one of them is settled. The
+     * messages beyond the link credit granted by the peer are held by the sender until more credit
+     * is granted. If zero, the number of pending messages is not limited.
+     *
+     */
+    std::uint32_t MaxPendingSends{};
+
     /** @brief If true, the message sender will log trace events. */
     bool EnableTrace{false};
 
@@ -134,6 +143,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
 #if ENABLE_UAMQP
     using MessageSendCompleteCallback
         = std::function<void(MessageSendStatus sendResult, Models::AmqpValue const& deliveryState)>;
+
+    /** @brief Callback invoked when a message sent with SendAsync is settled.
+     *
+     * @param sendResult The status of the send operation.
+     * @param error The error returned by the peer, if the send failed.
+     */
+    using MessageSendResultCallback = std::function<
+        void(MessageSendStatus sendResult, Models::_internal::AmqpError const& error)>;
 #endif
     ~MessageSender() noexcept;
 
@@ -181,6 +198,27 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     _azure_NODISCARD std::tuple<MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context = {});
+
+    /** @brief Send a message to the target of the message sender without waiting for it to be
+     * settled.
+     *
+     * Successive calls keep several messages in flight, so that the throughput of the sender is not
+     * limited by the round trip to the peer. If MessageSenderOptions::MaxPendingSends messages are
+     * already pending, this blocks until one of them is settled.
+     *
+     * @param message The message to send.
+     * @param onSendComplete Invoked once the message is settled, or failed to be sent. It is
+     * invoked from the AMQP polling thread, and must not block. In particular, it must not call
+     * Send, nor SendAsync, which blocks while MaxPendingSends messages are pending.
+     * @param context The context to use while waiting for a pending message to be settled.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled before the
+     * message is queued. The callback is not invoked in that case.
+     */
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        MessageSendResultCallback onSendComplete,
+        Context const& context = {});
 #elif ENABLE_RUST_AMQP
     _azure_NODISCARD Models::_internal::AmqpError Send(
         Models::AmqpMessage const& message,
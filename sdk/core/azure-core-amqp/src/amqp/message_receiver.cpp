@@ -12,6 +12,7 @@
 #include "azure/core/amqp/internal/models/messaging_values.hpp"
 #include "azure/core/amqp/models/amqp_message.hpp"
 #include "message_receiver_impl.hpp"
+#include "private/link_credit_controller.hpp"
 
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
@@ -96,8 +97,41 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     }
   }
 
+  size_t MessageReceiver::TryWaitForIncomingMessages(
+      std::vector<
+          std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+          messages,
+      size_t maxMessages)
+  {
+    if (m_impl)
+    {
+      return m_impl->TryWaitForIncomingMessages(messages, maxMessages);
+    }
+    else
+    {
+      AZURE_ASSERT_FALSE(
+          "MessageReceiver::TryWaitForIncomingMessages called on moved message receiver.");
+      Azure::Core::_internal::AzureNoReturnPath(
+          "MessageReceiver::TryWaitForIncomingMessages called on moved message receiver.");
+    }
+  }
+
 #if ENABLE_UAMQP
   std::string MessageReceiver::GetLinkName() const { return m_impl->GetLinkName(); }
+
+  MessageReceiverStatistics MessageReceiver::GetStatistics() const
+  {
+    if (m_impl)
+    {
+      return m_impl->GetStatistics();
+    }
+    else
+    {
+      AZURE_ASSERT_FALSE("MessageReceiver::GetStatistics called on moved message receiver.");
+      Azure::Core::_internal::AzureNoReturnPath(
+          "MessageReceiver::GetStatistics called on moved message receiver.");
+    }
+  }
 #endif
   std::ostream& operator<<(std::ostream& stream, _internal::MessageReceiverState state)
   {
@@ -142,3 +176,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
 #endif
 
 }}}} // namespace Azure::Core::Amqp::_internal
+
+namespace Azure { namespace Core { namespace Amqp { namespace _detail {
+  constexpr uint32_t LinkCreditController::MinimumLinkCredit;
+  constexpr uint32_t LinkCreditController::DefaultMaxLinkCredit;
+  constexpr std::chrono::milliseconds LinkCreditController::DrainDuration;
+  constexpr std::chrono::milliseconds LinkCreditController::DrainSampleInterval;
+}}}} // namespace Azure::Core::Amqp::_detail
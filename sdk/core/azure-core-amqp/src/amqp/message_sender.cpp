@@ -64,6 +64,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
   {
     return m_impl->Send(message, context);
   }
+
+  void MessageSender::SendAsync(
+      Models::AmqpMessage const& message,
+      MessageSendResultCallback onSendComplete,
+      Context const& context)
+  {
+    m_impl->SendAsync(message, onSendComplete, context);
+  }
 #elif ENABLE_RUST_AMQP
   Models::_internal::AmqpError MessageSender::Send(
       Models::AmqpMessage const& message,
@@ -0,0 +1,244 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/core/amqp/internal/message_receiver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Azure { namespace Core { namespace Amqp { namespace _detail {
+
+  /** @brief Sizes the link credit of a message receiver.
+   *
+   * The credit is kept within a window, the number of messages which can be buffered by the
+   * receiver or still be sent by the service. The window is bounded by the maximum link credit, by
+   * the number of messages of the average size which fit in the byte budget, and by the number of
+   * messages the consumer processes in #DrainDuration.
+   *
+   * The credit is tracked as the service sees it. Like uAMQP, the credit is replenished when it
+   * runs out, to the replenish credit, which is the room left in the window. Credit is also issued
+   * ahead of time, in batches of at least half the window, so that a fast consumer does not wait
+   * for the credit to run out.
+   *
+   * @remarks This class is thread safe. The calls which change the credit of the link must be
+   * serialized with the link, by holding the connection lock.
+   */
+  class LinkCreditController final {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief The credit issued before the size of the messages is known, and the smallest window
+     * sized by the drain rate. */
+    static constexpr uint32_t MinimumLinkCredit = 10;
+
+    /** @brief The maximum link credit used when none is specified, which is the uAMQP default. */
+    static constexpr uint32_t DefaultMaxLinkCredit = 10000;
+
+    /** @brief The duration of processing the window sized by the drain rate holds. */
+    static constexpr std::chrono::milliseconds DrainDuration{1000};
+
+    /** @brief The shortest interval over which the drain rate is sampled. */
+    static constexpr std::chrono::milliseconds DrainSampleInterval{100};
+
+    /** @brief Constructs a link credit controller.
+     *
+     * @param maxBufferedBytes The byte budget. If zero, the credit is not managed and
+     * GetReplenishCredit always returns the maximum link credit.
+     * @param maxLinkCredit The maximum link credit. If zero, DefaultMaxLinkCredit is used.
+     * @param now The current time.
+     */
+    LinkCreditController(
+        uint64_t maxBufferedBytes,
+        uint32_t maxLinkCredit,
+        Clock::time_point now = Clock::now())
+        : m_maxBufferedBytes{maxBufferedBytes},
+          m_maxLinkCredit{maxLinkCredit != 0 ? maxLinkCredit : DefaultMaxLinkCredit},
+          m_drainSampleStart{now}
+    {
+      m_replenishCredit = IsEnabled() ? (std::min)(m_maxLinkCredit, uint32_t{MinimumLinkCredit})
+                                      : m_maxLinkCredit;
+      m_window = m_replenishCredit;
+      // The replenish credit is granted when the link is attached.
+      m_linkCredit = m_replenishCredit;
+      m_creditIssueCount = 1;
+    }
+
+    /** @brief Returns true if the link credit is managed by this controller. */
+    bool IsEnabled() const { return m_maxBufferedBytes != 0; }
+
+    /** @brief Gets the credit granted when the link credit runs out, which is the maximum link
+     * credit of the link. */
+    uint32_t GetReplenishCredit() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_replenishCredit;
+    }
+
+    /** @brief Records a message queued for the consumer.
+     *
+     * @param messageSize The size of the message, in bytes.
+     *
+     * @return The new replenish credit, to set as the maximum link credit of the link.
+     */
+    uint32_t OnMessageReceived(uint64_t messageSize)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // uAMQP replenishes the credit when the transfer is received with the last credit, and when
+      // the link is polled without credit left.
+      if (m_linkCredit <= 1)
+      {
+        m_linkCredit = m_replenishCredit;
+        ++m_creditIssueCount;
+        // When the last credit is replaced by none, the credit count of uAMQP wraps around once the
+        // transfer is received, and uAMQP no longer replenishes the credit until it is reset.
+        m_replenishSuspended = m_replenishCredit == 0;
+      }
+      if (m_linkCredit != 0)
+      {
+        --m_linkCredit;
+      }
+      ++m_messagesReceived;
+      ++m_queuedMessages;
+      m_queuedBytes += messageSize;
+      // An exponential moving average, weighing the last message by 1/8.
+      m_averageMessageSize = m_averageMessageSize == 0
+          ? messageSize
+          : m_averageMessageSize - m_averageMessageSize / 8 + messageSize / 8;
+
+      if (IsEnabled())
+      {
+        UpdateWindow();
+        m_replenishCredit = GetTargetCredit();
+      }
+      if (m_linkCredit == 0 && m_replenishCredit != 0 && !m_replenishSuspended)
+      {
+        m_linkCredit = m_replenishCredit;
+        ++m_creditIssueCount;
+      }
+      return m_replenishCredit;
+    }
+
+    /** @brief Records messages taken from the queue by the consumer.
+     *
+     * @param messageCount The number of messages taken.
+     * @param messageBytes The sum of the sizes of the messages taken, in bytes.
+     * @param now The current time.
+     *
+     * @return true if credit should be issued with IssueCredit.
+     */
+    bool OnMessagesConsumed(
+        uint64_t messageCount,
+        uint64_t messageBytes,
+        Clock::time_point now = Clock::now())
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_queuedMessages -= (std::min)(messageCount, m_queuedMessages);
+      m_queuedBytes -= (std::min)(messageBytes, m_queuedBytes);
+
+      m_drainSampleCount += messageCount;
+      const auto elapsed = now - m_drainSampleStart;
+      if (elapsed >= DrainSampleInterval)
+      {
+        const double sample = static_cast<double>(m_drainSampleCount)
+            / std::chrono::duration<double>(elapsed).count();
+        // An exponential moving average, weighing the last sample by 1/4.
+        m_drainRate = m_drainRate == 0 ? sample : m_drainRate * 0.75 + sample * 0.25;
+        m_drainSampleCount = 0;
+        m_drainSampleStart = now;
+      }
+
+      if (!IsEnabled())
+      {
+        return false;
+      }
+      UpdateWindow();
+      return NeedsCredit();
+    }
+
+    /** @brief Issues credit if the credit is low enough, given the window and the messages which
+     * are queued.
+     *
+     * @return The credit to grant to the link, replacing its current credit, which is also the new
+     * replenish credit. Zero if no credit is issued.
+     */
+    uint32_t IssueCredit()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!IsEnabled() || !NeedsCredit())
+      {
+        return 0;
+      }
+      m_replenishCredit = GetTargetCredit();
+      m_linkCredit = m_replenishCredit;
+      m_replenishSuspended = false;
+      ++m_creditIssueCount;
+      return m_linkCredit;
+    }
+
+    /** @brief Gets the queue depth and credit statistics. */
+    _internal::MessageReceiverStatistics GetStatistics() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      _internal::MessageReceiverStatistics statistics;
+      statistics.QueuedMessages = m_queuedMessages;
+      statistics.QueuedBytes = m_queuedBytes;
+      statistics.LinkCredit = m_linkCredit;
+      statistics.CreditWindow = m_window;
+      statistics.DrainRate = m_drainRate;
+      statistics.AverageMessageSize = m_averageMessageSize;
+      statistics.MessagesReceived = m_messagesReceived;
+      statistics.CreditIssueCount = m_creditIssueCount;
+      return statistics;
+    }
+
+  private:
+    void UpdateWindow()
+    {
+      uint64_t window = m_maxLinkCredit;
+      if (m_averageMessageSize != 0)
+      {
+        window = (std::min)(
+            window, (std::max)(m_maxBufferedBytes / m_averageMessageSize, uint64_t{1}));
+      }
+      if (m_drainRate != 0)
+      {
+        const auto drainWindow = static_cast<uint64_t>(
+            m_drainRate * std::chrono::duration<double>(DrainDuration).count());
+        window = (std::min)(window, (std::max)(drainWindow, uint64_t{MinimumLinkCredit}));
+      }
+      m_window = static_cast<uint32_t>(window);
+    }
+
+    // The credit which fills the window, given the messages which are queued.
+    uint32_t GetTargetCredit() const
+    {
+      return m_queuedMessages < m_window ? static_cast<uint32_t>(m_window - m_queuedMessages) : 0;
+    }
+
+    bool NeedsCredit() const
+    {
+      const uint32_t target = GetTargetCredit();
+      return target > m_linkCredit && target - m_linkCredit >= (std::max)(m_window / 2, 1u);
+    }
+
+    mutable std::mutex m_mutex;
+    const uint64_t m_maxBufferedBytes;
+    const uint32_t m_maxLinkCredit;
+    uint32_t m_window;
+    uint32_t m_replenishCredit;
+    uint32_t m_linkCredit;
+    bool m_replenishSuspended{false};
+    uint64_t m_queuedMessages{};
+    uint64_t m_queuedBytes{};
+    uint64_t m_averageMessageSize{};
+    uint64_t m_messagesReceived{};
+    uint64_t m_creditIssueCount{};
+    double m_drainRate{};
+    uint64_t m_drainSampleCount{};
+    Clock::time_point m_drainSampleStart;
+  };
+}}}} // namespace Azure::Core::Amqp::_detail
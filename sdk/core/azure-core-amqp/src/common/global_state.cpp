@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iomanip>
 #include <list>
 #include <mutex>
@@ -31,6 +32,13 @@ using namespace Azure::Core::Diagnostics;
 namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace _detail {
 
 #if ENABLE_UAMQP
+  namespace {
+    // Interval between the polls right after work was requested.
+    constexpr std::chrono::milliseconds MinPollInterval{1};
+    // Interval between the polls once the pollables are idle.
+    constexpr std::chrono::milliseconds MaxPollInterval{100};
+  } // namespace
+
   // Logging callback for uAMQP and azure-c-shared-utility.
   void AmqpLogFunction(
       LOG_CATEGORY logCategory,
@@ -107,30 +115,47 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     xlogging_set_log_function(AmqpLogFunction);
 
     m_pollingThread = std::thread([this]() {
-      do
+      std::unique_lock<std::mutex> lock{m_pollablesMutex};
+      auto pollInterval = MinPollInterval;
+      while (true)
       {
+        // If there are no pollables, there's no point in doing any work, so sleep until one is
+        // added.
+        m_pollingWakeup.wait(lock, [this]() { return m_stopped || !m_pollables.empty(); });
+        if (m_stopped)
         {
-          std::list<std::shared_ptr<Pollable>> capturedList;
-          {
-            std::unique_lock<std::mutex> lock{m_pollablesMutex};
-            // If there are no pollables, there's no point in doing any work.
-            if (m_pollables.empty())
-            {
-              continue;
-            }
-            capturedList = m_pollables;
-            m_activelyPolling = true;
-          }
+          break;
+        }
+
+        {
+          std::list<std::shared_ptr<Pollable>> capturedList{m_pollables};
+          m_activelyPolling = true;
+          m_pollRequested = false;
+          lock.unlock();
 
           for (auto const& pollable : capturedList)
           {
             pollable->Poll();
           }
         }
+        lock.lock();
         m_activelyPolling = false;
-        //        std::this_thread::yield();
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-      } while (!m_stopped);
+        ++m_pollCount;
+        m_pollingCompleted.notify_all();
+
+        // uAMQP does not expose the sockets of its transports, so incoming frames are found by
+        // polling. Poll often right after some work was requested, when responses are expected, and
+        // back off while the pollables are idle.
+        if (m_pollingWakeup.wait_for(
+                lock, pollInterval, [this]() { return m_stopped || m_pollRequested; }))
+        {
+          pollInterval = MinPollInterval;
+        }
+        else
+        {
+          pollInterval = (std::min)(pollInterval * 2, MaxPollInterval);
+        }
+      }
     });
 #endif
   }
@@ -138,7 +163,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
   GlobalStateHolder::~GlobalStateHolder()
   {
 #if ENABLE_UAMQP
-    m_stopped = true;
+    {
+      std::lock_guard<std::mutex> lock(m_pollablesMutex);
+      m_stopped = true;
+    }
+    m_pollingWakeup.notify_one();
     if (m_pollingThread.joinable())
     {
       m_pollingThread.join();
@@ -166,40 +195,51 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
    */
   void GlobalStateHolder::AddPollable(std::shared_ptr<Pollable> pollable)
   {
-    std::lock_guard<std::mutex> lock(m_pollablesMutex);
-    if (std::find(m_pollables.begin(), m_pollables.end(), pollable) == m_pollables.end())
     {
-      m_pollables.push_back(pollable);
+      std::lock_guard<std::mutex> lock(m_pollablesMutex);
+      if (std::find(m_pollables.begin(), m_pollables.end(), pollable) == m_pollables.end())
+      {
+        m_pollables.push_back(pollable);
+      }
+      m_pollRequested = true;
     }
+    m_pollingWakeup.notify_one();
   }
 
   void GlobalStateHolder::RemovePollable(std::shared_ptr<Pollable> pollable)
   {
-    // There is a bit of a complicated lock-free dance happening here.
     // The m_pollables list is accessed by the polling thread, and the list is modified by the user
     // thread. To ensure integrity of the list, the polling thread takes the lock, copies the
-    // pollable from the list, releases the lock and then iterates over the pollables at the
+    // pollables from the list, releases the lock and then iterates over the pollables at the
     // snapshot.
     //
     // Because the pollable is a shared_ptr, the user thread can remove a pollable while the
     // background thread is polling.
     //
     // But we want to make sure that the thread has finished polling (and thus has removed the copy
-    // of the pollables list). For that, we have the m_activelyPolling variable. It is set under the
-    // pollables lock, and cleared after the polling thread has finished polling (outside the lock).
-    //
-    // This means that we can spin on the m_activelyPolling variable *under* the pollables lock safe
-    // in the knowledge that IF the variable is set to true, it means that we acquired the
-    // pollablesMutex during the interval when the captured list is being interated over. And that
-    // the m_activelyPolling variable will only be cleared AFTER the captured list is freed.
+    // of the pollables list). For that, the m_activelyPolling variable is set under the pollables
+    // lock when the list is captured, and m_pollCount is incremented under the lock after the
+    // captured list is freed. If a pass is in progress, we wait for it to complete. Waiting on the
+    // condition variable releases the pollables lock, so a pollable may request a poll meanwhile.
     //
-
-    std::lock_guard<std::mutex> lock(m_pollablesMutex);
+    // A pollable may also be removed from within a Poll call, on the polling thread. That pass
+    // cannot complete until we return, so we don't wait for it.
+    std::unique_lock<std::mutex> lock(m_pollablesMutex);
     m_pollables.remove(pollable);
-    // Spin until m_activelyPolling is false, this ensures that the polling thread is not using the
-    // capturedList copy of m_pollables.
-    while (m_activelyPolling.load())
-      ;
+    if (m_activelyPolling && std::this_thread::get_id() != m_pollingThread.get_id())
+    {
+      const auto pollCount = m_pollCount;
+      m_pollingCompleted.wait(lock, [this, pollCount]() { return m_pollCount != pollCount; });
+    }
+  }
+
+  void GlobalStateHolder::RequestPoll()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_pollablesMutex);
+      m_pollRequested = true;
+    }
+    m_pollingWakeup.notify_one();
   }
 #endif
 
@@ -111,6 +111,27 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   }
 
+  size_t MessageReceiverImpl::TryWaitForIncomingMessages(
+      std::vector<
+          std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+          messages,
+      size_t maxMessages)
+  {
+    // The Rust AMQP library returns one message per poll.
+    size_t count = 0;
+    while (count < maxMessages)
+    {
+      auto result = TryWaitForIncomingMessage();
+      if (!result.first && !result.second)
+      {
+        break;
+      }
+      messages.emplace_back(std::move(result.first), std::move(result.second));
+      ++count;
+    }
+    return count;
+  }
+
   MessageReceiverImpl::~MessageReceiverImpl() noexcept
   {
     auto lock{m_session->GetConnection()->Lock()};
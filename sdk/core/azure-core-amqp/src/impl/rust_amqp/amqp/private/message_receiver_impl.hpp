@@ -55,6 +55,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
     std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
+    size_t TryWaitForIncomingMessages(
+        std::vector<
+            std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+            messages,
+        size_t maxMessages);
 
   private:
     bool m_receiverOpen{false};
@@ -74,7 +74,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       Models::_internal::MessageSource const& source,
       Models::_internal::MessageTarget const& target,
       LinkImplEvents* events)
-      : m_session{session}, m_source(source), m_target(target), m_eventHandler{events}
+      : m_role{role}, m_session{session}, m_source(source), m_target(target),
+        m_eventHandler{events}
   {
     Models::AmqpValue sourceValue{source.AsAmqpValue()};
     Models::AmqpValue targetValue(target.AsAmqpValue());
@@ -96,7 +97,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       Models::_internal::MessageSource const& source,
       Models::_internal::MessageTarget const& target,
       LinkImplEvents* events)
-      : m_session{session}, m_source(source), m_target(target), m_eventHandler{events}
+      : m_role{role}, m_session{session}, m_source(source), m_target(target),
+        m_eventHandler{events}
   {
     Models::AmqpValue sourceValue(source.AsAmqpValue());
     Models::AmqpValue targetValue(target.AsAmqpValue());
@@ -287,6 +289,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     {
       throw std::runtime_error("Could not set attach properties.");
     }
+    m_grantsNoCredit = m_role == _internal::SessionRole::Receiver && credit == 0;
   }
 
   void LinkImpl::SetDesiredCapabilities(Models::AmqpValue desiredCapabilities)
@@ -398,6 +401,12 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   {
     // Ensure that the connection hierarchy's state is not modified while polling on the link.
     auto lock{m_session->GetConnection()->Lock()};
+    // Once its credit runs out, link_dowork replenishes the credit of a receiver to its maximum
+    // link credit, and sends a flow each time it is called when that maximum is zero.
+    if (m_grantsNoCredit)
+    {
+      return;
+    }
     link_dowork(m_link);
   }
 
@@ -420,6 +429,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
     // Mark the connection as async so that we can use the async APIs.
     m_session->GetConnection()->EnableAsyncOperation(true);
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
   }
   void LinkImpl::Detach(
       bool close,
@@ -439,6 +449,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         throw std::runtime_error("Could not set attach properties.");
       }
     }
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
     m_session->GetConnection()->EnableAsyncOperation(false);
   }
 
@@ -524,6 +535,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         throw std::runtime_error(ss.str());
       }
     }
+    // Write the transfer now rather than at the next scheduled poll.
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
 
     auto result = m_transferCompleteQueue.WaitForResult(context);
     if (result)
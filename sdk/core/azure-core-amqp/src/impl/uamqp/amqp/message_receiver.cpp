@@ -42,7 +42,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       Models::_internal::MessageSource const& source,
       MessageReceiverOptions const& options,
       MessageReceiverEvents* eventHandler)
-      : m_options{options}, m_source{source}, m_session{session}, m_eventHandler(eventHandler)
+      : m_options{options}, m_source{source}, m_session{session}, m_eventHandler(eventHandler),
+        m_creditController{eventHandler ? 0 : options.MaxBufferedBytes, options.MaxLinkCredit}
   {
   }
 
@@ -54,7 +55,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       Models::_internal::MessageSource const& source,
       MessageReceiverOptions const& options,
       MessageReceiverEvents* eventHandler)
-      : m_options{options}, m_source{source}, m_session{session}, m_eventHandler(eventHandler)
+      : m_options{options}, m_source{source}, m_session{session}, m_eventHandler(eventHandler),
+        m_creditController{eventHandler ? 0 : options.MaxBufferedBytes, options.MaxLinkCredit}
   {
     CreateLink(linkEndpoint);
     m_messageReceiver.reset(messagereceiver_create(
@@ -118,7 +120,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     {
       m_link->SetMaxMessageSize((std::numeric_limits<uint64_t>::max)());
     }
-    if (m_options.MaxLinkCredit != 0)
+    if (m_creditController.IsEnabled())
+    {
+      m_link->SetMaxLinkCredit(m_creditController.GetReplenishCredit());
+    }
+    else if (m_options.MaxLinkCredit != 0)
     {
       m_link->SetMaxLinkCredit(m_options.MaxLinkCredit);
     }
@@ -155,13 +161,75 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
             {})));
   }
 
+  namespace {
+    // The size of the body of a message, which is most of the memory it holds.
+    uint64_t GetMessageSize(Models::AmqpMessage const& message)
+    {
+      uint64_t size = 0;
+      switch (message.BodyType)
+      {
+        case Models::MessageBodyType::Data:
+          for (auto const& data : message.GetBodyAsBinary())
+          {
+            size += data.size();
+          }
+          break;
+        case Models::MessageBodyType::Sequence:
+          for (auto const& list : message.GetBodyAsAmqpList())
+          {
+            size += Models::AmqpValue::GetSerializedSize(list.AsAmqpValue());
+          }
+          break;
+        case Models::MessageBodyType::Value:
+          size += Models::AmqpValue::GetSerializedSize(message.GetBodyAsAmqpValue());
+          break;
+        default:
+          break;
+      }
+      return size;
+    }
+  } // namespace
+
   Models::AmqpValue MessageReceiverImpl::OnMessageReceived(
       std::shared_ptr<Models::AmqpMessage> const& message)
   {
-    m_messageQueue.CompleteOperation(message, Models::_internal::AmqpError{});
+    // The connection lock is held while the link indicates a transfer, so the replenish credit
+    // can be set on the link.
+    const uint64_t messageSize = GetMessageSize(*message);
+    const uint32_t replenishCredit = m_creditController.OnMessageReceived(messageSize);
+    if (m_creditController.IsEnabled())
+    {
+      m_link->SetMaxLinkCredit(replenishCredit);
+    }
+    m_messageQueue.CompleteOperation(message, Models::_internal::AmqpError{}, messageSize);
     return Models::_internal::Messaging::DeliveryAccepted();
   }
 
+  void MessageReceiverImpl::OnMessagesConsumed(uint64_t messageCount, uint64_t messageBytes)
+  {
+    if (!m_creditController.OnMessagesConsumed(messageCount, messageBytes))
+    {
+      return;
+    }
+    {
+      auto lock{m_session->GetConnection()->Lock()};
+      if (!m_receiverOpen || m_currentState != MessageReceiverState::Open)
+      {
+        return;
+      }
+      // The credit is issued with the connection lock held, so that it accounts for the messages
+      // received in the meantime.
+      const uint32_t credit = m_creditController.IssueCredit();
+      if (credit == 0)
+      {
+        return;
+      }
+      m_link->SetMaxLinkCredit(credit);
+      m_link->ResetLinkCredit(credit, false);
+    }
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
+  }
+
   void MessageReceiverImpl::OnLinkDetached(Models::_internal::AmqpError const& error)
   {
     if (m_receiverOpen)
@@ -201,6 +269,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
       if (message)
       {
+        OnMessagesConsumed(1, std::get<2>(*result));
         rv.first = std::move(message);
       }
       rv.second = std::move(std::get<1>(*result));
@@ -226,6 +295,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
       if (message)
       {
+        OnMessagesConsumed(1, std::get<2>(*result));
         rv.first = std::move(message);
       }
       rv.second = std::move(std::get<1>(*result));
@@ -237,6 +307,41 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       return {};
     }
   }
+
+  size_t MessageReceiverImpl::TryWaitForIncomingMessages(
+      std::vector<
+          std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+          messages,
+      size_t maxMessages)
+  {
+    if (m_eventHandler)
+    {
+      throw std::runtime_error("Cannot call WaitForIncomingMessage when using an event handler.");
+    }
+
+    std::vector<
+        std::tuple<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError, uint64_t>>
+        results;
+    const size_t count = m_messageQueue.TryWaitForResults(results, maxMessages);
+    messages.reserve(messages.size() + count);
+    uint64_t messageCount = 0;
+    uint64_t messageBytes = 0;
+    for (auto& result : results)
+    {
+      if (std::get<0>(result))
+      {
+        ++messageCount;
+        messageBytes += std::get<2>(result);
+      }
+      messages.emplace_back(std::move(std::get<0>(result)), std::move(std::get<1>(result)));
+    }
+    if (messageCount != 0)
+    {
+      OnMessagesConsumed(messageCount, messageBytes);
+    }
+    return count;
+  }
+
   void MessageReceiverImpl::EnableLinkPolling()
   {
     std::unique_lock<std::mutex> lock{m_mutableState};
@@ -357,14 +462,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       {
         if (receiver->m_savedMessageError)
         {
-          receiver->m_messageQueue.CompleteOperation(nullptr, receiver->m_savedMessageError);
+          receiver->m_messageQueue.CompleteOperation(nullptr, receiver->m_savedMessageError, 0);
         }
         else
         {
           Models::_internal::AmqpError error;
           error.Condition = Models::_internal::AmqpErrorCondition::InternalError;
           error.Description = "Message receiver has transitioned to the error state.";
-          receiver->m_messageQueue.CompleteOperation(nullptr, error);
+          receiver->m_messageQueue.CompleteOperation(nullptr, error, 0);
         }
       }
 
@@ -477,6 +582,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           throw std::runtime_error("Could not close message receiver");
         }
       }
+      Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
 
       // Release the lock so that the polling thread can make forward progress delivering the
       // detach notification.
@@ -19,6 +19,7 @@
 
 #include <azure_uamqp_c/message_sender.h>
 
+#include <chrono>
 #include <memory>
 
 using namespace Azure::Core::Diagnostics;
@@ -403,6 +404,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           throw std::runtime_error("Could not close message sender");
         }
       }
+      Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
       // The message sender (and it's underlying link) is in the half open state. Wait until the
       // link has fully closed.
       if (shouldWaitForClose)
@@ -540,6 +542,52 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   }
 
+  Models::_internal::AmqpError MessageSenderImpl::GetSendError(
+      _internal::MessageSendStatus sendResult,
+      Models::AmqpValue const& deliveryStatus)
+  {
+    Models::_internal::AmqpError error;
+
+    // If the send failed. then we need to return the error. If the send completed because of an
+    // error, it's possible that the deliveryStatus provided is null. In that case, we use the
+    // cached saved error because it is highly likely to be better than nothing.
+    if (sendResult != _internal::MessageSendStatus::Ok)
+    {
+      if (deliveryStatus.IsNull())
+      {
+        error = m_savedMessageError;
+      }
+      else
+      {
+        if (deliveryStatus.GetType() != Models::AmqpValueType::List)
+        {
+          throw std::runtime_error("Delivery status is not a list");
+        }
+        auto deliveryStatusAsList{deliveryStatus.AsList()};
+        if (deliveryStatusAsList.size() != 1)
+        {
+          throw std::runtime_error("Delivery Status list is not of size 1");
+        }
+        Models::AmqpValue firstState{deliveryStatusAsList[0]};
+        ERROR_HANDLE errorHandle;
+        if (!amqpvalue_get_error(
+                Models::_detail::AmqpValueFactory::ToImplementation(firstState), &errorHandle))
+        {
+          Models::_detail::UniqueAmqpErrorHandle uniqueError{
+              errorHandle}; // This will free the error handle when it goes out of scope.
+          error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
+        }
+      }
+    }
+    else
+    {
+      // If we successfully sent the message, then whatever saved error should be cleared, it's no
+      // longer valid.
+      m_savedMessageError = Models::_internal::AmqpError();
+    }
+    return error;
+  }
+
   std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> MessageSenderImpl::Send(
       Models::AmqpMessage const& message,
       Context const& context)
@@ -552,51 +600,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           [this](
               Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
               Models::AmqpValue deliveryStatus) {
-            Models::_internal::AmqpError error;
-
-            // If the send failed. then we need to return the error. If the send completed because
-            // of an error, it's possible that the deliveryStatus provided is null. In that case,
-            // we use the cached saved error because it is highly likely to be better than
-            // nothing.
-            if (sendResult != _internal::MessageSendStatus::Ok)
-            {
-              if (deliveryStatus.IsNull())
-              {
-                error = m_savedMessageError;
-              }
-              else
-              {
-                if (deliveryStatus.GetType() != Models::AmqpValueType::List)
-                {
-                  throw std::runtime_error("Delivery status is not a list");
-                }
-                auto deliveryStatusAsList{deliveryStatus.AsList()};
-                if (deliveryStatusAsList.size() != 1)
-                {
-                  throw std::runtime_error("Delivery Status list is not of size 1");
-                }
-                Models::AmqpValue firstState{deliveryStatusAsList[0]};
-                ERROR_HANDLE errorHandle;
-                if (!amqpvalue_get_error(
-                        Models::_detail::AmqpValueFactory::ToImplementation(firstState),
-                        &errorHandle))
-                {
-                  Models::_detail::UniqueAmqpErrorHandle uniqueError{
-                      errorHandle}; // This will free the error handle when it goes out of scope.
-                  error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
-                }
-              }
-            }
-            else
-            {
-              // If we successfully sent the message, then whatever saved error should be cleared,
-              // it's no longer valid.
-              m_savedMessageError = Models::_internal::AmqpError();
-            }
-            m_sendCompleteQueue.CompleteOperation(sendResult, error);
+            m_sendCompleteQueue.CompleteOperation(
+                sendResult, GetSendError(sendResult, deliveryStatus));
           },
           context);
     }
+    // Write the transfer now rather than at the next scheduled poll.
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
     auto result = m_sendCompleteQueue.WaitForResult(context);
     if (result)
     {
@@ -612,6 +622,70 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   }
 
+  void MessageSenderImpl::SendAsync(
+      Models::AmqpMessage const& message,
+      _internal::MessageSender::MessageSendResultCallback onSendComplete,
+      Context const& context)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_pendingSendsMutex);
+      if (m_options.MaxPendingSends != 0)
+      {
+        // Wait for a pending message to be settled, waking up periodically to check for
+        // cancellation.
+        while (!m_pendingSendsChanged.wait_for(
+            lock, std::chrono::milliseconds(100), [this]() {
+              return m_pendingSends < m_options.MaxPendingSends;
+            }))
+        {
+          context.ThrowIfCancelled();
+        }
+      }
+      context.ThrowIfCancelled();
+      ++m_pendingSends;
+    }
+
+    auto onSettled = [this, onSendComplete](
+                         Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
+                         Models::AmqpValue deliveryStatus) {
+      {
+        std::lock_guard<std::mutex> lock(m_pendingSendsMutex);
+        --m_pendingSends;
+      }
+      m_pendingSendsChanged.notify_one();
+
+      // The caller is waiting for this callback, so a malformed delivery state must still complete
+      // the send, and must not propagate into uAMQP.
+      Models::_internal::AmqpError error;
+      try
+      {
+        error = GetSendError(sendResult, deliveryStatus);
+      }
+      catch (std::exception const& ex)
+      {
+        sendResult = _internal::MessageSendStatus::Error;
+        error = {Models::_internal::AmqpErrorCondition::InternalError, ex.what(), {}};
+      }
+      onSendComplete(sendResult, error);
+    };
+    try
+    {
+      auto lock{m_session->GetConnection()->Lock()};
+      QueueSendInternal(message, onSettled, {});
+    }
+    catch (...)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_pendingSendsMutex);
+        --m_pendingSends;
+      }
+      m_pendingSendsChanged.notify_one();
+      throw;
+    }
+    // Write the transfer now rather than at the next scheduled poll.
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
+  }
+
   std::string MessageSenderImpl::GetLinkName() const { return m_link->GetName(); }
 
 }}}} // namespace Azure::Core::Amqp::_detail
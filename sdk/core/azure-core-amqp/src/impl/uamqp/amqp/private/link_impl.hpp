@@ -114,6 +114,9 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
   private:
     LINK_HANDLE m_link;
+    _internal::SessionRole m_role;
+    // True if the link is a receiver whose maximum link credit is zero.
+    bool m_grantsNoCredit{false};
     std::shared_ptr<_detail::SessionImpl> m_session;
     Models::_internal::MessageSource m_source;
     Models::_internal::MessageTarget m_target;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "../../../../amqp/private/link_credit_controller.hpp"
 #include "../../../../amqp/private/unique_handle.hpp"
 #include "azure/core/amqp/internal/message_receiver.hpp"
 #include "link_impl.hpp"
@@ -66,7 +67,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
 
     std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
     TryWaitForIncomingMessage();
+    size_t TryWaitForIncomingMessages(
+        std::vector<
+            std::pair<std::shared_ptr<const Models::AmqpMessage>, Models::_internal::AmqpError>>&
+            messages,
+        size_t maxMessages);
     void EnableLinkPolling();
+    _internal::MessageReceiverStatistics GetStatistics() const
+    {
+      return m_creditController.GetStatistics();
+    }
 
   private:
     UniqueMessageReceiver m_messageReceiver{};
@@ -82,9 +92,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     bool m_linkPollingEnabled{false};
     std::mutex m_mutableState;
 
-    Azure::Core::Amqp::Common::_internal::
-        AsyncOperationQueue<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
-            m_messageQueue;
+    // The received messages, with the errors and the sizes of the messages as measured for the
+    // credit controller.
+    Azure::Core::Amqp::Common::_internal::AsyncOperationQueue<
+        std::shared_ptr<Models::AmqpMessage>,
+        Models::_internal::AmqpError,
+        std::uint64_t>
+        m_messageQueue;
 
     // When we close a uAMQP messagereceiver, the link is left in the half closed state. We need to
     // wait for the link to be fully closed before we can close the session. This queue will hold
@@ -93,6 +107,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         m_closeQueue;
 
     _internal::MessageReceiverEvents* m_eventHandler{};
+
+    // Sizes the link credit from the messages waiting in m_messageQueue.
+    LinkCreditController m_creditController;
+
     static AMQP_VALUE OnMessageReceivedFn(const void* context, MESSAGE_HANDLE message);
 
     virtual Models::AmqpValue OnMessageReceived(
@@ -105,6 +123,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         MESSAGE_RECEIVER_STATE newState,
         MESSAGE_RECEIVER_STATE oldState);
 
+    void OnMessagesConsumed(uint64_t messageCount, uint64_t messageBytes);
+
     void CreateLink();
     void CreateLink(_internal::LinkEndpoint& endpoint);
     void PopulateLinkProperties();
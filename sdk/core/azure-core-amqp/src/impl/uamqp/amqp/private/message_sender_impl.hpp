@@ -9,6 +9,9 @@
 
 #include <azure_uamqp_c/message_sender.h>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   template <> struct UniqueHandleHelper<MESSAGE_SENDER_INSTANCE_TAG>
   {
@@ -55,6 +58,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context);
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        _internal::MessageSender::MessageSendResultCallback onSendComplete,
+        Context const& context);
 
     std::uint64_t GetMaxMessageSize() const;
 
@@ -73,6 +80,9 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         Azure::Core::Amqp::_internal::MessageSender::MessageSendCompleteCallback onSendComplete,
         Context const& context);
     void OnLinkDetached(Models::_internal::AmqpError const& error);
+    Models::_internal::AmqpError GetSendError(
+        _internal::MessageSendStatus sendResult,
+        Models::AmqpValue const& deliveryStatus);
 
     bool m_senderOpen{false};
     UniqueMessageSender m_messageSender{};
@@ -90,6 +100,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         m_closeQueue;
     _internal::MessageSenderState m_currentState{};
 
+    // The number of messages sent with SendAsync which are not settled yet.
+    std::mutex m_pendingSendsMutex;
+    std::condition_variable m_pendingSendsChanged;
+    std::uint32_t m_pendingSends{};
+
     std::shared_ptr<_detail::SessionImpl> m_session;
     Models::_internal::MessageTarget m_target;
     _internal::MessageSenderOptions m_options;
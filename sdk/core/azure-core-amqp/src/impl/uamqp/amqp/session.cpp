@@ -163,6 +163,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     // Mark the connection as async so that we can use the async APIs.
     GetConnection()->EnableAsyncOperation(true);
     m_connectionAsyncStarted = true;
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
   }
   void SessionImpl::End(Azure::Core::Context const&)
   {
@@ -176,6 +177,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     {
       throw std::runtime_error("Could not begin session");
     }
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
     // Mark the connection as async so that we can use the async APIs.
     GetConnection()->EnableAsyncOperation(false);
     m_connectionAsyncStarted = false;
@@ -200,6 +202,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     {
       throw std::runtime_error("Could not begin session");
     }
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->RequestPoll();
     // Mark the connection as async so that we can use the async APIs.
     GetConnection()->EnableAsyncOperation(false);
     m_connectionAsyncStarted = false;
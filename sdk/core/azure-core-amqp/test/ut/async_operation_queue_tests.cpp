@@ -3,6 +3,11 @@
 
 #include "azure/core/amqp/internal/common/async_operation_queue.hpp"
 
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using namespace Azure::Core::Amqp::Common::_internal;
@@ -85,3 +90,111 @@ TEST_F(TestAsyncQueue, ReadCanceled)
     EXPECT_FALSE(item);
   }
 }
+
+TEST_F(TestAsyncQueue, DrainQueue)
+{
+  AsyncOperationQueue<int, std::unique_ptr<int>> queue;
+  for (int i = 0; i < 5; ++i)
+  {
+    queue.CompleteOperation(i, std::make_unique<int>(i * 10));
+  }
+  EXPECT_EQ(5U, queue.Size());
+
+  std::vector<std::tuple<int, std::unique_ptr<int>>> results;
+  EXPECT_EQ(3U, queue.TryWaitForResults(results, 3));
+  ASSERT_EQ(3U, results.size());
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(i, std::get<0>(results[i]));
+    EXPECT_EQ(i * 10, *std::get<1>(results[i]));
+  }
+
+  // The results are appended.
+  EXPECT_EQ(2U, queue.TryWaitForResults(results, 10));
+  ASSERT_EQ(5U, results.size());
+  EXPECT_EQ(4, std::get<0>(results[4]));
+
+  EXPECT_EQ(0U, queue.TryWaitForResults(results, 10));
+  EXPECT_EQ(0U, queue.Size());
+}
+
+TEST_F(TestAsyncQueue, WaitForResultFromOtherThread)
+{
+  AsyncOperationQueue<int> queue;
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.CompleteOperation(42);
+  });
+  auto item = queue.WaitForResult(Azure::Core::Context{});
+  producer.join();
+  ASSERT_TRUE(item);
+  EXPECT_EQ(42, std::get<0>(*item));
+}
+
+TEST_F(TestAsyncQueue, WaitForPolledResult)
+{
+  class Poller final {
+  public:
+    Poller(AsyncOperationQueue<int>& queue) : m_queue(queue) {}
+    void Poll()
+    {
+      if (++PollCount == 3)
+      {
+        m_queue.CompleteOperation(PollCount);
+      }
+    }
+    int PollCount = 0;
+
+  private:
+    AsyncOperationQueue<int>& m_queue;
+  };
+
+  AsyncOperationQueue<int> queue;
+  Poller poller(queue);
+  auto item = queue.WaitForPolledResult(Azure::Core::Context{}, poller);
+  ASSERT_TRUE(item);
+  EXPECT_EQ(3, std::get<0>(*item));
+  EXPECT_EQ(3, poller.PollCount);
+}
+
+TEST_F(TestAsyncQueue, WaitForPolledResultFromOtherThread)
+{
+  class Poller final {
+  public:
+    void Poll() { ++PollCount; }
+    int PollCount = 0;
+  };
+
+  AsyncOperationQueue<int> queue;
+  Poller poller;
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    queue.CompleteOperation(42);
+  });
+  auto item = queue.WaitForPolledResult(Azure::Core::Context{}, poller);
+  producer.join();
+  ASSERT_TRUE(item);
+  EXPECT_EQ(42, std::get<0>(*item));
+  // The waiter backs off between the polls rather than spinning. In 200 milliseconds, it polls
+  // about 16 times.
+  EXPECT_LT(poller.PollCount, 50);
+}
+
+TEST_F(TestAsyncQueue, WaitForPolledResultCanceled)
+{
+  class Poller final {
+  public:
+    void Poll() {}
+  };
+
+  AsyncOperationQueue<int> queue;
+  Poller poller;
+  Azure::Core::Context context;
+  std::thread canceller([&context]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    context.Cancel();
+  });
+  auto item = queue.WaitForPolledResult(context, poller);
+  canceller.join();
+  EXPECT_FALSE(item);
+}
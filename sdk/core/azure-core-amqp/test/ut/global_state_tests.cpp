@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/core/amqp/internal/common/global_state.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace Azure { namespace Core { namespace Amqp { namespace Tests {
+  using namespace Azure::Core::Amqp::Common::_detail;
+
+  class TestGlobalState : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override { GlobalStateHolder::GlobalStateInstance()->AssertIdle(); }
+  };
+
+  namespace {
+    // A pollable which blocks in Poll until it is released.
+    class BlockingPollable final : public Pollable {
+    public:
+      void Poll() override
+      {
+        if (!m_polled.exchange(true))
+        {
+          m_pollStarted.set_value();
+        }
+        m_released.wait();
+      }
+
+      std::future<void> PollStarted() { return m_pollStarted.get_future(); }
+      void Release() { m_release.set_value(); }
+
+    private:
+      std::atomic<bool> m_polled{false};
+      std::promise<void> m_pollStarted;
+      std::promise<void> m_release;
+      std::shared_future<void> m_released{m_release.get_future().share()};
+    };
+
+    // A pollable which removes itself from the global state the first time it is polled.
+    class SelfRemovingPollable final : public Pollable,
+                                       public std::enable_shared_from_this<SelfRemovingPollable> {
+    public:
+      void Poll() override
+      {
+        if (!m_removed.exchange(true))
+        {
+          GlobalStateHolder::GlobalStateInstance()->RemovePollable(shared_from_this());
+          m_done.set_value();
+        }
+      }
+
+      std::future<void> Removed() { return m_done.get_future(); }
+
+    private:
+      std::atomic<bool> m_removed{false};
+      std::promise<void> m_done;
+    };
+
+    class CountingPollable final : public Pollable {
+    public:
+      void Poll() override { ++PollCount; }
+
+      std::atomic<int> PollCount{0};
+    };
+  } // namespace
+
+  TEST_F(TestGlobalState, RemovePollableWaitsForPoll)
+  {
+    auto globalState = GlobalStateHolder::GlobalStateInstance();
+    auto pollable = std::make_shared<BlockingPollable>();
+    auto pollStarted = pollable->PollStarted();
+    globalState->AddPollable(pollable);
+    ASSERT_EQ(std::future_status::ready, pollStarted.wait_for(std::chrono::seconds(10)));
+
+    auto removed
+        = std::async(std::launch::async, [&]() { globalState->RemovePollable(pollable); });
+    // The pollable is still being polled, so RemovePollable must not return yet.
+    EXPECT_EQ(std::future_status::timeout, removed.wait_for(std::chrono::milliseconds(100)));
+
+    pollable->Release();
+    ASSERT_EQ(std::future_status::ready, removed.wait_for(std::chrono::seconds(10)));
+    removed.get();
+    // The polling thread no longer holds a reference to the pollable.
+    EXPECT_EQ(1, pollable.use_count());
+  }
+
+  TEST_F(TestGlobalState, RemovePollableFromPoll)
+  {
+    auto globalState = GlobalStateHolder::GlobalStateInstance();
+    auto pollable = std::make_shared<SelfRemovingPollable>();
+    auto removed = pollable->Removed();
+    globalState->AddPollable(pollable);
+    ASSERT_EQ(std::future_status::ready, removed.wait_for(std::chrono::seconds(10)));
+
+    // Polling continues after a pollable removed itself.
+    auto counter = std::make_shared<CountingPollable>();
+    globalState->AddPollable(counter);
+    for (int i = 0; i < 1000 && counter->PollCount < 2; ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_GE(counter->PollCount, 2);
+    globalState->RemovePollable(counter);
+  }
+
+  TEST_F(TestGlobalState, AddRemovePollableConcurrently)
+  {
+    auto globalState = GlobalStateHolder::GlobalStateInstance();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+      threads.emplace_back([globalState]() {
+        for (int j = 0; j < 100; ++j)
+        {
+          auto pollable = std::make_shared<CountingPollable>();
+          globalState->AddPollable(pollable);
+          globalState->RequestPoll();
+          globalState->RemovePollable(pollable);
+          EXPECT_EQ(1, pollable.use_count());
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+}}}} // namespace Azure::Core::Amqp::Tests
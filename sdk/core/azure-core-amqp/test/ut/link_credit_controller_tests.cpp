@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../src/amqp/private/link_credit_controller.hpp"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Core::Amqp::_detail;
+
+class TestLinkCreditController : public testing::Test {
+protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(TestLinkCreditController, Disabled)
+{
+  LinkCreditController controller(0, 0);
+  EXPECT_FALSE(controller.IsEnabled());
+  EXPECT_EQ(LinkCreditController::DefaultMaxLinkCredit, controller.GetReplenishCredit());
+
+  for (int i = 0; i < 3; i += 1)
+  {
+    EXPECT_EQ(LinkCreditController::DefaultMaxLinkCredit, controller.OnMessageReceived(100));
+  }
+  EXPECT_FALSE(controller.OnMessagesConsumed(2, 200));
+  EXPECT_EQ(0u, controller.IssueCredit());
+
+  auto statistics = controller.GetStatistics();
+  EXPECT_EQ(1u, statistics.QueuedMessages);
+  EXPECT_EQ(100u, statistics.QueuedBytes);
+  EXPECT_EQ(LinkCreditController::DefaultMaxLinkCredit - 3, statistics.LinkCredit);
+  EXPECT_EQ(3u, statistics.MessagesReceived);
+  EXPECT_EQ(100u, statistics.AverageMessageSize);
+}
+
+TEST_F(TestLinkCreditController, ByteBudget)
+{
+  // Room for 10 messages of 1000 bytes.
+  LinkCreditController controller(10000, 300);
+  EXPECT_TRUE(controller.IsEnabled());
+  // The size of the messages is not known yet.
+  EXPECT_EQ(LinkCreditController::MinimumLinkCredit, controller.GetReplenishCredit());
+
+  for (uint32_t i = 1; i < 10; i += 1)
+  {
+    EXPECT_EQ(10 - i, controller.OnMessageReceived(1000));
+  }
+  EXPECT_EQ(1u, controller.GetStatistics().LinkCredit);
+
+  // The last credit is replenished to the room left in the budget, which is none.
+  EXPECT_EQ(0u, controller.OnMessageReceived(1000));
+  auto statistics = controller.GetStatistics();
+  EXPECT_EQ(10u, statistics.QueuedMessages);
+  EXPECT_EQ(10000u, statistics.QueuedBytes);
+  EXPECT_EQ(0u, statistics.LinkCredit);
+  EXPECT_EQ(10u, statistics.CreditWindow);
+
+  // Credit is issued once half of the window is free.
+  EXPECT_FALSE(controller.OnMessagesConsumed(4, 4000));
+  EXPECT_TRUE(controller.OnMessagesConsumed(1, 1000));
+  EXPECT_EQ(5u, controller.IssueCredit());
+  EXPECT_EQ(5u, controller.GetReplenishCredit());
+  EXPECT_FALSE(controller.OnMessagesConsumed(1, 1000));
+  EXPECT_EQ(0u, controller.IssueCredit());
+
+  statistics = controller.GetStatistics();
+  EXPECT_EQ(4u, statistics.QueuedMessages);
+  EXPECT_EQ(5u, statistics.LinkCredit);
+  EXPECT_EQ(3u, statistics.CreditIssueCount);
+}
+
+TEST_F(TestLinkCreditController, MessageLargerThanBudget)
+{
+  LinkCreditController controller(500, 300);
+  // A single message is buffered at a time, once the initial credit is used.
+  EXPECT_EQ(0u, controller.OnMessageReceived(1000));
+  auto statistics = controller.GetStatistics();
+  EXPECT_EQ(1u, statistics.CreditWindow);
+  EXPECT_EQ(LinkCreditController::MinimumLinkCredit - 1, statistics.LinkCredit);
+
+  for (uint32_t i = 1; i < LinkCreditController::MinimumLinkCredit; i += 1)
+  {
+    EXPECT_FALSE(controller.OnMessagesConsumed(1, 1000));
+    EXPECT_EQ(0u, controller.OnMessageReceived(1000));
+  }
+  EXPECT_EQ(0u, controller.GetStatistics().LinkCredit);
+  EXPECT_TRUE(controller.OnMessagesConsumed(1, 1000));
+  EXPECT_EQ(1u, controller.IssueCredit());
+}
+
+TEST_F(TestLinkCreditController, DrainRate)
+{
+  auto start = LinkCreditController::Clock::now();
+  LinkCreditController controller(1024 * 1024 * 1024, 1000, start);
+
+  for (int i = 0; i < 10; i += 1)
+  {
+    controller.OnMessageReceived(100);
+  }
+  // The window is bounded by the maximum link credit, before the drain rate is known.
+  EXPECT_EQ(1000u, controller.GetStatistics().CreditWindow);
+  EXPECT_EQ(990u, controller.GetReplenishCredit());
+
+  // 10 messages in 200 milliseconds.
+  EXPECT_FALSE(controller.OnMessagesConsumed(10, 1000, start + std::chrono::milliseconds(200)));
+  auto statistics = controller.GetStatistics();
+  EXPECT_DOUBLE_EQ(50.0, statistics.DrainRate);
+  EXPECT_EQ(50u, statistics.CreditWindow);
+  EXPECT_EQ(0u, statistics.QueuedMessages);
+
+  // Samples shorter than the sample interval are accumulated.
+  controller.OnMessagesConsumed(0, 0, start + std::chrono::milliseconds(250));
+  EXPECT_DOUBLE_EQ(50.0, controller.GetStatistics().DrainRate);
+
+  // Nothing taken in the next 200 milliseconds.
+  controller.OnMessagesConsumed(0, 0, start + std::chrono::milliseconds(400));
+  statistics = controller.GetStatistics();
+  EXPECT_DOUBLE_EQ(37.5, statistics.DrainRate);
+  EXPECT_EQ(37u, statistics.CreditWindow);
+
+  // The window does not shrink below the minimum link credit.
+  for (int i = 1; i < 20; i += 1)
+  {
+    controller.OnMessagesConsumed(0, 0, start + std::chrono::milliseconds(400 + i * 200));
+  }
+  EXPECT_EQ(LinkCreditController::MinimumLinkCredit, controller.GetStatistics().CreditWindow);
+}
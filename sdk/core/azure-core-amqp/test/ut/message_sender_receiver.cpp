@@ -27,7 +27,10 @@
 #include <azure/core/platform.hpp>
 #include <azure/core/url.hpp>
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <random>
 
 #include <gtest/gtest.h>
@@ -568,6 +571,91 @@ namespace Azure { namespace Core { namespace Amqp { namespace Tests {
     CloseAmqpConnection(connection);
   }
 
+#if ENABLE_UAMQP
+  TEST_F(TestMessageSendReceive, SenderSendPipelined)
+  {
+#if !defined(USE_NATIVE_BROKER)
+    class SenderLinkEndpoint final : public MessageTests::MockServiceEndpoint {
+    public:
+      SenderLinkEndpoint(
+          std::string const& name,
+          MessageTests::MockServiceEndpointOptions const& options)
+          : MockServiceEndpoint(name, options)
+      {
+      }
+
+      virtual ~SenderLinkEndpoint() = default;
+
+    private:
+      void MessageReceived(
+          std::string const& linkName,
+          std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage> const& message) override
+      {
+        GTEST_LOG_(INFO) << "Message received on link " << linkName << ": " << *message;
+      }
+    };
+
+    MessageTests::MockServiceEndpointOptions mockServiceEndpointOptions{};
+    auto senderEndpoint
+        = std::make_shared<SenderLinkEndpoint>("localhost/ingress", mockServiceEndpointOptions);
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+#endif
+
+    auto connection{CreateAmqpConnection({})};
+    auto session{CreateAmqpSession(connection)};
+
+    // Ensure that the thread is started before we start using the message sender.
+    StartServerListening();
+
+    {
+      MessageSenderOptions options;
+      options.SettleMode = SenderSettleMode::Unsettled;
+      options.MaxMessageSize = 65536;
+      options.MessageSource = "ingress";
+      options.Name = "sender-link";
+      options.MaxPendingSends = 4;
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open());
+
+      constexpr int MessageCount = 20;
+      std::mutex completedMutex;
+      std::condition_variable completedChanged;
+      int completedCount = 0;
+      int okCount = 0;
+      for (int i = 0; i < MessageCount; ++i)
+      {
+        Azure::Core::Amqp::Models::AmqpMessage message;
+        message.SetBody(Azure::Core::Amqp::Models::AmqpValue{"Message " + std::to_string(i)});
+        sender.SendAsync(
+            message,
+            [&](MessageSendStatus sendResult, Models::_internal::AmqpError const&) {
+              std::lock_guard<std::mutex> lock(completedMutex);
+              ++completedCount;
+              if (sendResult == MessageSendStatus::Ok)
+              {
+                ++okCount;
+              }
+              completedChanged.notify_one();
+            });
+      }
+
+      {
+        std::unique_lock<std::mutex> lock(completedMutex);
+        EXPECT_TRUE(completedChanged.wait_for(lock, std::chrono::seconds(15), [&]() {
+          return completedCount == MessageCount;
+        }));
+        EXPECT_EQ(okCount, MessageCount);
+      }
+
+      sender.Close();
+    }
+    StopServerListening();
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+#endif
+
 #if ENABLE_UAMQP
   TEST_F(TestMessageSendReceive, AuthenticatedSender)
   {
@@ -1158,5 +1246,127 @@ namespace Azure { namespace Core { namespace Amqp { namespace Tests {
     CloseAmqpConnection(connection);
   }
 
+  TEST_F(TestMessageSendReceive, ReceiverTryReceiveBatch)
+  {
+    std::string brokerEndpoint
+        = GetBrokerEndpoint() + testing::UnitTest::GetInstance()->current_test_info()->name();
+    constexpr int MessageCount = 10;
+#if !defined(USE_NATIVE_BROKER)
+    class ReceiverServiceEndpoint final : public MessageTests::MockServiceEndpoint {
+    public:
+      ReceiverServiceEndpoint(
+          std::string const& name,
+          MessageTests::MockServiceEndpointOptions const& options)
+          : MockServiceEndpoint(name, options)
+      {
+      }
+      virtual ~ReceiverServiceEndpoint() = default;
+
+      void ShouldSendMessages(bool shouldSend) { m_shouldSendMessages = shouldSend; }
+
+    private:
+      mutable std::atomic<bool> m_shouldSendMessages{false};
+
+      void Poll() const override
+      {
+        if (m_shouldSendMessages && HasMessageSender())
+        {
+          m_shouldSendMessages = false;
+          for (int i = 0; i < MessageCount; ++i)
+          {
+            Azure::Core::Amqp::Models::AmqpMessage sendMessage;
+            sendMessage.Properties.MessageId
+                = Azure::Core::Amqp::Models::AmqpValue{"Message " + std::to_string(i)};
+            sendMessage.SetBody(Azure::Core::Amqp::Models::AmqpValue{"This is a message body."});
+            EXPECT_EQ(MessageSendStatus::Ok, std::get<0>(GetMessageSender().Send(sendMessage)));
+          }
+        }
+      }
+      void MessageReceived(
+          std::string const& linkName,
+          std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage> const& message) override
+      {
+        GTEST_LOG_(INFO) << "Message received on link " << linkName << ": " << *message;
+      }
+    };
+
+    auto serviceEndpoint = std::make_shared<ReceiverServiceEndpoint>(
+        brokerEndpoint, MessageTests::MockServiceEndpointOptions{});
+    m_mockServer.AddServiceEndpoint(serviceEndpoint);
+#endif
+    auto connection{CreateAmqpConnection()};
+    auto session{CreateAmqpSession(connection)};
+
+#if !defined(USE_NATIVE_BROKER)
+    StartServerListening();
+#endif
+
+    MessageReceiverOptions receiverOptions;
+    receiverOptions.Name = "receiver-link";
+    receiverOptions.MessageTarget = "egress";
+    receiverOptions.SettleMode = Azure::Core::Amqp::_internal::ReceiverSettleMode::First;
+    receiverOptions.MaxMessageSize = 65536;
+    receiverOptions.MaxLinkCredit = 500;
+    MessageReceiver receiver(session.CreateMessageReceiver(brokerEndpoint, receiverOptions));
+
+    receiver.Open();
+
+    std::vector<std::pair<
+        std::shared_ptr<const Azure::Core::Amqp::Models::AmqpMessage>,
+        Models::_internal::AmqpError>>
+        results;
+    EXPECT_EQ(0U, receiver.TryWaitForIncomingMessages(results, MessageCount));
+    EXPECT_TRUE(results.empty());
+
+#if !defined(USE_NATIVE_BROKER)
+    serviceEndpoint->ShouldSendMessages(true);
+#else
+    {
+      MessageSender sender(session.CreateMessageSender(brokerEndpoint, {}));
+      ASSERT_FALSE(sender.Open());
+      for (int i = 0; i < MessageCount; ++i)
+      {
+        Azure::Core::Amqp::Models::AmqpMessage sendMessage;
+        sendMessage.Properties.MessageId
+            = Azure::Core::Amqp::Models::AmqpValue{"Message " + std::to_string(i)};
+        sendMessage.SetBody(Azure::Core::Amqp::Models::AmqpValue{"This is a message body."});
+        EXPECT_FALSE(std::get<1>(sender.Send(sendMessage)));
+      }
+      sender.Close();
+    }
+#endif
+
+    // The messages are drained in the order they were sent, at most three at a time.
+    auto timeout = std::chrono::system_clock::now() + std::chrono::seconds(10);
+    while (results.size() < static_cast<size_t>(MessageCount)
+           && std::chrono::system_clock::now() < timeout)
+    {
+      const auto previousSize = results.size();
+      const auto count = receiver.TryWaitForIncomingMessages(results, 3);
+      EXPECT_LE(count, 3U);
+      EXPECT_EQ(previousSize + count, results.size());
+      if (count == 0)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+    }
+    ASSERT_EQ(static_cast<size_t>(MessageCount), results.size());
+    for (int i = 0; i < MessageCount; ++i)
+    {
+      ASSERT_TRUE(results[i].first);
+      EXPECT_FALSE(results[i].second);
+      EXPECT_EQ(
+          "Message " + std::to_string(i),
+          static_cast<std::string>(results[i].first->Properties.MessageId));
+    }
+    receiver.Close();
+
+#if !defined(USE_NATIVE_BROKER)
+    StopServerListening();
+#endif
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
 #endif // !defined(AZ_PLATFORM_MAC)
 }}}} // namespace Azure::Core::Amqp::Tests
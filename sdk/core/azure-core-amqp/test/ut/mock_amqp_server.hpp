@@ -16,7 +16,9 @@
 #include <azure/core/amqp/internal/network/socket_listener.hpp>
 #include <azure/core/amqp/internal/session.hpp>
 
+#include <list>
 #include <memory>
+#include <thread>
 
 #include <gtest/gtest.h>
 
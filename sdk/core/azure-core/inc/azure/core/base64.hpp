@@ -10,6 +10,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint> // defines std::uint8_t
 #include <stdexcept>
 #include <stdint.h> // deprecated, defines uint8_t in global namespace. TODO: Remove when uint8_t in the global namespace is removed.
@@ -50,6 +51,66 @@ namespace Azure { namespace Core {
      * @return The decoded binary data.
      */
     static std::vector<uint8_t> Base64Decode(const std::string& text);
+
+    /**
+     * @brief Gets the number of characters of the Base64 encoding of \p length bytes.
+     *
+     * @param length The number of bytes to encode.
+     * @return The size of the Base64 encoded data, padding included.
+     */
+    static size_t GetBase64EncodedSize(size_t length);
+
+    /**
+     * @brief Encodes binary data using Base64, into a buffer provided by the caller.
+     *
+     * @remark Does not allocate memory, nor write a null terminator.
+     *
+     * @param data The binary data to be encoded.
+     * @param length The number of bytes of \p data.
+     * @param destination The buffer receiving the Base64 encoded data.
+     * @param destinationSize The size of \p destination, which must be at least
+     * #GetBase64EncodedSize(length).
+     * @return The number of characters written to \p destination.
+     *
+     * @throw std::invalid_argument if \p destination is too small.
+     */
+    static size_t Base64Encode(
+        uint8_t const* data,
+        size_t length,
+        char* destination,
+        size_t destinationSize);
+
+    /**
+     * @brief Gets the number of bytes of the decoded Base64 encoded \p text.
+     *
+     * @param text Base64 encoded data.
+     * @param length The number of characters of \p text.
+     * @return The size of the decoded binary data.
+     *
+     * @throw std::runtime_error if \p length is not a multiple of 4.
+     */
+    static size_t GetBase64DecodedSize(char const* text, size_t length);
+
+    /**
+     * @brief Decodes Base64 encoded data, into a buffer provided by the caller.
+     *
+     * @remark Does not allocate memory.
+     *
+     * @param text Base64 encoded data to be decoded.
+     * @param length The number of characters of \p text.
+     * @param destination The buffer receiving the decoded binary data.
+     * @param destinationSize The size of \p destination, which must be at least
+     * #GetBase64DecodedSize(text, length).
+     * @return The number of bytes written to \p destination.
+     *
+     * @throw std::runtime_error if \p text is not valid Base64.
+     * @throw std::invalid_argument if \p destination is too small.
+     */
+    static size_t Base64Decode(
+        char const* text,
+        size_t length,
+        uint8_t* destination,
+        size_t destinationSize);
   };
 
   namespace _internal {
@@ -77,6 +138,15 @@ namespace Azure { namespace Core {
        * @return The Base64 encoded contents of the string.
        */
       static std::string Base64Encode(const std::string& data);
+
+      /**
+       * @brief Encodes binary data using Base64 encoding.
+       *
+       * @param data The binary data to be encoded.
+       * @param length The number of bytes of \p data.
+       * @return The Base64 encoded data.
+       */
+      static std::string Base64Encode(uint8_t const* data, size_t length);
     };
 
     /**
@@ -11,10 +11,16 @@
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/http/transport.hpp"
 #include "azure/core/nullable.hpp"
+#include "azure/core/url.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure { namespace Core { namespace Http {
   class CurlNetworkConnection;
@@ -26,8 +32,63 @@ namespace Azure { namespace Core { namespace Http {
      *
      */
     constexpr std::chrono::milliseconds DefaultConnectionTimeout = std::chrono::minutes(5);
+
+    /**
+     * @brief Default maximum number of idle connections kept in the connection pool for each host.
+     *
+     */
+    constexpr size_t DefaultMaxIdleConnectionsPerHost = 1024;
+
+    /**
+     * @brief Default size of the buffer used to read the responses from the network.
+     *
+     */
+    constexpr size_t DefaultReadBufferSize = 4 * 1024;
+
+    /**
+     * @brief Maximum size the read buffer grows to when the adaptive read buffer is enabled.
+     *
+     */
+    constexpr size_t MaxAdaptiveReadBufferSize = 1024 * 1024;
   } // namespace _detail
 
+  /**
+   * @brief Counters updated by the connection pool of the libcurl transport adapter.
+   *
+   * @remark See #Azure::Core::Http::CurlTransportOptions::ConnectionPoolMetrics.
+   */
+  struct CurlConnectionPoolMetrics final
+  {
+    /**
+     * @brief Number of connections re-used from the connection pool.
+     *
+     */
+    std::atomic<uint64_t> Hits{0};
+
+    /**
+     * @brief Number of new connections created because there was no idle connection to re-use.
+     *
+     */
+    std::atomic<uint64_t> Misses{0};
+
+    /**
+     * @brief Number of idle connections removed from the connection pool, either because they
+     * expired, because the pool was reset or because the maximum number of idle connections was
+     * reached.
+     *
+     */
+    std::atomic<uint64_t> Evictions{0};
+
+    /**
+     * @brief Total time, in microseconds, spent waiting for the connection pool. This includes
+     * waiting for the pool lock and, when
+     * #Azure::Core::Http::CurlTransportOptions::MaxConnectionsPerHost is reached, waiting for a
+     * connection to be released.
+     *
+     */
+    std::atomic<uint64_t> WaitTimeMicroseconds{0};
+  };
+
   /**
    * @brief The available options to set libcurl SSL options.
    *
@@ -197,8 +258,108 @@ namespace Azure { namespace Core { namespace Http {
 
     /**
      * @brief If set, enables libcurl's internal SSL session caching.
+     *
+     * @details The TLS sessions are shared by all the connections of the process with the same TLS
+     * verification settings, so a new connection to a host already connected to resumes the
+     * session instead of doing a full TLS handshake.
      */
     bool EnableCurlSslCaching = true;
+
+    /**
+     * @brief If set, the host names resolved by a connection are cached and re-used by all the
+     * connections of the process, instead of resolving them again for each connection.
+     *
+     * @remark Resolved host names are kept in the cache for 60 seconds.
+     */
+    bool EnableCurlDnsCaching = true;
+
+    /**
+     * @brief The size of the buffer used by each request to read its response from the network.
+     * `0` means the default size, which is 4 KB. Sizes smaller than 1 KB are raised to 1 KB.
+     *
+     * @details The status line and the headers are read through this buffer, and so are the parts
+     * of the response body read in pieces smaller than the buffer. A larger buffer takes fewer
+     * reads from the network for those, at the cost of memory for each request in flight.
+     *
+     * @remark Reading the response body in pieces at least as large as the buffer reads the data
+     * from the network straight to the caller buffer.
+     *
+     * @remark The requests driven by the event loop
+     * (#Azure::Core::Http::CurlTransportOptions::EnableCurlMultiEventLoop) don't use this buffer.
+     */
+    size_t ReadBufferSize = _detail::DefaultReadBufferSize;
+
+    /**
+     * @brief If set, the read buffer of a request grows up to the response `Content-Length`,
+     * bounded by 1 MB, when the response body is larger than
+     * #Azure::Core::Http::CurlTransportOptions::ReadBufferSize.
+     *
+     * @details This takes fewer reads from the network for large downloads read in small pieces,
+     * or read with #Azure::Core::IO::BodyStream::ReadView, while small responses keep a small
+     * buffer.
+     */
+    bool EnableAdaptiveReadBuffer = false;
+
+    /**
+     * @brief If set, requests are driven by a process-wide libcurl multi handle event loop instead
+     * of blocking the calling thread on the socket of each request.
+     *
+     * @details A single background thread drives the network I/O for all the requests sent with
+     * this option (using epoll on Linux). The thread calling
+     * #Azure::Core::Http::CurlTransport::Send only waits until the response headers are received.
+     * The response body is buffered by the event loop up to a bounded size and handed to the
+     * response body stream as it is read.
+     *
+     * @details With this option, #Azure::Core::Http::CurlTransport::SendAsync doesn't wait for the
+     * network.
+     *
+     * @details The first chunk of the request body is read on the calling thread, and the next ones
+     * on background threads, so a request body stream which blocks doesn't hold back the event
+     * loop.
+     *
+     * @remark The connections are cached and re-used by the event loop itself, so the connection
+     * pool used by the default mode is not involved.
+     *
+     * @remark Certificate revocation list checks are not supported by this mode. When
+     * `SslOptions.EnableCertificateRevocationListCheck` is set, the default mode is used instead.
+     *
+     * @warning Requires libcurl >= 7.68.0. The default mode is used with older versions.
+     */
+    bool EnableCurlMultiEventLoop = false;
+
+    /**
+     * @brief The maximum number of idle connections kept in the connection pool for each host.
+     *
+     * @details Connections are re-used from the most recently used one, which is the most likely to
+     * be alive. When this number is reached, the least recently used connection is closed.
+     *
+     * @remark Connections are pooled by host and connection options. The pool settings of the last
+     * transport asking for a connection to a host apply to that host.
+     */
+    size_t MaxIdleConnectionsPerHost = _detail::DefaultMaxIdleConnectionsPerHost;
+
+    /**
+     * @brief The maximum number of connections open at the same time to each host, including the
+     * idle ones. `0` means there is no limit, which is the default.
+     *
+     * @details When this number is reached, sending a request waits for a connection to the same
+     * host to be released, or for the request to be cancelled.
+     *
+     * @remark Connections are pooled by host and connection options. The pool settings of the last
+     * transport asking for a connection to a host apply to that host.
+     */
+    size_t MaxConnectionsPerHost = 0;
+
+    /**
+     * @brief If set, the connection pool updates these counters for the hosts this transport sends
+     * requests to.
+     *
+     * @remark The same counters can be shared by several transports.
+     *
+     * @remark The connection pool is not used by the requests driven by the event loop
+     * (#Azure::Core::Http::CurlTransportOptions::EnableCurlMultiEventLoop).
+     */
+    std::shared_ptr<CurlConnectionPoolMetrics> ConnectionPoolMetrics;
   };
 
   /**
@@ -250,6 +411,53 @@ namespace Azure { namespace Core { namespace Http {
      * @return unique ptr to an HTTP RawResponse.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Implements interface to send an HTTP Request without blocking the calling thread
+     * until the response is received.
+     *
+     * @remark Only the requests driven by the event loop
+     * (#Azure::Core::Http::CurlTransportOptions::EnableCurlMultiEventLoop) are sent
+     * asynchronously, and \p callback runs on the event loop thread. Otherwise, the request is sent
+     * on the calling thread.
+     *
+     * @param request an HTTP Request to be send.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the HTTP RawResponse, or with the error.
+     */
+    void SendAsync(Request& request, Context const& context, SendAsyncCallback callback) override;
+
+    /**
+     * @brief Opens connections to \p endpoints in the background and adds them to the connection
+     * pool, so the first requests sent to these hosts don't wait for the name resolution and the
+     * TCP and TLS handshakes.
+     *
+     * @details The connections are opened in parallel. Only the connections missing for the pool to
+     * have \p connectionsPerEndpoint idle connections to each endpoint are opened, within the
+     * #Azure::Core::Http::CurlTransportOptions::MaxIdleConnectionsPerHost and
+     * #Azure::Core::Http::CurlTransportOptions::MaxConnectionsPerHost limits.
+     *
+     * @remark The connections are opened with the options of this transport, and are re-used by
+     * the requests sent with the same connection options. Idle connections are closed after 60
+     * seconds.
+     *
+     * @remark The requests driven by the event loop
+     * (#Azure::Core::Http::CurlTransportOptions::EnableCurlMultiEventLoop) don't use the connection
+     * pool, so no connection is opened for them.
+     *
+     * @param endpoints The URLs of the hosts to connect to. Only their scheme, host and port are
+     * used.
+     * @param connectionsPerEndpoint The number of idle connections to have for each endpoint.
+     * @param context A context to cancel opening the connections which are not opened yet. Opening
+     * them is also cancelled when the process exits.
+     *
+     * @return A future which is ready once every connection is either opened or failed to open.
+     * The failures are logged, not reported through the future.
+     */
+    std::future<void> PrewarmConnections(
+        std::vector<Azure::Core::Url> const& endpoints,
+        size_t connectionsPerEndpoint = 1,
+        Context const& context = Context{});
   };
 
 }}} // namespace Azure::Core::Http
@@ -277,6 +277,31 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         NextHttpPolicy nextPolicy,
         Context const& context) const = 0;
 
+    /**
+     * @brief Applies this HTTP policy without blocking the calling thread until the response is
+     * received.
+     *
+     * @details Policies overriding this function invoke
+     * #Azure::Core::Http::Policies::NextHttpPolicy::SendAsync, and handle the response or the
+     * error from the callback they pass to it. The last policy hands the request to
+     * #Azure::Core::Http::HttpTransport::SendAsync.
+     *
+     * @remark The default implementation calls #Send on the calling thread, so the policies next in
+     * the stack run synchronously, and invokes \p callback before returning.
+     *
+     * @param request An HTTP request being sent. It must remain valid until \p callback is invoked.
+     * @param nextPolicy The next HTTP to invoke after this policy has been applied.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the HTTP response, after this policy and all subsequent
+     * HTTP policies in the stack sequence of policies have been applied, or with the error. Errors
+     * are never thrown by this function.
+     */
+    virtual void SendAsync(
+        Request& request,
+        NextHttpPolicy nextPolicy,
+        Context const& context,
+        SendAsyncCallback callback) const;
+
     /**
      * @brief Destructs `%HttpPolicy`.
      *
@@ -356,6 +381,17 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      * sequence of policies have been applied.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context);
+
+    /**
+     * @brief Applies this HTTP policy without blocking the calling thread until the response is
+     * received.
+     *
+     * @param request An HTTP request being sent. It must remain valid until \p callback is invoked.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the HTTP response, after this policy and all subsequent
+     * HTTP policies in the stack sequence of policies have been applied, or with the error.
+     */
+    void SendAsync(Request& request, Context const& context, SendAsyncCallback callback);
   };
 
   namespace _internal {
@@ -385,6 +421,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override;
     };
 
     /**
@@ -416,6 +458,17 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy nextPolicy,
           Context const& context) const final;
 
+      /**
+       * @copydoc HttpPolicy::SendAsync
+       *
+       * @remark The delay between the attempts doesn't block any thread.
+       */
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const final;
+
       /**
        * @brief Get the Retry Count from the context.
        *
@@ -479,6 +532,21 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
 
         return nextPolicy.Send(request, context);
       }
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override
+      {
+        if (!request.GetHeader(RequestIdHeader).HasValue())
+        {
+          auto const uuid = Uuid::CreateUuid().ToString();
+          request.SetHeader(RequestIdHeader, uuid);
+        }
+
+        nextPolicy.SendAsync(request, context, std::move(callback));
+      }
     };
 
     /**
@@ -518,6 +586,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override;
     };
 
     /**
@@ -566,6 +640,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override;
     };
 
     /**
@@ -581,6 +661,7 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
       mutable std::shared_timed_mutex m_accessTokenMutex;
       mutable Credentials::TokenRequestContext m_accessTokenContext;
       mutable std::atomic<bool> m_invalidateToken = {false};
+      bool m_authorizeRequestAsync = false;
 
     public:
       /**
@@ -608,6 +689,30 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
 
+      /**
+       * @copydoc HttpPolicy::SendAsync
+       *
+       * @remark The request is authorized with #AuthorizeRequest on the calling thread when the
+       * cached token can be used. Getting a new token, and handling an authorization challenge,
+       * run on a background thread.
+       *
+       * @remark A derived policy may authorize its requests in #AuthorizeAndSendRequest, which
+       * sends them synchronously. Unless it calls #EnableAsyncAuthorization, #Send runs on a
+       * background thread for it instead.
+       */
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override;
+
+    private:
+      void SendAuthorizedAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const;
+
     protected:
       BearerTokenAuthenticationPolicy(BearerTokenAuthenticationPolicy const& other)
           : BearerTokenAuthenticationPolicy(other.m_credential, other.m_tokenRequestContext)
@@ -616,15 +721,37 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         m_accessToken = other.m_accessToken;
         m_accessTokenContext = other.m_accessTokenContext;
         m_invalidateToken.store(other.m_invalidateToken.load());
+        m_authorizeRequestAsync = other.m_authorizeRequestAsync;
       }
 
       void operator=(BearerTokenAuthenticationPolicy const&) = delete;
 
+      /**
+       * @brief Lets #SendAsync authorize the requests of a derived policy with #AuthorizeRequest,
+       * without blocking the calling thread.
+       *
+       * @remark A derived policy calls this from its constructor when it overrides
+       * #AuthorizeRequest, and not #AuthorizeAndSendRequest.
+       */
+      void EnableAsyncAuthorization() { m_authorizeRequestAsync = true; }
+
       virtual std::unique_ptr<RawResponse> AuthorizeAndSendRequest(
           Request& request,
           NextHttpPolicy& nextPolicy,
           Context const& context) const;
 
+      /**
+       * @brief Sets the authorization header of \p request, before it is sent for the first time.
+       *
+       * @remark The default implementation uses the token request context the policy was
+       * constructed with. #AuthorizeAndSendRequest calls this function, so derived policies
+       * overriding it apply to both #Send and #SendAsync.
+       *
+       * @param request The HTTP request to authorize.
+       * @param context A context to control the request lifetime.
+       */
+      virtual void AuthorizeRequest(Request& request, Context const& context) const;
+
       virtual bool AuthorizeRequestOnChallenge(
           std::string const& challenge,
           Request& request,
@@ -666,6 +793,12 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Request& request,
           NextHttpPolicy nextPolicy,
           Context const& context) const override;
+
+      void SendAsync(
+          Request& request,
+          NextHttpPolicy nextPolicy,
+          Context const& context,
+          SendAsyncCallback callback) const override;
     };
   } // namespace _internal
 }}}} // namespace Azure::Core::Http::Policies
@@ -13,6 +13,8 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/raw_response.hpp"
 
+#include <exception>
+#include <functional>
 #include <memory>
 
 namespace Azure { namespace Core { namespace Http {
@@ -26,6 +28,19 @@ namespace Azure { namespace Core { namespace Http {
     AZ_CORE_DLLEXPORT extern const Context::Key HttpConnectionTimeout;
   } // namespace _internal
 
+  /**
+   * @brief Invoked once when an asynchronous send completes.
+   *
+   * @details On success, the first argument is the HTTP response and the second one is null. On
+   * failure, the first argument is null and the second one holds the error that would have been
+   * thrown by the synchronous send.
+   *
+   * @remark The callback might run on a thread owned by the HTTP transport, so it must not block.
+   * In particular, it must not read a response body stream.
+   */
+  using SendAsyncCallback
+      = std::function<void(std::unique_ptr<RawResponse> response, std::exception_ptr error)>;
+
   /**
    * @brief Base class for all HTTP transport implementations.
    */
@@ -44,6 +59,26 @@ namespace Azure { namespace Core { namespace Http {
     // TODO - Should this be const
     virtual std::unique_ptr<RawResponse> Send(Request& request, Context const& context) = 0;
 
+    /**
+     * @brief Send an HTTP request over the wire without blocking the calling thread until the
+     * response is received.
+     *
+     * @details When `request.ShouldBufferResponse()` is `true`, or when the response has an error
+     * status code, transports supporting asynchronous sends download the whole response body to
+     * the response's buffer before invoking \p callback.
+     *
+     * @remark The default implementation calls #Send on the calling thread, and invokes \p
+     * callback before returning.
+     *
+     * @remark \p request, and its body stream, must remain valid until \p callback is invoked.
+     *
+     * @param request An #Azure::Core::Http::Request to send.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the response or the error. Errors are never thrown by this
+     * function.
+     */
+    virtual void SendAsync(Request& request, Context const& context, SendAsyncCallback callback);
+
     /**
      * @brief Destructs `%HttpTransport`.
      *
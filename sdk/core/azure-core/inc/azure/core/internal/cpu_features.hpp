@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Detection of the x86-64 instruction set extensions used by the SDK.
+ */
+
+#pragma once
+
+namespace Azure { namespace Core { namespace _internal {
+  /**
+   * @brief Detects at runtime the x86-64 instruction set extensions used by the SDK.
+   *
+   * @remark The CPU is queried once, on first use. All the extensions are reported as unsupported
+   * on other architectures.
+   */
+  class CpuFeatures final {
+  private:
+    CpuFeatures() = delete;
+    ~CpuFeatures() = delete;
+
+  public:
+    /** @brief Returns true if the CPU supports SSSE3. */
+    static bool HasSsse3();
+
+    /** @brief Returns true if the CPU supports SSE4.1. */
+    static bool HasSse41();
+
+    /** @brief Returns true if the CPU supports PCLMULQDQ. */
+    static bool HasPclmulqdq();
+
+    /** @brief Returns true if the CPU supports AVX2 and the OS saves the YMM registers. */
+    static bool HasAvx2();
+
+    /**
+     * @brief Returns true if the CPU supports AVX-512F and the OS saves the AVX-512 registers.
+     */
+    static bool HasAvx512f();
+
+    /** @brief Returns true if the CPU supports VPCLMULQDQ. */
+    static bool HasVpclmulqdq();
+  };
+}}} // namespace Azure::Core::_internal
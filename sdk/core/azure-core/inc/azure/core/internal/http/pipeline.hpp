@@ -16,6 +16,8 @@
 #include "azure/core/internal/client_options.hpp"
 #include "azure/core/internal/http/http_sanitizer.hpp"
 
+#include <exception>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -230,5 +232,70 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
       return m_policies[0]->Send(
           request, Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies), context);
     }
+
+    /**
+     * @brief Start the HTTP pipeline without blocking the calling thread until the response is
+     * received.
+     *
+     * @details The request flows through the policies which support asynchronous sends (such as
+     * the retry, logging, and transport policies) without a thread waiting for it. The policies
+     * which don't, run synchronously on the thread that reaches them.
+     *
+     * @remark This pipeline, \p request and its body stream must remain valid until \p callback
+     * is invoked.
+     *
+     * @param request The HTTP request to be processed.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the HTTP response after the request has been processed, or
+     * with the error. It might run on a thread owned by the HTTP transport, so it must not block.
+     */
+    void SendAsync(
+        Azure::Core::Http::Request& request,
+        Context const& context,
+        Azure::Core::Http::SendAsyncCallback callback) const
+    {
+      m_policies[0]->SendAsync(
+          request,
+          Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies),
+          context,
+          std::move(callback));
+    }
+
+    /**
+     * @brief Start the HTTP pipeline without blocking the calling thread until the response is
+     * received.
+     *
+     * @remark This pipeline, \p request and its body stream must remain valid until the returned
+     * future is ready.
+     *
+     * @param request The HTTP request to be processed.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future for the HTTP response after the request has been processed. It holds the
+     * error if the request failed.
+     */
+    std::future<std::unique_ptr<Azure::Core::Http::RawResponse>> SendAsync(
+        Azure::Core::Http::Request& request,
+        Context const& context) const
+    {
+      auto promise
+          = std::make_shared<std::promise<std::unique_ptr<Azure::Core::Http::RawResponse>>>();
+      auto future = promise->get_future();
+      SendAsync(
+          request,
+          context,
+          [promise](
+              std::unique_ptr<Azure::Core::Http::RawResponse> response, std::exception_ptr error) {
+            if (error)
+            {
+              promise->set_exception(error);
+            }
+            else
+            {
+              promise->set_value(std::move(response));
+            }
+          });
+      return future;
+    }
   };
 }}}} // namespace Azure::Core::Http::_internal
@@ -26,11 +26,39 @@
 
 namespace Azure { namespace Core { namespace IO {
 
+  /**
+   * @brief Bytes borrowed from the buffer of a #Azure::Core::IO::BodyStream, returned by
+   * #Azure::Core::IO::BodyStream::ReadView.
+   *
+   * @remark The bytes are owned by the stream. They stay valid until the next call to the stream,
+   * or until the stream is destroyed.
+   */
+  struct BodyStreamView final
+  {
+    /**
+     * @brief Pointer to the first byte.
+     *
+     */
+    uint8_t const* Data = nullptr;
+
+    /**
+     * @brief Number of bytes. `0` means the end of the stream was reached.
+     *
+     */
+    size_t Size = 0;
+  };
+
   /**
    * @brief Used to read data to/from a service.
    */
   class BodyStream {
   private:
+    /**
+     * @brief Buffer used by the default `OnReadView` implementation.
+     *
+     */
+    std::vector<uint8_t> m_viewBuffer;
+
     /**
      * @brief Read portion of data into a buffer.
      *
@@ -44,6 +72,19 @@ namespace Azure { namespace Core { namespace IO {
      */
     virtual size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) = 0;
 
+    /**
+     * @brief Read portion of data without copying it to a buffer owned by the caller.
+     *
+     * @remark The default implementation reads the data into a buffer owned by the stream. Derived
+     * classes which already hold the data in memory override it to hand out their own buffer.
+     *
+     * @param count Maximum number of bytes to read.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The bytes read.
+     */
+    virtual BodyStreamView OnReadView(size_t count, Azure::Core::Context const& context);
+
   public:
     /**
      * @brief Destructs `%BodyStream`.
@@ -91,6 +132,29 @@ namespace Azure { namespace Core { namespace IO {
       return OnRead(buffer, count, context);
     }
 
+    /**
+     * @brief Read portion of data, borrowing the buffer of the stream instead of copying the data
+     * to a buffer owned by the caller.
+     * @remark Throws if error/cancelled.
+     *
+     * @param count Maximum number of bytes to read.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The bytes read, which stay valid until the next call to the stream. Like #Read, it
+     * can return less than \p count bytes before the end of the stream.
+     */
+    BodyStreamView ReadView(
+        size_t count,
+        Azure::Core::Context const& context = Azure::Core::Context())
+    {
+      context.ThrowIfCancelled();
+      if (count == 0)
+      {
+        return BodyStreamView{};
+      }
+      return OnReadView(count, context);
+    }
+
     /**
      * @brief Read #Azure::Core::IO::BodyStream into a buffer until the buffer is filled, or until
      * the stream is read to end.
@@ -127,6 +191,7 @@ namespace Azure { namespace Core { namespace IO {
     size_t m_offset = 0;
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+    BodyStreamView OnReadView(size_t count, Azure::Core::Context const& context) override;
 
   public:
     // Forbid constructor for rval so we don't end up storing dangling ptr
@@ -296,6 +361,7 @@ namespace Azure { namespace Core { namespace IO {
 
   private:
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+    BodyStreamView OnReadView(size_t count, Azure::Core::Context const& context) override;
 
   public:
     /**
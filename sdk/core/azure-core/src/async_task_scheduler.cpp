@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/async_task_scheduler.hpp"
+
+#include "azure/core/context.hpp"
+#include "azure/core/internal/diagnostics/log.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+
+using Azure::Core::Diagnostics::Logger;
+using Azure::Core::Diagnostics::_internal::Log;
+using Azure::Core::_detail::AsyncTaskScheduler;
+
+namespace {
+// The tasks may block on I/O, so there are more threads than cores.
+size_t GetMaxThreads()
+{
+  return (std::max)(size_t{8}, size_t{2} * std::thread::hardware_concurrency());
+}
+
+void RunTask(AsyncTaskScheduler::TaskFunction& task, std::exception_ptr error)
+{
+  try
+  {
+    task(std::move(error));
+  }
+  catch (std::exception const& e)
+  {
+    Log::Write(Logger::Level::Error, std::string("Unhandled error in async task: ") + e.what());
+  }
+  catch (...)
+  {
+    Log::Write(Logger::Level::Error, "Unhandled error in async task.");
+  }
+}
+
+std::exception_ptr GetStoppedError()
+{
+  return std::make_exception_ptr(Azure::Core::OperationCancelledException(
+      "The task was not run, the asynchronous task scheduler is stopped."));
+}
+} // namespace
+
+size_t const AsyncTaskScheduler::MaxThreads = GetMaxThreads();
+
+AsyncTaskScheduler& AsyncTaskScheduler::GetInstance()
+{
+  // Since C++11: If multiple threads attempt to initialize the same static local variable
+  // concurrently, the initialization occurs exactly once.
+  static AsyncTaskScheduler instance;
+  return instance;
+}
+
+AsyncTaskScheduler::~AsyncTaskScheduler()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_tasksChanged.notify_all();
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+
+  // The pending tasks are told that they won't run, so that their callers are not left waiting.
+  while (!m_tasks.empty())
+  {
+    auto task = std::move(const_cast<ScheduledTask&>(m_tasks.top()).Task);
+    m_tasks.pop();
+    RunTask(task, GetStoppedError());
+  }
+}
+
+void AsyncTaskScheduler::Schedule(std::chrono::milliseconds delay, TaskFunction task)
+{
+  auto& scheduler = GetInstance();
+  bool stopped = false;
+  {
+    std::lock_guard<std::mutex> lock(scheduler.m_mutex);
+    stopped = scheduler.m_stop;
+    if (!stopped)
+    {
+      scheduler.m_tasks.push(ScheduledTask{
+          std::chrono::steady_clock::now() + delay, scheduler.m_nextSequence++, std::move(task)});
+      scheduler.StartThreadIfNeeded();
+    }
+  }
+  if (stopped)
+  {
+    RunTask(task, GetStoppedError());
+    return;
+  }
+  scheduler.m_tasksChanged.notify_one();
+}
+
+void AsyncTaskScheduler::StartThreadIfNeeded()
+{
+  // The threads are started on demand, and kept until the process exits.
+  if (m_busyThreads == m_threads.size() && m_threads.size() < MaxThreads)
+  {
+    m_threads.emplace_back([this]() { Run(); });
+  }
+}
+
+void AsyncTaskScheduler::Run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop)
+  {
+    if (m_tasks.empty())
+    {
+      m_tasksChanged.wait(lock);
+      continue;
+    }
+
+    auto const deadline = m_tasks.top().Deadline;
+    if (std::chrono::steady_clock::now() < deadline)
+    {
+      m_tasksChanged.wait_until(lock, deadline);
+      continue;
+    }
+
+    {
+      // priority_queue::top() is const, the task is moved out before popping it.
+      auto task = std::move(const_cast<ScheduledTask&>(m_tasks.top()).Task);
+      m_tasks.pop();
+      ++m_busyThreads;
+      // Another thread waits for the next task while this one runs, which may block.
+      StartThreadIfNeeded();
+
+      // The task, and whatever it captures, is destroyed before taking the lock back.
+      lock.unlock();
+      RunTask(task, nullptr);
+    }
+    lock.lock();
+    --m_busyThreads;
+  }
+}
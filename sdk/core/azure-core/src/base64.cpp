@@ -3,9 +3,29 @@
 
 #include "azure/core/base64.hpp"
 
+#include "azure/core/internal/cpu_features.hpp"
+#include "private/base64.hpp"
+
 #include <string>
 #include <vector>
 
+#if defined(_M_X64) || defined(__x86_64__)
+#define _azure_BASE64_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// NEON is part of the AArch64 baseline.
+#define _azure_BASE64_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_azure_BASE64_X86) && (defined(__GNUC__) || defined(__clang__))
+#define _azure_BASE64_SSE41_TARGET __attribute__((target("ssse3,sse4.1")))
+#define _azure_BASE64_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define _azure_BASE64_SSE41_TARGET
+#define _azure_BASE64_AVX2_TARGET
+#endif
+
 namespace {
 
 char const Base64EncodeArray[65]
@@ -271,7 +291,90 @@ int8_t const Base64DecodeArray[256] = {
     -1,
 };
 
-int32_t Base64Encode(const uint8_t* threeBytes)
+#if defined(_azure_BASE64_X86) || defined(_azure_BASE64_NEON)
+// The vector decoders validate each character by looking up its low and high nibbles: the two
+// entries share a bit only when the character is not in the Base64 alphabet.
+uint8_t const Base64DecodeLowNibbleTable[16] = {
+    0x15,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x11,
+    0x13,
+    0x1A,
+    0x1B,
+    0x1B,
+    0x1B,
+    0x1A,
+};
+uint8_t const Base64DecodeHighNibbleTable[16] = {
+    0x10,
+    0x10,
+    0x01,
+    0x02,
+    0x04,
+    0x08,
+    0x04,
+    0x08,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+};
+// What to add to a valid character to get its 6-bit value, indexed by its high nibble, and by 1 for
+// '/' which shares the high nibble of '+'.
+int8_t const Base64DecodeShiftTable[16] = {
+    0,
+    63 - '/',
+    62 - '+',
+    52 - '0',
+    0 - 'A',
+    0 - 'A',
+    26 - 'a',
+    26 - 'a',
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+};
+#endif
+
+#if defined(_azure_BASE64_X86)
+// What to add to a 6-bit value to get its character, indexed by Base64EncodeOffsetIndex.
+int8_t const Base64EncodeShiftTable[16] = {
+    'a' - 26,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '0' - 52,
+    '+' - 62,
+    '/' - 63,
+    'A',
+    0,
+    0,
+};
+#endif
+
+int32_t Base64EncodeThreeBytes(const uint8_t* threeBytes)
 {
   int32_t i = (threeBytes[0] << 16) | (threeBytes[1] << 8) | threeBytes[2];
 
@@ -312,19 +415,15 @@ void Base64WriteIntAsFourBytes(char* destination, int32_t value)
   destination[0] = static_cast<uint8_t>(value & 0xFF);
 }
 
-std::string Base64Encode(uint8_t const* const data, size_t length)
+size_t Base64EncodeScalar(uint8_t const* const data, size_t length, char* destination)
 {
   size_t sourceIndex = 0;
   auto inputSize = length;
-  auto maxEncodedSize = ((inputSize + 2) / 3) * 4;
-  // Use a string with size to the max possible result
-  std::string encodedResult(maxEncodedSize, '0');
-  // Removing const from the string to update the placeholder string
-  auto destination = const_cast<char*>(encodedResult.data());
+  auto const start = destination;
 
   while (sourceIndex + 3 <= inputSize)
   {
-    int32_t result = Base64Encode(&data[sourceIndex]);
+    int32_t result = Base64EncodeThreeBytes(&data[sourceIndex]);
     Base64WriteIntAsFourBytes(destination, result);
     destination += 4;
     sourceIndex += 3;
@@ -334,27 +433,24 @@ std::string Base64Encode(uint8_t const* const data, size_t length)
   {
     int32_t result = Base64EncodeAndPadTwo(&data[sourceIndex]);
     Base64WriteIntAsFourBytes(destination, result);
+    destination += 4;
   }
   else if (sourceIndex + 2 == inputSize)
   {
     int32_t result = Base64EncodeAndPadOne(&data[sourceIndex]);
     Base64WriteIntAsFourBytes(destination, result);
+    destination += 4;
   }
 
-  return encodedResult;
+  return static_cast<size_t>(destination - start);
 }
 
-int32_t Base64Decode(const char* encodedBytes)
+int32_t Base64DecodeFourBytes(const char* encodedBytes)
 {
-  int32_t i0 = encodedBytes[0];
-  int32_t i1 = encodedBytes[1];
-  int32_t i2 = encodedBytes[2];
-  int32_t i3 = encodedBytes[3];
-
-  i0 = Base64DecodeArray[i0];
-  i1 = Base64DecodeArray[i1];
-  i2 = Base64DecodeArray[i2];
-  i3 = Base64DecodeArray[i3];
+  int32_t i0 = Base64DecodeArray[static_cast<uint8_t>(encodedBytes[0])];
+  int32_t i1 = Base64DecodeArray[static_cast<uint8_t>(encodedBytes[1])];
+  int32_t i2 = Base64DecodeArray[static_cast<uint8_t>(encodedBytes[2])];
+  int32_t i3 = Base64DecodeArray[static_cast<uint8_t>(encodedBytes[3])];
 
   i0 <<= 18;
   i1 <<= 12;
@@ -367,61 +463,35 @@ int32_t Base64Decode(const char* encodedBytes)
   return i0;
 }
 
-void Base64WriteThreeLowOrderBytes(std::vector<uint8_t>::iterator destination, int64_t value)
+void Base64WriteThreeLowOrderBytes(uint8_t* destination, int64_t value)
 {
   destination[0] = static_cast<uint8_t>(value >> 16);
   destination[1] = static_cast<uint8_t>(value >> 8);
   destination[2] = static_cast<uint8_t>(value);
 }
 
-std::vector<uint8_t> Base64Decode(const std::string& text)
+// Decodes groups of four characters without padding.
+void Base64DecodeScalar(const char* text, size_t length, uint8_t* destination)
 {
-  auto inputSize = text.size();
-  if (inputSize % 4 != 0)
-  {
-    throw std::runtime_error("Unexpected end of Base64 encoded string.");
-  }
-
-  // An empty input should result in an empty output.
-  if (inputSize == 0)
-  {
-    return std::vector<uint8_t>();
-  }
-
-  size_t sourceIndex = 0;
-  auto inputPtr = text.data();
-  auto decodedSize = (inputSize / 4) * 3;
-
-  if (inputPtr[inputSize - 2] == EncodingPad)
+  for (size_t sourceIndex = 0; sourceIndex < length; sourceIndex += 4)
   {
-    decodedSize -= 2;
-  }
-  else if (inputPtr[inputSize - 1] == EncodingPad)
-  {
-    decodedSize -= 1;
-  }
-
-  std::vector<uint8_t> destination(decodedSize);
-  auto destinationPtr = destination.begin();
-
-  while (sourceIndex + 4 < inputSize)
-  {
-    int64_t result = Base64Decode(inputPtr + sourceIndex);
+    int64_t result = Base64DecodeFourBytes(text + sourceIndex);
     if (result < 0)
     {
       throw std::runtime_error("Unexpected character in Base64 encoded string");
     }
-    Base64WriteThreeLowOrderBytes(destinationPtr, result);
-    destinationPtr += 3;
-    sourceIndex += 4;
+    Base64WriteThreeLowOrderBytes(destination, result);
+    destination += 3;
   }
+}
 
-  // We are guaranteed to have an input with at least 4 bytes at this point, with a size that is a
-  // multiple of 4.
-  int64_t i0 = inputPtr[inputSize - 4];
-  int64_t i1 = inputPtr[inputSize - 3];
-  int64_t i2 = inputPtr[inputSize - 2];
-  int64_t i3 = inputPtr[inputSize - 1];
+// Decodes the last four characters, which can be padded.
+size_t Base64DecodeLastFourBytes(const char* text, uint8_t* destinationPtr)
+{
+  int64_t i0 = static_cast<uint8_t>(text[0]);
+  int64_t i1 = static_cast<uint8_t>(text[1]);
+  int64_t i2 = static_cast<uint8_t>(text[2]);
+  int64_t i3 = static_cast<uint8_t>(text[3]);
 
   i0 = Base64DecodeArray[i0];
   i1 = Base64DecodeArray[i1];
@@ -447,6 +517,7 @@ std::vector<uint8_t> Base64Decode(const std::string& text)
     }
 
     Base64WriteThreeLowOrderBytes(destinationPtr, i0);
+    return 3;
   }
   else if (i2 != EncodingPad)
   {
@@ -462,6 +533,7 @@ std::vector<uint8_t> Base64Decode(const std::string& text)
 
     destinationPtr[1] = static_cast<uint8_t>(i0 >> 8);
     destinationPtr[0] = static_cast<uint8_t>(i0 >> 16);
+    return 2;
   }
   else
   {
@@ -471,29 +543,434 @@ std::vector<uint8_t> Base64Decode(const std::string& text)
     }
 
     destinationPtr[0] = static_cast<uint8_t>(i0 >> 16);
+    return 1;
   }
+}
 
-  return destination;
+// The vector kernels process as many whole blocks as they can, and return the number of bytes or
+// characters they consumed. The scalar code handles the rest, and reports the invalid characters.
+#if defined(_azure_BASE64_X86)
+// Encodes 12 bytes into 16 characters per iteration.
+_azure_BASE64_SSE41_TARGET size_t
+Base64EncodeSse41(uint8_t const* data, size_t length, char* destination)
+{
+  // Each 32-bit lane gets 3 input bytes, ordered so that each 16-bit half holds two 6-bit groups.
+  const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i shiftTable
+      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64EncodeShiftTable));
+
+  size_t i = 0;
+  for (; length - i >= 16; i += 12)
+  {
+    const __m128i in = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), spread);
+    // Moves each 6-bit group to the low bits of its own byte.
+    const __m128i high = _mm_mulhi_epu16(
+        _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    const __m128i low = _mm_mullo_epi16(
+        _mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(high, low);
+
+    // 0-25 map to 13, 26-51 to 0, 52-61 to 1-10, 62 to 11 and 63 to 12.
+    __m128i offsetIndices = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    offsetIndices = _mm_or_si128(
+        offsetIndices,
+        _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + i / 3 * 4),
+        _mm_add_epi8(indices, _mm_shuffle_epi8(shiftTable, offsetIndices)));
+  }
+  return i;
 }
 
+// Decodes 16 characters into 12 bytes per iteration, and writes 16 bytes.
+_azure_BASE64_SSE41_TARGET size_t Base64DecodeSse41(
+    char const* text,
+    size_t length,
+    uint8_t* destination,
+    size_t destinationSize)
+{
+  const __m128i lowNibbleTable
+      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeLowNibbleTable));
+  const __m128i highNibbleTable
+      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeHighNibbleTable));
+  const __m128i shiftTable
+      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeShiftTable));
+  const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  size_t i = 0;
+  size_t o = 0;
+  for (; length - i >= 16 && destinationSize - o >= 16; i += 16, o += 12)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text + i));
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+    const __m128i lowNibbles = _mm_and_si128(in, nibbleMask);
+    if (!_mm_testz_si128(
+            _mm_shuffle_epi8(lowNibbleTable, lowNibbles),
+            _mm_shuffle_epi8(highNibbleTable, highNibbles)))
+    {
+      break;
+    }
+    const __m128i shift = _mm_shuffle_epi8(
+        shiftTable, _mm_add_epi8(highNibbles, _mm_cmpeq_epi8(in, _mm_set1_epi8('/'))));
+    const __m128i values = _mm_add_epi8(in, shift);
+
+    // Merges the four 6-bit values of each 32-bit lane into 24 bits, then packs the lanes.
+    const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i triples = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + o), _mm_shuffle_epi8(triples, pack));
+  }
+  return i;
+}
+
+// Encodes 24 bytes into 32 characters per iteration.
+_azure_BASE64_AVX2_TARGET size_t
+Base64EncodeAvx2(uint8_t const* data, size_t length, char* destination)
+{
+  const __m256i spread = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const __m256i shiftTable = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64EncodeShiftTable)));
+
+  size_t i = 0;
+  for (; length - i >= 28; i += 24)
+  {
+    const __m256i in = _mm256_shuffle_epi8(
+        _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i))),
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i + 12)),
+            1),
+        spread);
+    const __m256i high = _mm256_mulhi_epu16(
+        _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    const __m256i low = _mm256_mullo_epi16(
+        _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(high, low);
+
+    __m256i offsetIndices = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    offsetIndices = _mm256_or_si256(
+        offsetIndices,
+        _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + i / 3 * 4),
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(shiftTable, offsetIndices)));
+  }
+  return i;
+}
+
+// Decodes 32 characters into 24 bytes per iteration, and writes 32 bytes.
+_azure_BASE64_AVX2_TARGET size_t Base64DecodeAvx2(
+    char const* text,
+    size_t length,
+    uint8_t* destination,
+    size_t destinationSize)
+{
+  const __m256i lowNibbleTable = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeLowNibbleTable)));
+  const __m256i highNibbleTable = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeHighNibbleTable)));
+  const __m256i shiftTable = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(Base64DecodeShiftTable)));
+  const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+  const __m256i pack = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  const __m256i packLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+  size_t i = 0;
+  size_t o = 0;
+  for (; length - i >= 32 && destinationSize - o >= 32; i += 32, o += 24)
+  {
+    const __m256i in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(text + i));
+    const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibbleMask);
+    const __m256i lowNibbles = _mm256_and_si256(in, nibbleMask);
+    if (!_mm256_testz_si256(
+            _mm256_shuffle_epi8(lowNibbleTable, lowNibbles),
+            _mm256_shuffle_epi8(highNibbleTable, highNibbles)))
+    {
+      break;
+    }
+    const __m256i shift = _mm256_shuffle_epi8(
+        shiftTable, _mm256_add_epi8(highNibbles, _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'))));
+    const __m256i values = _mm256_add_epi8(in, shift);
+
+    const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i triples = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + o),
+        _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triples, pack), packLanes));
+  }
+  return i;
+}
+
+#elif defined(_azure_BASE64_NEON)
+// Encodes 48 bytes into 64 characters per iteration.
+size_t Base64EncodeNeon(uint8_t const* data, size_t length, char* destination)
+{
+  uint8x16x4_t encodeTable;
+  for (int k = 0; k < 4; ++k)
+  {
+    encodeTable.val[k] = vld1q_u8(reinterpret_cast<uint8_t const*>(Base64EncodeArray) + 16 * k);
+  }
+  const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+  size_t i = 0;
+  for (; length - i >= 48; i += 48)
+  {
+    const uint8x16x3_t in = vld3q_u8(data + i);
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1]
+        = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+    out.val[2]
+        = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+    for (int k = 0; k < 4; ++k)
+    {
+      out.val[k] = vqtbl4q_u8(encodeTable, out.val[k]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t*>(destination + i / 3 * 4), out);
+  }
+  return i;
+}
+
+// Decodes 64 characters into 48 bytes per iteration.
+size_t Base64DecodeNeon(char const* text, size_t length, uint8_t* destination)
+{
+  const uint8x16_t lowNibbleTable = vld1q_u8(Base64DecodeLowNibbleTable);
+  const uint8x16_t highNibbleTable = vld1q_u8(Base64DecodeHighNibbleTable);
+  const uint8x16_t shiftTable = vreinterpretq_u8_s8(vld1q_s8(Base64DecodeShiftTable));
+  const uint8x16_t nibbleMask = vdupq_n_u8(0x0F);
+
+  size_t i = 0;
+  for (; length - i >= 64; i += 64)
+  {
+    const uint8x16x4_t in = vld4q_u8(reinterpret_cast<uint8_t const*>(text + i));
+    uint8x16x4_t values;
+    uint8x16_t invalid = vdupq_n_u8(0);
+    for (int k = 0; k < 4; ++k)
+    {
+      const uint8x16_t highNibbles = vshrq_n_u8(in.val[k], 4);
+      const uint8x16_t lowNibbles = vandq_u8(in.val[k], nibbleMask);
+      invalid = vorrq_u8(
+          invalid,
+          vandq_u8(
+              vqtbl1q_u8(lowNibbleTable, lowNibbles), vqtbl1q_u8(highNibbleTable, highNibbles)));
+      const uint8x16_t shift = vqtbl1q_u8(
+          shiftTable, vaddq_u8(highNibbles, vceqq_u8(in.val[k], vdupq_n_u8('/'))));
+      values.val[k] = vaddq_u8(in.val[k], shift);
+    }
+    if (vmaxvq_u8(invalid) != 0)
+    {
+      break;
+    }
+
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(destination + i / 4 * 3, out);
+  }
+  return i;
+}
+#endif
+
 } // namespace
 
 namespace Azure { namespace Core {
 
+  namespace _detail {
+    bool IsBase64ImplementationSupported(Base64Implementation implementation)
+    {
+      switch (implementation)
+      {
+        case Base64Implementation::Scalar:
+          return true;
+#if defined(_azure_BASE64_X86)
+        case Base64Implementation::Sse41:
+          return _internal::CpuFeatures::HasSsse3() && _internal::CpuFeatures::HasSse41();
+        case Base64Implementation::Avx2:
+          return _internal::CpuFeatures::HasAvx2();
+#elif defined(_azure_BASE64_NEON)
+        case Base64Implementation::Neon:
+          return true;
+#endif
+        default:
+          return false;
+      }
+    }
+
+    Base64Implementation GetBase64Implementation()
+    {
+      // Since C++11: If multiple threads attempt to initialize the same static local variable
+      // concurrently, the initialization occurs exactly once.
+      static const Base64Implementation fastest = []() {
+        for (auto implementation :
+             {Base64Implementation::Avx2, Base64Implementation::Sse41, Base64Implementation::Neon})
+        {
+          if (IsBase64ImplementationSupported(implementation))
+          {
+            return implementation;
+          }
+        }
+        return Base64Implementation::Scalar;
+      }();
+      return fastest;
+    }
+
+    size_t Base64Encode(
+        uint8_t const* data,
+        size_t length,
+        char* destination,
+        Base64Implementation implementation)
+    {
+      size_t sourceIndex = 0;
+#if defined(_azure_BASE64_X86)
+      if (implementation == Base64Implementation::Avx2)
+      {
+        sourceIndex += Base64EncodeAvx2(data, length, destination);
+      }
+      if (implementation == Base64Implementation::Avx2
+          || implementation == Base64Implementation::Sse41)
+      {
+        sourceIndex += Base64EncodeSse41(
+            data + sourceIndex, length - sourceIndex, destination + sourceIndex / 3 * 4);
+      }
+#elif defined(_azure_BASE64_NEON)
+      if (implementation == Base64Implementation::Neon)
+      {
+        sourceIndex += Base64EncodeNeon(data, length, destination);
+      }
+#else
+      static_cast<void>(implementation);
+#endif
+      return sourceIndex / 3 * 4
+          + Base64EncodeScalar(
+                 data + sourceIndex, length - sourceIndex, destination + sourceIndex / 3 * 4);
+    }
+
+    size_t Base64Decode(
+        char const* text,
+        size_t length,
+        uint8_t* destination,
+        Base64Implementation implementation)
+    {
+      if (length == 0)
+      {
+        return 0;
+      }
+
+      // The last four characters can be padded, and are left to the scalar code.
+      const size_t bodyLength = length - 4;
+      const size_t bodySize = bodyLength / 4 * 3;
+      size_t sourceIndex = 0;
+#if defined(_azure_BASE64_X86)
+      if (implementation == Base64Implementation::Avx2)
+      {
+        sourceIndex += Base64DecodeAvx2(text, bodyLength, destination, bodySize);
+      }
+      if (implementation == Base64Implementation::Avx2
+          || implementation == Base64Implementation::Sse41)
+      {
+        sourceIndex += Base64DecodeSse41(
+            text + sourceIndex,
+            bodyLength - sourceIndex,
+            destination + sourceIndex / 4 * 3,
+            bodySize - sourceIndex / 4 * 3);
+      }
+#elif defined(_azure_BASE64_NEON)
+      if (implementation == Base64Implementation::Neon)
+      {
+        sourceIndex += Base64DecodeNeon(text, bodyLength, destination);
+      }
+#else
+      static_cast<void>(implementation);
+#endif
+      Base64DecodeScalar(
+          text + sourceIndex, bodyLength - sourceIndex, destination + sourceIndex / 4 * 3);
+      return bodySize + Base64DecodeLastFourBytes(text + bodyLength, destination + bodySize);
+    }
+  } // namespace _detail
+
+  size_t Convert::GetBase64EncodedSize(size_t length) { return ((length + 2) / 3) * 4; }
+
+  size_t Convert::Base64Encode(
+      uint8_t const* data,
+      size_t length,
+      char* destination,
+      size_t destinationSize)
+  {
+    if (destinationSize < GetBase64EncodedSize(length))
+    {
+      throw std::invalid_argument("The destination is too small for the Base64 encoded data.");
+    }
+    return _detail::Base64Encode(data, length, destination, _detail::GetBase64Implementation());
+  }
+
+  size_t Convert::GetBase64DecodedSize(char const* text, size_t length)
+  {
+    if (length % 4 != 0)
+    {
+      throw std::runtime_error("Unexpected end of Base64 encoded string.");
+    }
+
+    // An empty input should result in an empty output.
+    if (length == 0)
+    {
+      return 0;
+    }
+
+    auto decodedSize = (length / 4) * 3;
+    if (text[length - 2] == EncodingPad)
+    {
+      decodedSize -= 2;
+    }
+    else if (text[length - 1] == EncodingPad)
+    {
+      decodedSize -= 1;
+    }
+    return decodedSize;
+  }
+
+  size_t Convert::Base64Decode(
+      char const* text,
+      size_t length,
+      uint8_t* destination,
+      size_t destinationSize)
+  {
+    if (destinationSize < GetBase64DecodedSize(text, length))
+    {
+      throw std::invalid_argument("The destination is too small for the Base64 decoded data.");
+    }
+    return _detail::Base64Decode(text, length, destination, _detail::GetBase64Implementation());
+  }
+
   std::string Convert::Base64Encode(const std::vector<uint8_t>& data)
   {
-    return ::Base64Encode(data.data(), data.size());
+    return _internal::Convert::Base64Encode(data.data(), data.size());
   }
 
   std::vector<uint8_t> Convert::Base64Decode(const std::string& text)
   {
-    return ::Base64Decode(text);
+    std::vector<uint8_t> decoded(GetBase64DecodedSize(text.data(), text.size()));
+    _detail::Base64Decode(
+        text.data(), text.size(), decoded.data(), _detail::GetBase64Implementation());
+    return decoded;
   }
+
   namespace _internal {
 
     std::string Convert::Base64Encode(const std::string& data)
     {
-      return ::Base64Encode(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+      return Base64Encode(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    }
+
+    std::string Convert::Base64Encode(uint8_t const* data, size_t length)
+    {
+      std::string encoded(Azure::Core::Convert::GetBase64EncodedSize(length), '\0');
+      _detail::Base64Encode(data, length, &encoded[0], _detail::GetBase64Implementation());
+      return encoded;
     }
   } // namespace _internal
 
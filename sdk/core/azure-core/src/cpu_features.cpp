@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/core/internal/cpu_features.hpp"
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define _azure_CPU_FEATURES_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+using Azure::Core::_internal::CpuFeatures;
+
+namespace {
+struct DetectedCpuFeatures final
+{
+  bool Ssse3 = false;
+  bool Sse41 = false;
+  bool Pclmulqdq = false;
+  bool Avx2 = false;
+  bool Avx512f = false;
+  bool Vpclmulqdq = false;
+};
+
+DetectedCpuFeatures DetectCpuFeatures()
+{
+  DetectedCpuFeatures features;
+#if defined(_azure_CPU_FEATURES_X86)
+  unsigned int leaf1[4] = {};
+  unsigned int leaf7[4] = {};
+#if defined(_MSC_VER)
+  __cpuid(reinterpret_cast<int*>(leaf1), 1);
+  __cpuidex(reinterpret_cast<int*>(leaf7), 7, 0);
+#else
+  __get_cpuid(1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+  __get_cpuid_count(7, 0, &leaf7[0], &leaf7[1], &leaf7[2], &leaf7[3]);
+#endif
+  features.Ssse3 = (leaf1[2] & (1U << 9)) != 0;
+  features.Sse41 = (leaf1[2] & (1U << 19)) != 0;
+  features.Pclmulqdq = (leaf1[2] & (1U << 1)) != 0;
+  features.Vpclmulqdq = (leaf7[2] & (1U << 10)) != 0;
+
+  // The registers of the AVX extensions can only be used if the OS saves them.
+  const bool osxsave = (leaf1[2] & (1U << 27)) != 0;
+  if (osxsave)
+  {
+    uint32_t xcr0;
+#if defined(_MSC_VER)
+    xcr0 = static_cast<uint32_t>(_xgetbv(0));
+#else
+    uint32_t xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0High) : "c"(0));
+#endif
+    // XMM and YMM states.
+    features.Avx2 = (leaf7[1] & (1U << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+    // XMM, YMM, opmask and ZMM states.
+    features.Avx512f = (leaf7[1] & (1U << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+  }
+#endif
+  return features;
+}
+
+DetectedCpuFeatures const& GetCpuFeatures()
+{
+  // Since C++11: If multiple threads attempt to initialize the same static local variable
+  // concurrently, the initialization occurs exactly once.
+  static const DetectedCpuFeatures features = DetectCpuFeatures();
+  return features;
+}
+} // namespace
+
+bool CpuFeatures::HasSsse3() { return GetCpuFeatures().Ssse3; }
+
+bool CpuFeatures::HasSse41() { return GetCpuFeatures().Sse41; }
+
+bool CpuFeatures::HasPclmulqdq() { return GetCpuFeatures().Pclmulqdq; }
+
+bool CpuFeatures::HasAvx2() { return GetCpuFeatures().Avx2; }
+
+bool CpuFeatures::HasAvx512f() { return GetCpuFeatures().Avx512f; }
+
+bool CpuFeatures::HasVpclmulqdq() { return GetCpuFeatures().Vpclmulqdq; }
@@ -4,8 +4,14 @@
 #include "azure/core/credentials/credentials.hpp"
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/credentials/authorization_challenge_parser.hpp"
+#include "../private/async_task_scheduler.hpp"
 
 #include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <utility>
 
 using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy;
 
@@ -15,8 +21,22 @@ using Azure::Core::Credentials::TokenRequestContext;
 using Azure::Core::Credentials::_detail::AuthorizationChallengeHelper;
 using Azure::Core::Http::RawResponse;
 using Azure::Core::Http::Request;
+using Azure::Core::Http::SendAsyncCallback;
 using Azure::Core::Http::Policies::NextHttpPolicy;
 
+namespace {
+// Set by SendAsync while it authorizes the request on the calling thread, which must not block on
+// getting a token. AuthenticateAndAuthorizeRequest then sets it to true instead of refreshing the
+// token, and SendAsync authorizes the request again on a scheduler thread.
+thread_local bool* g_tokenRefreshDeferred = nullptr;
+
+class DeferTokenRefreshScope final {
+public:
+  explicit DeferTokenRefreshScope(bool& deferred) { g_tokenRefreshDeferred = &deferred; }
+  ~DeferTokenRefreshScope() { g_tokenRefreshDeferred = nullptr; }
+};
+} // namespace
+
 std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
     Request& request,
     NextHttpPolicy nextPolicy,
@@ -42,15 +62,164 @@ std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
   return result;
 }
 
+void BearerTokenAuthenticationPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  using Azure::Core::_detail::AsyncTaskScheduler;
+
+  if (!m_authorizeRequestAsync && typeid(*this) != typeid(BearerTokenAuthenticationPolicy))
+  {
+    // The derived policy may authorize the request in AuthorizeAndSendRequest, which blocks.
+    AsyncTaskScheduler::Post(
+        [this, &request, nextPolicy, context, callback](std::exception_ptr error) {
+          if (error)
+          {
+            callback(nullptr, error);
+            return;
+          }
+          std::unique_ptr<RawResponse> response;
+          try
+          {
+            response = Send(request, nextPolicy, context);
+          }
+          catch (...)
+          {
+            callback(nullptr, std::current_exception());
+            return;
+          }
+          callback(std::move(response), nullptr);
+        });
+    return;
+  }
+
+  bool tokenRefreshDeferred = false;
+  try
+  {
+    if (request.GetUrl().GetScheme() != "https")
+    {
+      throw AuthenticationException(
+          "Bearer token authentication is not permitted for non TLS protected (https) endpoints.");
+    }
+
+    DeferTokenRefreshScope deferTokenRefresh(tokenRefreshDeferred);
+    AuthorizeRequest(request, context);
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+    return;
+  }
+
+  if (!tokenRefreshDeferred)
+  {
+    SendAuthorizedAsync(request, std::move(nextPolicy), context, std::move(callback));
+    return;
+  }
+
+  // The cached token can't be used, and getting a new one blocks.
+  AsyncTaskScheduler::Post(
+      [this, &request, nextPolicy, context, callback](std::exception_ptr error) mutable {
+        if (error)
+        {
+          callback(nullptr, error);
+          return;
+        }
+        try
+        {
+          AuthorizeRequest(request, context);
+        }
+        catch (...)
+        {
+          callback(nullptr, std::current_exception());
+          return;
+        }
+        SendAuthorizedAsync(request, std::move(nextPolicy), context, std::move(callback));
+      });
+}
+
+void BearerTokenAuthenticationPolicy::SendAuthorizedAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  using Azure::Core::_detail::AsyncTaskScheduler;
+
+  // The pipeline, and therefore this policy, outlives the asynchronous send.
+  nextPolicy.SendAsync(
+      request,
+      context,
+      [this, &request, nextPolicy, context, callback](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (!response)
+        {
+          callback(nullptr, error);
+          return;
+        }
+
+        m_invalidateToken = (response->GetStatusCode() == HttpStatusCode::Unauthorized);
+        std::string challenge = AuthorizationChallengeHelper::GetChallenge(*response);
+        if (challenge.empty())
+        {
+          callback(std::move(response), nullptr);
+          return;
+        }
+
+        // Getting a token for the challenge blocks, so it doesn't run on the thread that completed
+        // the request, which might be owned by the HTTP transport.
+        std::shared_ptr<RawResponse> unauthorized(std::move(response));
+        AsyncTaskScheduler::Post([this,
+                                  &request,
+                                  nextPolicy,
+                                  context,
+                                  callback,
+                                  challenge,
+                                  unauthorized](std::exception_ptr error) mutable {
+          if (error)
+          {
+            callback(nullptr, error);
+            return;
+          }
+          bool authorized = false;
+          try
+          {
+            authorized = AuthorizeRequestOnChallenge(challenge, request, context);
+          }
+          catch (...)
+          {
+            callback(nullptr, std::current_exception());
+            return;
+          }
+
+          if (!authorized)
+          {
+            callback(std::make_unique<RawResponse>(std::move(*unauthorized)), nullptr);
+            return;
+          }
+          unauthorized.reset();
+          nextPolicy.SendAsync(request, context, std::move(callback));
+        });
+      });
+}
+
 std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::AuthorizeAndSendRequest(
     Request& request,
     NextHttpPolicy& nextPolicy,
     Context const& context) const
 {
-  AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
+  AuthorizeRequest(request, context);
   return nextPolicy.Send(request, context);
 }
 
+void BearerTokenAuthenticationPolicy::AuthorizeRequest(Request& request, Context const& context)
+    const
+{
+  AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
+}
+
 bool BearerTokenAuthenticationPolicy::AuthorizeRequestOnChallenge(
     std::string const& challenge,
     Request& request,
@@ -105,6 +274,12 @@ void BearerTokenAuthenticationPolicy::AuthenticateAndAuthorizeRequest(
     }
   }
 
+  if (g_tokenRefreshDeferred != nullptr)
+  {
+    *g_tokenRefreshDeferred = true;
+    return;
+  }
+
   std::unique_lock<std::shared_timed_mutex> writeLock(m_accessTokenMutex);
   // Check if token needs refresh for the second time in case another thread has just updated it.
   if (TokenNeedsRefresh(
@@ -21,8 +21,10 @@
 #include "azure/core/internal/strings.hpp"
 
 // Private include
+#include "../../private/async_task_scheduler.hpp"
 #include "curl_connection_pool_private.hpp"
 #include "curl_connection_private.hpp"
+#include "curl_multi_private.hpp"
 #include "curl_session_private.hpp"
 
 #if defined(AZ_PLATFORM_POSIX)
@@ -60,16 +62,30 @@
 #include <poll.h> // for poll()
 
 #include <sys/socket.h> // for socket shutdown
+#include <unistd.h> // for close()
+#if defined(AZ_PLATFORM_LINUX)
+#include <sys/epoll.h> // for epoll_wait()
+#include <sys/eventfd.h> // for eventfd()
+#endif
 #elif defined(AZ_PLATFORM_WINDOWS)
 #include <winsock2.h> // for WSAPoll();
 #endif // AZ_PLATFORM_POSIX/AZ_PLATFORM_WINDOWS
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
+#include <functional>
+#include <future>
 #include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace {
 std::string const LogMsgPrefix = "[CURL Transport Adapter]: ";
@@ -90,13 +106,14 @@ inline bool SetLibcurlOption(
   return *outError == CURLE_OK;
 }
 
+template <typename T>
 inline bool SetLibcurlShareOption(
-    std::unique_ptr<Azure::Core::_detail::CURLSHWrapper> const& handle,
+    CURLSH* handle,
     CURLSHoption option,
-    curl_lock_data value,
+    T value,
     CURLSHcode* outError)
 {
-  *outError = curl_share_setopt(handle->share_handle, option, value);
+  *outError = curl_share_setopt(handle, option, value);
   return *outError == CURLSHE_OK;
 }
 
@@ -206,81 +223,6 @@ void WinSocketSetBuffSize(curl_socket_t socket)
 }
 #endif
 
-static void CleanupThread()
-{
-  // NOTE: Avoid using Log::Write in here as it may fail on macOS,
-  // see issue: https://github.com/Azure/azure-sdk-for-cpp/issues/3224
-  // This method can wake up in de-attached mode after the application has been terminated.
-  // If that happens, trying to use `Log` would cause `abort` as it was previously deallocated.
-  using namespace Azure::Core::Http::_detail;
-  for (;;)
-  {
-    // Won't continue until the ConnectionPoolMutex is released from MoveConnectionBackToPool
-    std::unique_lock<std::mutex> lockForPoolCleaning(
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-
-    // Wait for the default time OR to the signal from the conditional variable.
-    // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
-    // wakes up (or it's cancelled).
-    if (CurlConnectionPool::g_curlConnectionPool.ConditionalVariableForCleanThread.wait_for(
-            lockForPoolCleaning,
-            std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
-            []() {
-              return CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size() == 0;
-            }))
-    {
-      // Cancelled by another thread or no connections on wakeup
-      CurlConnectionPool::g_curlConnectionPool.IsCleanThreadRunning = false;
-      break;
-    }
-
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeCleaned;
-
-    // loop the connection pool index - Note: lock is re-taken for the mutex
-    // Notes: The size of each host-index is always expected to be greater than 0 because the
-    // host-index is removed anytime it becomes empty.
-    for (auto index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.begin();
-         index != CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.end();)
-    {
-      // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
-      // push_front). The last connection moved to the pool will be the first to be re-used. Because
-      // of this, the oldest connection in the pool can be found at the end of the list. Looping the
-      // connection pool backwards until a connection that is not expired is found or until all
-      // connections are removed.
-      auto& connectionList = index->second;
-      auto connectionIter = connectionList.end();
-      while (connectionIter != connectionList.begin())
-      {
-        --connectionIter;
-        if ((*connectionIter)->IsExpired())
-        {
-          // remove connection from the pool and update the connection to the next one
-          // which is going to be list.end()
-          connectionsToBeCleaned.emplace_back(std::move(*connectionIter));
-          connectionIter = connectionList.erase(connectionIter);
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if (connectionList.empty())
-      {
-        index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.erase(index);
-      }
-      else
-      {
-        ++index;
-      }
-    }
-
-    lockForPoolCleaning.unlock();
-    // Do actual connections release work here, without holding the mutex.
-  }
-}
-
 // This function is only used when ExpectedTlsRootCertificate transport options is set to non empty.
 // And that capability only impacts the curl transport behavior in versions of libcurl >= 7.77.0.
 #if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
@@ -342,34 +284,75 @@ using Azure::Core::Http::RawResponse;
 using Azure::Core::Http::Request;
 using Azure::Core::Http::TransportException;
 using Azure::Core::Http::_detail::CurlConnectionPool;
+using Azure::Core::Http::_detail::CurlShare;
 
 Azure::Core::Http::_detail::CurlConnectionPool
     Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool;
 
+namespace {
+// Set when the connection pool is destroyed, at exit. The connections destroyed after it, such as
+// the ones owned by other static objects, don't go back to the pool or release their slot on it.
+// Constant initialized and trivially destructible, so it can be read once the pool is gone.
+std::atomic<bool> g_isConnectionPoolDestroyed{false};
+} // namespace
+
 CurlTransport::CurlTransport(Azure::Core::Http::Policies::TransportOptions const& options)
     : CurlTransport(CurlTransportOptionsFromTransportOptions(options))
 {
 }
 
+namespace {
+std::chrono::milliseconds GetConnectionTimeoutOverride(Context const& context)
+{
+  std::chrono::milliseconds contextConnectionTimeout{0};
+  if (context.TryGetValue(
+          Azure::Core::Http::_internal::HttpConnectionTimeout, contextConnectionTimeout)
+      && contextConnectionTimeout.count() > 0)
+  {
+    return contextConnectionTimeout;
+  }
+  return std::chrono::milliseconds{0};
+}
+} // namespace
+
+void CurlTransport::SendAsync(
+    Request& request,
+    Context const& context,
+    Azure::Core::Http::SendAsyncCallback callback)
+{
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED)
+  if (m_options.EnableCurlMultiEventLoop
+      && !m_options.SslOptions.EnableCertificateRevocationListCheck)
+  {
+    _detail::CurlMultiEventLoop::g_curlMultiEventLoop.SendAsync(
+        request, m_options, GetConnectionTimeoutOverride(context), context, std::move(callback));
+    return;
+  }
+#endif
+
+  HttpTransport::SendAsync(request, context, std::move(callback));
+}
+
 std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const& context)
 {
   // Create CurlSession to perform request
   Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Creating a new session.");
 
-  auto connectionTimeoutOverride = std::chrono::milliseconds{0};
+  auto const connectionTimeoutOverride = GetConnectionTimeoutOverride(context);
+
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED)
+  if (m_options.EnableCurlMultiEventLoop
+      && !m_options.SslOptions.EnableCertificateRevocationListCheck)
   {
-    std::chrono::milliseconds contextConnectionTimeout{0};
-    if (context.TryGetValue(Http::_internal::HttpConnectionTimeout, contextConnectionTimeout)
-        && contextConnectionTimeout.count() > 0)
-    {
-      connectionTimeoutOverride = contextConnectionTimeout;
-    }
+    return _detail::CurlMultiEventLoop::g_curlMultiEventLoop.Send(
+        request, m_options, connectionTimeoutOverride, context);
   }
+#endif
 
   auto session = std::make_unique<CurlSession>(
       request,
       CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
-          request, m_options, connectionTimeoutOverride, false),
+          request, m_options, connectionTimeoutOverride, false, context),
       m_options);
 
   CURLcode performing;
@@ -393,13 +376,17 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
     // clean (remove connections) and create a new one. This is because, keep getting connections
     // that fail to perform means a general network disconnection where all connections in the pool
     // won't be no longer valid.
+    // The failed session is destroyed first to release its connection, which might be needed to
+    // stay within the maximum number of connections for the host.
+    session.reset();
     session = std::make_unique<CurlSession>(
         request,
         CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
             request,
             m_options,
             connectionTimeoutOverride,
-            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed),
+            getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed,
+            context),
         m_options);
   }
 
@@ -428,6 +415,97 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
   return response;
 }
 
+std::future<void> CurlTransport::PrewarmConnections(
+    std::vector<Azure::Core::Url> const& endpoints,
+    size_t connectionsPerEndpoint,
+    Context const& context)
+{
+  struct PrewarmState final
+  {
+    CurlTransportOptions Options;
+    std::chrono::milliseconds ConnectionTimeoutOverride;
+    Context OperationContext;
+    // The endpoint of each connection to be opened.
+    std::vector<Azure::Core::Url> Connections;
+    std::atomic<size_t> NextConnection{0};
+    std::atomic<size_t> RunningWorkers{0};
+    std::promise<void> Completed;
+  };
+
+  auto state = std::make_shared<PrewarmState>();
+  state->Options = m_options;
+  state->ConnectionTimeoutOverride = GetConnectionTimeoutOverride(context);
+  // A child context, which the connection pool cancels when it is destroyed.
+  state->OperationContext = context.WithDeadline((Azure::DateTime::max)());
+  auto completed = state->Completed.get_future();
+
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED)
+  if (m_options.EnableCurlMultiEventLoop
+      && !m_options.SslOptions.EnableCertificateRevocationListCheck)
+  {
+    // The event loop doesn't use the connection pool.
+    state->Completed.set_value();
+    return completed;
+  }
+#endif
+
+  for (auto const& endpoint : endpoints)
+  {
+    Request request(HttpMethod::Get, endpoint);
+    auto const connectionCount = CurlConnectionPool::g_curlConnectionPool.ReserveConnections(
+        request, m_options, state->ConnectionTimeoutOverride, connectionsPerEndpoint);
+    state->Connections.insert(state->Connections.end(), connectionCount, endpoint);
+  }
+
+  auto const workerCount
+      = std::min(state->Connections.size(), _detail::MaxConnectionPrewarmThreads);
+  if (workerCount == 0)
+  {
+    state->Completed.set_value();
+    return completed;
+  }
+
+  Log::Write(
+      Logger::Level::Verbose,
+      LogMsgPrefix + "Opening " + std::to_string(state->Connections.size())
+          + " connections in advance.");
+
+  state->RunningWorkers = workerCount;
+  // The threads share the connections to be opened, and keep the state alive until they are done.
+  // They are owned by the connection pool, which cancels them and joins them when destroyed.
+  auto const openConnections = [state]() {
+    for (auto index = state->NextConnection++; index < state->Connections.size();
+         index = state->NextConnection++)
+    {
+      Request request(HttpMethod::Get, state->Connections[index]);
+      try
+      {
+        CurlConnectionPool::g_curlConnectionPool.OpenReservedConnection(
+            request, state->Options, state->ConnectionTimeoutOverride, state->OperationContext);
+      }
+      catch (std::exception const& e)
+      {
+        // Log may be destroyed already when the pool cancels the threads, at exit.
+        if (!state->OperationContext.IsCancelled())
+        {
+          Log::Write(
+              Logger::Level::Warning,
+              LogMsgPrefix + "Failed to open a connection in advance. " + e.what());
+        }
+      }
+    }
+
+    if (--state->RunningWorkers == 0)
+    {
+      state->Completed.set_value();
+    }
+  };
+  CurlConnectionPool::g_curlConnectionPool.StartPrewarmThreads(
+      workerCount, openConnections, state->OperationContext);
+
+  return completed;
+}
+
 CURLcode CurlSession::Perform(Context const& context)
 {
   // Set the session state
@@ -671,23 +749,20 @@ CURLcode CurlConnection::SendBuffer(
 
 CURLcode CurlSession::UploadBody(Context const& context)
 {
-  // Send body UploadStreamPageSize at a time (libcurl default)
-  // NOTE: if stream is on top a contiguous memory, we can avoid allocating this copying buffer
+  // Send body UploadStreamPageSize at a time (libcurl default). The bytes are borrowed from the
+  // stream, so streams on top of contiguous memory (including memory-mapped files) are sent
+  // without being copied to an intermediate buffer.
   auto streamBody = this->m_request.GetBodyStream();
   CURLcode sendResult = CURLE_OK;
 
-  auto unique_buffer
-      = std::make_unique<uint8_t[]>(static_cast<size_t>(_detail::DefaultUploadChunkSize));
-
   while (true)
   {
-    size_t rawRequestLen
-        = streamBody->Read(unique_buffer.get(), _detail::DefaultUploadChunkSize, context);
-    if (rawRequestLen == 0)
+    auto view = streamBody->ReadView(_detail::DefaultUploadChunkSize, context);
+    if (view.Size == 0)
     {
       break;
     }
-    sendResult = m_connection->SendBuffer(unique_buffer.get(), rawRequestLen, context);
+    sendResult = m_connection->SendBuffer(view.Data, view.Size, context);
     if (sendResult != CURLE_OK)
     {
       return sendResult;
@@ -821,7 +896,7 @@ void CurlSession::ParseChunkSize(Context const& context)
            * indicate the the next read call should read from the inner buffer start.
            */
           this->m_innerBufferSize = m_connection->ReadFromSocket(
-              this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+              this->m_readBuffer.data(), this->m_readBuffer.size(), context);
           this->m_bodyStartInBuffer = 0;
         }
         else
@@ -841,7 +916,7 @@ void CurlSession::ParseChunkSize(Context const& context)
     if (keepPolling)
     { // Read all internal buffer and \n was not found, pull from wire
       this->m_innerBufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+          this->m_readBuffer.data(), this->m_readBuffer.size(), context);
       this->m_bodyStartInBuffer = 0;
     }
   }
@@ -865,18 +940,19 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       // parse from internal buffer. This means previous read from server got more than one
       // response. This happens when Server returns a 100-continue plus an error code
       bufferSize = this->m_innerBufferSize - this->m_bodyStartInBuffer;
-      bytesParsed = parser.Parse(this->m_readBuffer + this->m_bodyStartInBuffer, bufferSize);
+      bytesParsed
+          = parser.Parse(this->m_readBuffer.data() + this->m_bodyStartInBuffer, bufferSize);
       // if parsing from internal buffer is not enough, do next read from wire
       reuseInternalBuffer = false;
       // reset body start
-      this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+      this->m_bodyStartInBuffer = this->m_readBuffer.size();
     }
     else
     {
       // Try to fill internal buffer from socket.
       // If response is smaller than buffer, we will get back the size of the response
       bufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+          this->m_readBuffer.data(), this->m_readBuffer.size(), context);
       if (bufferSize == 0)
       {
         // closed connection, prevent application from keep trying to pull more bytes from the wire
@@ -884,13 +960,18 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
         return CURLE_RECV_ERROR;
       }
       // returns the number of bytes parsed up to the body Start
-      bytesParsed = parser.Parse(this->m_readBuffer, bufferSize);
+      bytesParsed = parser.Parse(this->m_readBuffer.data(), bufferSize);
     }
 
     if (bytesParsed < bufferSize)
     {
       this->m_bodyStartInBuffer = bytesParsed; // Body Start
     }
+    else
+    {
+      // Nothing left in the buffer
+      this->m_bodyStartInBuffer = this->m_readBuffer.size();
+    }
   }
 
   this->m_response = parser.ExtractResponse();
@@ -1016,7 +1097,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       || this->m_lastStatusCode == HttpStatusCode::NotModified)
   {
     this->m_contentLength = 0;
-    this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    this->m_bodyStartInBuffer = this->m_readBuffer.size();
     return CURLE_OK;
   }
 
@@ -1049,6 +1130,17 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
   {
     this->m_contentLength
         = static_cast<int64_t>(std::stoull(isContentLengthHeaderInResponse->second.data()));
+
+    // Grow the buffer for large responses. The part of the body already read is kept.
+    if (this->m_adaptiveReadBuffer
+        && static_cast<uint64_t>(this->m_contentLength) > this->m_readBuffer.size())
+    {
+      this->m_readBuffer.resize(static_cast<size_t>((std::max)(
+          static_cast<uint64_t>(this->m_readBuffer.size()),
+          (std::min)(
+              static_cast<uint64_t>(this->m_contentLength),
+              static_cast<uint64_t>(_detail::MaxAdaptiveReadBufferSize)))));
+    }
     return CURLE_OK;
   }
 
@@ -1070,7 +1162,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
       { // if nothing on inner buffer, pull from wire
         this->m_innerBufferSize = m_connection->ReadFromSocket(
-            this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+            this->m_readBuffer.data(), this->m_readBuffer.size(), context);
         if (this->m_innerBufferSize == 0)
         {
           // closed connection, prevent application from keep trying to pull more bytes from the
@@ -1107,7 +1199,7 @@ void CurlSession::ReadExpected(uint8_t expected, Context const& context)
   {
     // end of buffer, pull data from wire
     this->m_innerBufferSize = m_connection->ReadFromSocket(
-        this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+        this->m_readBuffer.data(), this->m_readBuffer.size(), context);
     if (this->m_innerBufferSize == 0)
     {
       // closed connection, prevent application from keep trying to pull more bytes from the wire
@@ -1132,10 +1224,9 @@ void CurlSession::ReadCRLF(Context const& context)
   ReadExpected('\n', context);
 }
 
-// Read from curl session
-size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context)
+size_t CurlSession::PrepareBodyRead(Context const& context)
 {
-  if (count == 0 || this->IsEOF())
+  if (this->IsEOF())
   {
     return 0;
   }
@@ -1160,38 +1251,23 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
     }
   }
 
-  auto totalRead = size_t();
-  size_t readRequestLength = this->m_isChunkedResponseType
-      ? (std::min)(this->m_chunkSize - this->m_sessionTotalRead, count)
-      : count;
+  if (this->m_isChunkedResponseType)
+  {
+    return this->m_chunkSize - this->m_sessionTotalRead;
+  }
 
   // For responses with content-length, avoid trying to read beyond Content-length or
   // libcurl could return a second response as BadRequest.
   // https://github.com/Azure/azure-sdk-for-cpp/issues/306
   if (this->m_contentLength > 0)
   {
-    size_t remainingBodyContent
-        = static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead;
-    readRequestLength = (std::min)(readRequestLength, remainingBodyContent);
-  }
-
-  // Take data from inner buffer if any
-  if (this->m_bodyStartInBuffer < this->m_innerBufferSize)
-  {
-    // still have data to take from innerbuffer
-    Azure::Core::IO::MemoryBodyStream innerBufferMemoryStream(
-        this->m_readBuffer + this->m_bodyStartInBuffer,
-        this->m_innerBufferSize - this->m_bodyStartInBuffer);
-
-    // From code inspection, it is guaranteed that the readRequestLength will fit within size_t
-    // since count is bounded by size_t.
-    totalRead = innerBufferMemoryStream.Read(buffer, readRequestLength, context);
-    this->m_bodyStartInBuffer += totalRead;
-    this->m_sessionTotalRead += totalRead;
-
-    return totalRead;
+    return static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead;
   }
+  return (std::numeric_limits<size_t>::max)();
+}
 
+size_t CurlSession::ReadBodyFromSocket(uint8_t* buffer, size_t count, Context const& context)
+{
   // Head request have contentLength = 0, so we won't read more, just return 0
   // Also if we have already read all contentLength
   if (this->m_sessionTotalRead == static_cast<size_t>(this->m_contentLength) || this->IsEOF())
@@ -1206,8 +1282,7 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   }
   // Read from socket when no more data on internal buffer
   // For chunk request, read a chunk based on chunk size
-  totalRead = m_connection->ReadFromSocket(buffer, static_cast<size_t>(readRequestLength), context);
-  this->m_sessionTotalRead += totalRead;
+  auto totalRead = m_connection->ReadFromSocket(buffer, count, context);
 
   // Reading 0 bytes means closed connection.
   // For known content length and chunked response, this means there is nothing else to read
@@ -1230,6 +1305,78 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   return totalRead;
 }
 
+// Read from curl session
+size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context)
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+  auto const availableLength = PrepareBodyRead(context);
+  auto const readRequestLength = (std::min)(count, availableLength);
+  if (readRequestLength == 0)
+  {
+    return 0;
+  }
+
+  // Small reads are served from the inner buffer, filled with as much of the body as it can hold,
+  // instead of taking one read from the network for each of them.
+  if (this->m_bodyStartInBuffer >= this->m_innerBufferSize
+      && readRequestLength < this->m_readBuffer.size())
+  {
+    this->m_innerBufferSize = ReadBodyFromSocket(
+        this->m_readBuffer.data(),
+        (std::min)(availableLength, this->m_readBuffer.size()),
+        context);
+    this->m_bodyStartInBuffer = 0;
+  }
+
+  // Take data from inner buffer if any
+  if (this->m_bodyStartInBuffer < this->m_innerBufferSize)
+  {
+    auto const totalRead
+        = (std::min)(readRequestLength, this->m_innerBufferSize - this->m_bodyStartInBuffer);
+    std::memcpy(buffer, this->m_readBuffer.data() + this->m_bodyStartInBuffer, totalRead);
+    this->m_bodyStartInBuffer += totalRead;
+    this->m_sessionTotalRead += totalRead;
+
+    return totalRead;
+  }
+
+  auto const totalRead = ReadBodyFromSocket(buffer, readRequestLength, context);
+  this->m_sessionTotalRead += totalRead;
+  return totalRead;
+}
+
+// Read from curl session, handing out the inner buffer
+Azure::Core::IO::BodyStreamView CurlSession::OnReadView(size_t count, Context const& context)
+{
+  auto const availableLength = PrepareBodyRead(context);
+  if (availableLength == 0)
+  {
+    return Azure::Core::IO::BodyStreamView{};
+  }
+
+  // When the inner buffer is empty, fill it from the socket.
+  if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
+  {
+    this->m_innerBufferSize = ReadBodyFromSocket(
+        this->m_readBuffer.data(),
+        (std::min)(availableLength, this->m_readBuffer.size()),
+        context);
+    this->m_bodyStartInBuffer = 0;
+  }
+
+  Azure::Core::IO::BodyStreamView view{
+      this->m_readBuffer.data() + this->m_bodyStartInBuffer,
+      (std::min)(
+          (std::min)(count, availableLength), this->m_innerBufferSize - this->m_bodyStartInBuffer)};
+  this->m_bodyStartInBuffer += view.Size;
+  this->m_sessionTotalRead += view.Size;
+
+  return view;
+}
+
 // Read from socket and return the number of bytes taken from socket
 size_t CurlConnection::ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context)
 {
@@ -1433,6 +1580,13 @@ long GetConnectionTimeout(
   return connectionTimeoutLong;
 }
 
+// Generate a display name for the host being connected to
+inline std::string GetHostDisplayName(Azure::Core::Url const& url)
+{
+  uint16_t port = url.GetPort();
+  return url.GetScheme() + "://" + url.GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
+}
+
 // Calculate the connection key.
 // The connection key is a tuple of host, proxy info, TLS info, etc. Basically any characteristics
 // of the connection that should indicate that the connection shouldn't be re-used should be listed
@@ -1468,6 +1622,8 @@ inline std::string GetConnectionKey(
   key.append(",");
   key.append(options.EnableCurlSslCaching ? "1" : "0");
   key.append(",");
+  key.append(options.EnableCurlDnsCaching ? "1" : "0");
+  key.append(",");
 #if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
   key.append(
       !options.SslOptions.PemEncodedExpectedRootCertificates.empty() ? std::to_string(
@@ -2237,74 +2393,191 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
     Request& request,
     CurlTransportOptions const& options,
     std::chrono::milliseconds connectionTimeoutOverride,
-    bool resetPool)
+    bool resetPool,
+    Context const& context)
 {
-  uint16_t port = request.GetUrl().GetPort();
-  // Generate a display name for the host being connected to
-  std::string const& hostDisplayName = request.GetUrl().GetScheme() + "://"
-      + request.GetUrl().GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
+  std::string const hostDisplayName = GetHostDisplayName(request.GetUrl());
   std::string const connectionKey
       = GetConnectionKey(hostDisplayName, options, connectionTimeoutOverride);
 
-  {
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeReset;
-
-    // Critical section. Needs to own ConnectionPoolMutex before executing
-    // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-    std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
-
-    // get a ref to the pool from the map of pools
-    auto hostPoolIndex = g_curlConnectionPool.ConnectionPoolIndex.find(connectionKey);
+  auto const& metrics = options.ConnectionPoolMetrics;
+  auto const waitStart = metrics ? std::chrono::steady_clock::now()
+                                 : std::chrono::steady_clock::time_point();
+  auto& shard = GetShard(connectionKey);
 
-    if (hostPoolIndex != g_curlConnectionPool.ConnectionPoolIndex.end()
-        && hostPoolIndex->second.size() > 0)
+  if (resetPool)
+  {
+    decltype(HostIndex::Connections) connectionsToBeReset;
     {
-      if (resetPool)
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      auto hostPoolIndex = shard.Index.find(connectionKey);
+      if (hostPoolIndex != shard.Index.end())
       {
-        connectionsToBeReset = std::move(hostPoolIndex->second);
         // clean the pool-index as requested in the call. Typically to force a new connection to be
         // created and to discard all current connections in the pool for the host-index. A caller
         // might request this after getting broken/closed connections multiple-times.
-        hostPoolIndex->second.clear();
-        Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Reset connection pool requested.");
+        connectionsToBeReset = std::move(hostPoolIndex->second.Connections);
+        hostPoolIndex->second.Connections.clear();
       }
-      else
+    }
+    if (!connectionsToBeReset.empty())
+    {
+      if (metrics)
       {
-        // get ref to first connection
-        auto fistConnectionIterator = hostPoolIndex->second.begin();
-        // move the connection ref to temp ref
-        auto connection = std::move(*fistConnectionIterator);
-        // Remove the connection ref from list
-        hostPoolIndex->second.erase(fistConnectionIterator);
-
-        // Remove index if there are no more connections
-        if (hostPoolIndex->second.size() == 0)
-        {
-          g_curlConnectionPool.ConnectionPoolIndex.erase(hostPoolIndex);
-        }
+        metrics->Evictions += connectionsToBeReset.size();
+      }
+      Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Reset connection pool requested.");
+    }
+    // The connections are closed here, without holding the mutex, releasing their slots on the
+    // pool before getting a new connection.
+  }
+
+  {
+    // Critical section. Lock the shard mutex to access the pool-index. Mutex is unlocked as soon as
+    // lock is out of scope.
+    std::unique_lock<std::mutex> lock(shard.Mutex);
+
+    // Get a ref to the pool-index, created if there is none yet. The references to the values of
+    // an unordered_map stay valid when other values are inserted.
+    auto& hostIndex = shard.Index[connectionKey];
+    hostIndex.SetOptions(options);
+
+    // Wait for a connection to be moved back to the pool or to be closed when the maximum number
+    // of connections for the host-index is reached.
+    while (hostIndex.Connections.empty() && hostIndex.MaxConnections != 0
+           && hostIndex.OpenConnections >= hostIndex.MaxConnections)
+    {
+      context.ThrowIfCancelled();
+      ++hostIndex.Waiters;
+      hostIndex.ConnectionReleased.wait_for(lock, DefaultConnectionPoolWaitInterval);
+      --hostIndex.Waiters;
+    }
+
+    if (!hostIndex.Connections.empty())
+    {
+      // Re-use the connection which was moved back to the pool the most recently.
+      auto connection = std::move(hostIndex.Connections.front());
+      hostIndex.Connections.pop_front();
+      lock.unlock();
 
-        Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Re-using connection from the pool.");
-        // return connection ref
-        return connection;
+      if (metrics)
+      {
+        ++metrics->Hits;
+        metrics->WaitTimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+                                             std::chrono::steady_clock::now() - waitStart)
+                                             .count();
       }
+      Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Re-using connection from the pool.");
+      return connection;
     }
+
+    // Take the slot of the new connection before creating it, the slot is released by the
+    // connection destructor.
+    ++hostIndex.OpenConnections;
+  }
+
+  if (metrics)
+  {
+    ++metrics->Misses;
+    metrics->WaitTimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+                                         std::chrono::steady_clock::now() - waitStart)
+                                         .count();
   }
 
   // Creating a new connection is thread safe. No need to lock mutex here.
   // No available connection for the pool for the required host. Create one
   Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Spawn new connection.");
 
-  return std::make_unique<CurlConnection>(
+  return CreateConnection(
       request, options, hostDisplayName, connectionKey, connectionTimeoutOverride);
 }
 
+std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::CreateConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionKey,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context)
+{
+  try
+  {
+    return std::make_unique<CurlConnection>(
+        request, options, hostDisplayName, connectionKey, connectionTimeoutOverride, context);
+  }
+  catch (...)
+  {
+    // The connection destructor is not called, the slot is released here.
+    OnConnectionClosed(connectionKey);
+    throw;
+  }
+}
+
+size_t CurlConnectionPool::ReserveConnections(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    size_t connectionCount)
+{
+  std::string const connectionKey = GetConnectionKey(
+      GetHostDisplayName(request.GetUrl()), options, connectionTimeoutOverride);
+  auto& shard = GetShard(connectionKey);
+
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto& hostIndex = shard.Index[connectionKey];
+  hostIndex.SetOptions(options);
+
+  // Only the missing idle connections are opened, within the limits of the pool-index.
+  auto const idleConnections = std::min(connectionCount, hostIndex.MaxIdleConnections);
+  if (hostIndex.Connections.size() >= idleConnections)
+  {
+    return 0;
+  }
+  auto reservedConnections = idleConnections - hostIndex.Connections.size();
+  if (hostIndex.MaxConnections != 0)
+  {
+    reservedConnections = hostIndex.OpenConnections >= hostIndex.MaxConnections
+        ? 0
+        : std::min(reservedConnections, hostIndex.MaxConnections - hostIndex.OpenConnections);
+  }
+
+  hostIndex.OpenConnections += reservedConnections;
+  return reservedConnections;
+}
+
+void CurlConnectionPool::OpenReservedConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context)
+{
+  std::string const hostDisplayName = GetHostDisplayName(request.GetUrl());
+  std::string const connectionKey
+      = GetConnectionKey(hostDisplayName, options, connectionTimeoutOverride);
+
+  if (context.IsCancelled())
+  {
+    OnConnectionClosed(connectionKey);
+    context.ThrowIfCancelled();
+  }
+
+  MoveConnectionBackToPool(
+      CreateConnection(
+          request, options, hostDisplayName, connectionKey, connectionTimeoutOverride, context),
+      true);
+}
+
 // Move the connection back to the connection pool. Push it to the front so it becomes the
 // first connection to be picked next time some one ask for a connection to the pool (LIFO)
 void CurlConnectionPool::MoveConnectionBackToPool(
     std::unique_ptr<CurlNetworkConnection> connection,
     bool httpKeepAlive)
 {
+  if (g_isConnectionPoolDestroyed)
+  {
+    return; // The connection is closed, the pool is gone.
+  }
+
   if (!httpKeepAlive)
   {
     return; // The server has asked us to not re-use this connection.
@@ -2318,113 +2591,325 @@ void CurlConnectionPool::MoveConnectionBackToPool(
 
   Log::Write(Logger::Level::Verbose, "Moving connection to pool...");
 
-  decltype(CurlConnectionPool::g_curlConnectionPool
-               .ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+  decltype(HostIndex::Connections) connectionsToBeRemoved;
+  {
+    auto const& poolId = connection->GetConnectionKey();
+    auto& shard = GetShard(poolId);
 
-  // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-  std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
-  auto& poolId = connection->GetConnectionKey();
-  auto& hostPool = g_curlConnectionPool.ConnectionPoolIndex[poolId];
+    // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto& hostIndex = shard.Index[poolId];
 
-  if (hostPool.size() >= _detail::MaxConnectionsPerIndex && !hostPool.empty())
-  {
-    // Remove the last connection from the pool to insert this one.
-    auto lastConnection = --hostPool.end();
-    connectionToBeRemoved = std::move(*lastConnection);
-    hostPool.erase(lastConnection);
-  }
+    // update the time when connection was moved back to pool
+    connection->UpdateLastUsageTime();
+    hostIndex.Connections.push_front(std::move(connection));
 
-  // update the time when connection was moved back to pool
-  connection->UpdateLastUsageTime();
-  hostPool.push_front(std::move(connection));
+    // Remove the oldest connections from the pool when the maximum is reached.
+    while (hostIndex.Connections.size() > hostIndex.MaxIdleConnections)
+    {
+      connectionsToBeRemoved.splice(
+          connectionsToBeRemoved.end(), hostIndex.Connections, --hostIndex.Connections.end());
+    }
+    if (hostIndex.Metrics)
+    {
+      hostIndex.Metrics->Evictions += connectionsToBeRemoved.size();
+    }
 
-  if (m_cleanThread.joinable() && !IsCleanThreadRunning)
-  {
-    // Clean thread was running before but it's finished, join it to finalize
-    m_cleanThread.join();
+    if (hostIndex.Waiters > 0)
+    {
+      hostIndex.ConnectionReleased.notify_one();
+    }
   }
 
   // Cleanup will start a background thread which will close abandoned connections from the pool.
   // This will free-up resources from the app
   // This is the only call to cleanup.
-  if (!m_cleanThread.joinable())
-  {
-    Log::Write(Logger::Level::Verbose, "Start clean thread");
-    IsCleanThreadRunning = true;
-    m_cleanThread = std::thread(CleanupThread);
-  }
-  else
+  if (!m_isCleanThreadRunning)
   {
-    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+    StartCleanThread();
   }
 }
 
-CurlConnection::CurlConnection(
-    Request& request,
-    CurlTransportOptions const& options,
-    std::string const& hostDisplayName,
-    std::string const& connectionPropertiesKey,
-    std::chrono::milliseconds connectionTimeoutOverride)
-    : m_connectionKey(connectionPropertiesKey)
+void CurlConnectionPool::Clear()
 {
-  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
-  if (!m_handle)
+  for (auto& shard : m_shards)
   {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string("curl_easy_init returned Null"));
-  }
-  CURLcode result;
+    decltype(HostIndex::Connections) connectionsToBeCleaned;
+    {
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      for (auto index = shard.Index.begin(); index != shard.Index.end();)
+      {
+        connectionsToBeCleaned.splice(connectionsToBeCleaned.end(), index->second.Connections);
+        if (index->second.OpenConnections == 0 && index->second.Waiters == 0)
+        {
+          index = shard.Index.erase(index);
+        }
+        else
+        {
+          ++index;
+        }
+      }
+    }
+    // The connections are closed here, without holding the mutex.
+  }
+}
 
-  if (!options.EnableCurlSslCaching)
+size_t CurlConnectionPool::IndexCount()
+{
+  size_t count = 0;
+  for (auto& shard : m_shards)
   {
-    // Disable SSL session ID caching
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_SESSIONID_CACHE, 0L, &result))
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    for (auto const& index : shard.Index)
     {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(result)));
+      if (!index.second.Connections.empty())
+      {
+        ++count;
+      }
     }
   }
+  return count;
+}
+
+size_t CurlConnectionPool::ConnectionsOnPool(std::string const& connectionKey)
+{
+  auto& shard = GetShard(connectionKey);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto index = shard.Index.find(connectionKey);
+  return index == shard.Index.end() ? 0 : index->second.Connections.size();
+}
+
+void CurlConnectionPool::OnConnectionClosed(std::string const& connectionKey)
+{
+  auto& shard = GetShard(connectionKey);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto index = shard.Index.find(connectionKey);
+  if (index == shard.Index.end() || index->second.OpenConnections == 0)
+  {
+    return;
+  }
+
+  auto& hostIndex = index->second;
+  --hostIndex.OpenConnections;
+  if (hostIndex.Waiters > 0)
+  {
+    hostIndex.ConnectionReleased.notify_one();
+  }
+  else if (hostIndex.Connections.empty() && hostIndex.OpenConnections == 0)
+  {
+    shard.Index.erase(index);
+  }
+}
+
+void CurlConnectionPool::StartCleanThread()
+{
+  std::lock_guard<std::mutex> lock(m_cleanThreadMutex);
+  if (m_cleanThread.joinable() && !m_isCleanThreadRunning)
+  {
+    // Clean thread was running before but it's finished, join it to finalize
+    m_cleanThread.join();
+  }
+
+  if (!m_cleanThread.joinable())
+  {
+    Log::Write(Logger::Level::Verbose, "Start clean thread");
+    m_isCleanThreadRunning = true;
+    m_cleanThread = std::thread([this]() { CleanupThread(); });
+  }
   else
   {
-    m_sslShareHandle = std::make_unique<Azure::Core::_detail::CURLSHWrapper>();
+    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+  }
+}
 
-    if (!m_sslShareHandle->share_handle)
+void CurlConnectionPool::CleanupThread()
+{
+  // NOTE: Avoid using Log::Write in here as it may fail on macOS,
+  // see issue: https://github.com/Azure/azure-sdk-for-cpp/issues/3224
+  // This method can wake up in de-attached mode after the application has been terminated.
+  // If that happens, trying to use `Log` would cause `abort` as it was previously deallocated.
+  for (;;)
+  {
     {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string("curl_share_init returned Null"));
+      std::unique_lock<std::mutex> lockForPoolCleaning(m_cleanThreadMutex);
+
+      // Wait for the default time OR to the signal from the conditional variable.
+      // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
+      // wakes up (or it's cancelled).
+      if (m_cleanThreadSignal.wait_for(
+              lockForPoolCleaning,
+              std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
+              [this]() { return IndexCount() == 0; }))
+      {
+        // Cancelled by another thread or no connections on wakeup.
+        // MoveConnectionBackToPool checks whether the thread is running after adding a connection,
+        // so the pool is checked again once the flag is cleared. Either the connection is found
+        // here, or the thread is started again.
+        m_isCleanThreadRunning = false;
+        if (IndexCount() == 0)
+        {
+          break;
+        }
+        m_isCleanThreadRunning = true;
+      }
     }
 
-    CURLSHcode shResult;
-    if (!SetLibcurlShareOption(
-            m_sslShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION, &shResult))
+    for (auto& shard : m_shards)
     {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_share_strerror(shResult)));
+      decltype(HostIndex::Connections) connectionsToBeCleaned;
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      for (auto index = shard.Index.begin(); index != shard.Index.end();)
+      {
+        // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
+        // push_front). The last connection moved to the pool will be the first to be re-used.
+        // Because of this, the oldest connection in the pool can be found at the end of the list.
+        // Looping the connection pool backwards until a connection that is not expired is found
+        // or until all connections are removed.
+        auto& hostIndex = index->second;
+        size_t expiredConnections = 0;
+        while (!hostIndex.Connections.empty() && hostIndex.Connections.back()->IsExpired())
+        {
+          connectionsToBeCleaned.splice(
+              connectionsToBeCleaned.end(), hostIndex.Connections, --hostIndex.Connections.end());
+          ++expiredConnections;
+        }
+        if (hostIndex.Metrics)
+        {
+          hostIndex.Metrics->Evictions += expiredConnections;
+        }
+
+        // The indexes with open connections are removed once the connections are closed.
+        if (hostIndex.Connections.empty() && hostIndex.OpenConnections == 0
+            && hostIndex.Waiters == 0)
+        {
+          index = shard.Index.erase(index);
+        }
+        else
+        {
+          ++index;
+        }
+      }
+      // The lock is released before the connections are destroyed, which is the actual
+      // connections release work.
+    }
+  }
+}
+
+CurlConnectionPool::~CurlConnectionPool()
+{
+  // The threads opening connections in advance add them to the pool, so they are stopped
+  // first.
+  JoinPrewarmThreads();
+  // Remove all connections. Their destructor releases their slot on the pool, so they must be
+  // destroyed before the shards.
+  Clear();
+  if (m_cleanThread.joinable())
+  {
+    {
+      // Makes sure the clean thread is either waiting for the signal, or will check the pool
+      // before waiting.
+      std::lock_guard<std::mutex> lock(m_cleanThreadMutex);
     }
+    // Signal clean thread to wake up
+    m_cleanThreadSignal.notify_one();
+    // join thread
+    m_cleanThread.join();
+  }
+  g_isConnectionPoolDestroyed = true;
+  curl_global_cleanup();
+}
 
-    if (!SetLibcurlOption(m_handle, CURLOPT_SHARE, m_sslShareHandle->share_handle, &result))
+void CurlConnectionPool::StartPrewarmThreads(
+    size_t threadCount,
+    std::function<void()> const& work,
+    Context context)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_prewarmThreadsMutex);
+    if (!m_isClosing)
     {
-      throw Azure::Core::Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(result)));
+      // The threads which are done are joined here, the others when the pool is destroyed.
+      auto const done = std::partition(
+          m_prewarmThreads.begin(), m_prewarmThreads.end(), [](PrewarmThread const& thread) {
+            return !*thread.Done;
+          });
+      for (auto thread = done; thread != m_prewarmThreads.end(); ++thread)
+      {
+        thread->Thread.join();
+      }
+      m_prewarmThreads.erase(done, m_prewarmThreads.end());
+
+      for (size_t i = 0; i < threadCount; ++i)
+      {
+        auto threadDone = std::make_shared<std::atomic<bool>>(false);
+        m_prewarmThreads.push_back(PrewarmThread{
+            std::thread([work, threadDone]() {
+              work();
+              *threadDone = true;
+            }),
+            threadDone,
+            context});
+      }
+      return;
     }
   }
 
+  context.Cancel();
+  for (size_t i = 0; i < threadCount; ++i)
+  {
+    work();
+  }
+}
+
+void CurlConnectionPool::JoinPrewarmThreads()
+{
+  std::vector<PrewarmThread> threads;
+  {
+    std::lock_guard<std::mutex> lock(m_prewarmThreadsMutex);
+    m_isClosing = true;
+    threads.swap(m_prewarmThreads);
+  }
+  for (auto& thread : threads)
+  {
+    thread.WorkContext.Cancel();
+  }
+  for (auto& thread : threads)
+  {
+    thread.Thread.join();
+  }
+}
+
+CurlConnection::~CurlConnection()
+{
+  // Close the connection before releasing its slot, so a thread waiting for the slot doesn't open
+  // more connections than allowed.
+  m_handle.reset();
+  if (!g_isConnectionPoolDestroyed)
+  {
+    CurlConnectionPool::g_curlConnectionPool.OnConnectionClosed(m_connectionKey);
+  }
+}
+
+void CurlConnection::ConfigureHandle(
+    Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::chrono::milliseconds connectionTimeoutOverride)
+{
+  CURLcode result;
+
   if (options.EnableCurlTracing)
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
+            handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate
           + std::string(". Could not enable logging callback.")
           + std::string(curl_easy_strerror(result)));
     }
-    if (!SetLibcurlOption(m_handle, CURLOPT_VERBOSE, 1, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_VERBOSE, 1, &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate
@@ -2433,8 +2918,8 @@ CurlConnection::CurlConnection(
     }
   }
 
-  // Libcurl setup before open connection (url, connect_only, timeout)
-  if (!SetLibcurlOption(m_handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
+  // Libcurl setup before open connection (url, timeout)
+  if (!SetLibcurlOption(handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
@@ -2442,14 +2927,7 @@ CurlConnection::CurlConnection(
   }
 
   if (request.GetUrl().GetPort() != 0
-      && !SetLibcurlOption(m_handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
-  }
-
-  if (!SetLibcurlOption(m_handle, CURLOPT_CONNECT_ONLY, 1L, &result))
+      && !SetLibcurlOption(handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
@@ -2459,7 +2937,7 @@ CurlConnection::CurlConnection(
   //   Set timeout to 24h. Libcurl will fail uploading on windows if timeout is:
   // timeout >= 25 days. Fails as soon as trying to upload any data
   // 25 days < timeout > 1 days. Fail on huge uploads ( > 1GB)
-  if (!SetLibcurlOption(m_handle, CURLOPT_TIMEOUT, 60L * 60L * 24L, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_TIMEOUT, 60L * 60L * 24L, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
@@ -2470,7 +2948,7 @@ CurlConnection::CurlConnection(
     const long connectionTimeout = GetConnectionTimeout(options, connectionTimeoutOverride);
     if (connectionTimeout > 0)
     {
-      if (!SetLibcurlOption(m_handle, CURLOPT_CONNECTTIMEOUT_MS, connectionTimeout, &result))
+      if (!SetLibcurlOption(handle, CURLOPT_CONNECTTIMEOUT_MS, connectionTimeout, &result))
       {
         throw Azure::Core::Http::TransportException(
             _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2485,7 +2963,7 @@ CurlConnection::CurlConnection(
    */
   if (options.Proxy)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_PROXY, options.Proxy->c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_PROXY, options.Proxy->c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2497,7 +2975,7 @@ CurlConnection::CurlConnection(
   if (options.ProxyUsername.HasValue())
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_PROXYUSERNAME, options.ProxyUsername.Value().c_str(), &result))
+            handle, CURLOPT_PROXYUSERNAME, options.ProxyUsername.Value().c_str(), &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2508,7 +2986,7 @@ CurlConnection::CurlConnection(
   if (options.ProxyPassword.HasValue())
   {
     if (!SetLibcurlOption(
-            m_handle, CURLOPT_PROXYPASSWORD, options.ProxyPassword.Value().c_str(), &result))
+            handle, CURLOPT_PROXYPASSWORD, options.ProxyPassword.Value().c_str(), &result))
     {
       throw TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2519,7 +2997,7 @@ CurlConnection::CurlConnection(
 
   if (!options.CAInfo.empty())
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2530,7 +3008,7 @@ CurlConnection::CurlConnection(
 
   if (!options.CAPath.empty())
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAPATH, options.CAPath.c_str(), &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAPATH, options.CAPath.c_str(), &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2547,7 +3025,7 @@ CurlConnection::CurlConnection(
                options.SslOptions.PemEncodedExpectedRootCertificates.c_str())),
            options.SslOptions.PemEncodedExpectedRootCertificates.size(),
            CURL_BLOB_COPY};
-    if (!SetLibcurlOption(m_handle, CURLOPT_CAINFO_BLOB, &rootCertBlob, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_CAINFO_BLOB, &rootCertBlob, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2564,45 +3042,18 @@ CurlConnection::CurlConnection(
     sslOption |= CURLSSLOPT_NO_REVOKE;
   }
 
-  if (!SetLibcurlOption(m_handle, CURLOPT_SSL_OPTIONS, sslOption, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_SSL_OPTIONS, sslOption, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
         + ". Failed to set ssl options to long bitmask:" + std::to_string(sslOption) + ". "
         + std::string(curl_easy_strerror(result)));
   }
-#elif !defined(AZ_PLATFORM_MAC)
-  if (options.SslOptions.EnableCertificateRevocationListCheck)
-  {
-    if (!SetLibcurlOption(
-            m_handle, CURLOPT_SSL_CTX_FUNCTION, CurlConnection::CurlSslCtxCallback, &result))
-    {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-          + ". Failed to set SSL context callback. " + std::string(curl_easy_strerror(result)));
-    }
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_CTX_DATA, this, &result))
-    {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-          + ". Failed to set SSL context callback data. "
-          + std::string(curl_easy_strerror(result)));
-    }
-    //          if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYSTATUS, 1, &result))
-    //          {
-    //            throw TransportException(
-    //                _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
-    //                + ". Failed to enable OCSP chaining. " +
-    //                std::string(curl_easy_strerror(result)));
-    //          }
-  }
-  m_allowFailedCrlRetrieval = options.SslOptions.AllowFailedCrlRetrieval;
 #endif
-  m_enableCrlValidation = options.SslOptions.EnableCertificateRevocationListCheck;
 
   if (!options.SslVerifyPeer)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYPEER, 0L, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_SSL_VERIFYPEER, 0L, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2612,7 +3063,7 @@ CurlConnection::CurlConnection(
 
   if (options.NoSignal)
   {
-    if (!SetLibcurlOption(m_handle, CURLOPT_NOSIGNAL, 1L, &result))
+    if (!SetLibcurlOption(handle, CURLOPT_NOSIGNAL, 1L, &result))
     {
       throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2624,7 +3075,7 @@ CurlConnection::CurlConnection(
   // curl-transport adapter supports only HTTP/1.1
   // https://github.com/Azure/azure-sdk-for-cpp/issues/2848
   // The libcurl uses HTTP/2 by default, if it can be negotiated with a server on handshake.
-  if (!SetLibcurlOption(m_handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
@@ -2632,38 +3083,240 @@ CurlConnection::CurlConnection(
   }
 
   //   Make libcurl to support only TLS v1.2 or later
-  if (!SetLibcurlOption(m_handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2, &result))
+  if (!SetLibcurlOption(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2, &result))
   {
     throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
         + ". Failed enforcing TLS v1.2 or greater. " + std::string(curl_easy_strerror(result)));
   }
+}
 
-  auto performResult = curl_easy_perform(m_handle.get());
-  if (performResult != CURLE_OK)
+void CurlShare::LockCallback(CURL*, curl_lock_data data, curl_lock_access, void* userp)
+{
+  // Shared and exclusive accesses are not told apart, the data is locked for a short time.
+  static_cast<CurlShare*>(userp)->m_locks[data].lock();
+}
+
+void CurlShare::UnlockCallback(CURL*, curl_lock_data data, void* userp)
+{
+  static_cast<CurlShare*>(userp)->m_locks[data].unlock();
+}
+
+std::shared_ptr<CurlShare> CurlShare::Get(CurlTransportOptions const& options, CURLSHcode* outError)
+{
+  *outError = CURLSHE_OK;
+  if (!options.EnableCurlSslCaching && !options.EnableCurlDnsCaching)
   {
-#if defined(AZ_PLATFORM_LINUX)
-    if (performResult == CURLE_PEER_FAILED_VERIFICATION)
-    {
-      curl_easy_getinfo(m_handle.get(), CURLINFO_SSL_VERIFYRESULT, &result);
-      throw Http::TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(performResult))
-          + ". Underlying error: " + X509_verify_cert_error_string(result));
-    }
-    else
-#endif
+    return nullptr;
+  }
+
+  // The TLS sessions are shared only between the connections doing the same TLS checks.
+  std::string key;
+  key.append(options.EnableCurlSslCaching ? "1" : "0");
+  key.append(",");
+  key.append(options.EnableCurlDnsCaching ? "1" : "0");
+  if (options.EnableCurlSslCaching)
+  {
+    key.append(",");
+    key.append(options.SslVerifyPeer ? "1" : "0");
+    key.append(",");
+    key.append(options.SslOptions.EnableCertificateRevocationListCheck ? "1" : "0");
+    key.append(",");
+    key.append(options.SslOptions.AllowFailedCrlRetrieval ? "1" : "0");
+    key.append(",");
+    key.append(options.CAInfo);
+    key.append(",");
+    key.append(options.CAPath);
+    key.append(",");
+    key.append(std::to_string(
+        std::hash<std::string>{}(options.SslOptions.PemEncodedExpectedRootCertificates)));
+  }
+
+  static std::mutex sharesMutex;
+  static std::unordered_map<std::string, std::shared_ptr<CurlShare>> shares;
+
+  std::lock_guard<std::mutex> lock(sharesMutex);
+  auto found = shares.find(key);
+  if (found != shares.end())
+  {
+    return found->second;
+  }
+
+  std::shared_ptr<CurlShare> share(new CurlShare());
+  if (!share->m_share.share_handle)
+  {
+    *outError = CURLSHE_NOMEM;
+    return nullptr;
+  }
+  if (!SetLibcurlShareOption(
+          share->m_share.share_handle, CURLSHOPT_LOCKFUNC, &CurlShare::LockCallback, outError)
+      || !SetLibcurlShareOption(
+          share->m_share.share_handle, CURLSHOPT_UNLOCKFUNC, &CurlShare::UnlockCallback, outError)
+      || !SetLibcurlShareOption(
+          share->m_share.share_handle, CURLSHOPT_USERDATA, share.get(), outError))
+  {
+    return nullptr;
+  }
+  if (options.EnableCurlSslCaching
+      && !SetLibcurlShareOption(
+          share->m_share.share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION, outError))
+  {
+    return nullptr;
+  }
+  if (options.EnableCurlDnsCaching
+      && !SetLibcurlShareOption(
+          share->m_share.share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS, outError))
+  {
+    return nullptr;
+  }
+
+  shares.emplace(std::move(key), share);
+  return share;
+}
+
+std::shared_ptr<CurlShare> CurlConnection::ConfigureShare(
+    Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName)
+{
+  CURLSHcode shResult;
+  auto share = CurlShare::Get(options, &shResult);
+  if (shResult != CURLSHE_OK)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_share_strerror(shResult)));
+  }
+
+  CURLcode result;
+  if (share && !SetLibcurlOption(handle, CURLOPT_SHARE, share->GetHandle(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+  return share;
+}
+
+namespace {
+// Aborts opening a connection once the context, passed as clientp, is cancelled. libcurl calls it
+// about once per second while connecting.
+int CurlConnectProgressCallback(void* clientp, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+{
+  return static_cast<Context const*>(clientp)->IsCancelled() ? 1 : 0;
+}
+} // namespace
+
+CurlConnection::CurlConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionPropertiesKey,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context)
+    : m_connectionKey(connectionPropertiesKey)
+{
+  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
+  if (!m_handle)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string("curl_easy_init returned Null"));
+  }
+  CURLcode result;
+
+  if (!options.EnableCurlSslCaching)
+  {
+    // Disable SSL session ID caching
+    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_SESSIONID_CACHE, 0L, &result))
     {
-      throw Http::TransportException(
+      throw Azure::Core::Http::TransportException(
           _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-          + std::string(curl_easy_strerror(performResult)));
+          + std::string(curl_easy_strerror(result)));
     }
   }
 
-  //   Get the socket that libcurl is using from handle. Will use this to wait while
-  // reading/writing
-  // into wire
-#if defined(_MSC_VER)
+  m_share = ConfigureShare(m_handle, options, hostDisplayName);
+
+  ConfigureHandle(m_handle, request, options, hostDisplayName, connectionTimeoutOverride);
+
+  if (!SetLibcurlOption(m_handle, CURLOPT_CONNECT_ONLY, 1L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+#if !defined(AZ_PLATFORM_WINDOWS) && !defined(AZ_PLATFORM_MAC)
+  if (options.SslOptions.EnableCertificateRevocationListCheck)
+  {
+    if (!SetLibcurlOption(
+            m_handle, CURLOPT_SSL_CTX_FUNCTION, CurlConnection::CurlSslCtxCallback, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+          + ". Failed to set SSL context callback. " + std::string(curl_easy_strerror(result)));
+    }
+    if (!SetLibcurlOption(m_handle, CURLOPT_SSL_CTX_DATA, this, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+          + ". Failed to set SSL context callback data. "
+          + std::string(curl_easy_strerror(result)));
+    }
+    //          if (!SetLibcurlOption(m_handle, CURLOPT_SSL_VERIFYSTATUS, 1, &result))
+    //          {
+    //            throw TransportException(
+    //                _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName
+    //                + ". Failed to enable OCSP chaining. " +
+    //                std::string(curl_easy_strerror(result)));
+    //          }
+  }
+  m_allowFailedCrlRetrieval = options.SslOptions.AllowFailedCrlRetrieval;
+#endif
+  m_enableCrlValidation = options.SslOptions.EnableCertificateRevocationListCheck;
+
+  if (!SetLibcurlOption(m_handle, CURLOPT_XFERINFOFUNCTION, CurlConnectProgressCallback, &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_XFERINFODATA, const_cast<Context*>(&context), &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_NOPROGRESS, 0L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  auto performResult = curl_easy_perform(m_handle.get());
+  // The context is only used while connecting.
+  SetLibcurlOption(m_handle, CURLOPT_NOPROGRESS, 1L, &result);
+  SetLibcurlOption(m_handle, CURLOPT_XFERINFODATA, static_cast<void*>(nullptr), &result);
+  if (performResult == CURLE_ABORTED_BY_CALLBACK)
+  {
+    context.ThrowIfCancelled();
+  }
+  if (performResult != CURLE_OK)
+  {
+#if defined(AZ_PLATFORM_LINUX)
+    if (performResult == CURLE_PEER_FAILED_VERIFICATION)
+    {
+      curl_easy_getinfo(m_handle.get(), CURLINFO_SSL_VERIFYRESULT, &result);
+      throw Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string(curl_easy_strerror(performResult))
+          + ". Underlying error: " + X509_verify_cert_error_string(result));
+    }
+    else
+#endif
+    {
+      throw Http::TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+          + std::string(curl_easy_strerror(performResult)));
+    }
+  }
+
+  //   Get the socket that libcurl is using from handle. Will use this to wait while
+  // reading/writing
+  // into wire
+#if defined(_MSC_VER)
 #pragma warning(push)
 // C26812: The enum type 'CURLcode' is un-scoped. Prefer 'enum class' over 'enum' (Enum.3)
 #pragma warning(disable : 26812)
@@ -2679,3 +3332,1016 @@ CurlConnection::CurlConnection(
         + std::string(curl_easy_strerror(result)));
   }
 }
+
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED)
+using Azure::Core::Http::_detail::CurlMultiBodyStream;
+using Azure::Core::Http::_detail::CurlMultiEventLoop;
+using Azure::Core::Http::_detail::CurlMultiTransfer;
+
+// The event loop is defined after the connection pool so it is destroyed before the pool calls
+// `curl_global_cleanup()`.
+Azure::Core::Http::_detail::CurlMultiEventLoop
+    Azure::Core::Http::_detail::CurlMultiEventLoop::g_curlMultiEventLoop;
+
+CurlMultiTransfer::CurlMultiTransfer(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context)
+    : m_uploadStream(request.GetBodyStream()), m_context(context),
+      m_isHeadRequest(request.GetMethod() == HttpMethod::Head)
+{
+  std::string const hostDisplayName = GetHostDisplayName(request.GetUrl());
+
+  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
+  if (!m_handle)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string("curl_easy_init returned Null"));
+  }
+
+  CurlConnection::ConfigureHandle(
+      m_handle, request, options, hostDisplayName, connectionTimeoutOverride);
+
+  CURLcode result;
+  if (!options.EnableCurlSslCaching
+      && !SetLibcurlOption(m_handle, CURLOPT_SSL_SESSIONID_CACHE, 0L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  m_share = CurlConnection::ConfigureShare(m_handle, options, hostDisplayName);
+
+  // The connections are cached by the multi handle. Keep-alive disabled means the connection is
+  // closed as soon as the request is completed.
+  if (!options.HttpKeepAlive && !SetLibcurlOption(m_handle, CURLOPT_FORBID_REUSE, 1L, &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  // Request headers. libcurl removes a header when its value is empty, unless it is terminated
+  // with a semicolon.
+  for (auto const& header : request.GetHeaders())
+  {
+    std::string const headerLine = header.second.empty()
+        ? header.first + ";"
+        : header.first + ": " + header.second;
+    auto headers = curl_slist_append(m_headers.get(), headerLine.c_str());
+    if (headers == nullptr)
+    {
+      throw Azure::Core::Http::TransportException(
+          "Error while sending request. Failed to add header: " + header.first);
+    }
+    m_headers.release();
+    m_headers.reset(headers);
+  }
+
+  auto const& method = request.GetMethod();
+  bool const hasBody = m_uploadStream != nullptr
+      && (m_uploadStream->Length() > 0 || method == HttpMethod::Put || method == HttpMethod::Post
+          || method == HttpMethod::Patch);
+  if (!hasBody)
+  {
+    m_uploadStream = nullptr;
+  }
+
+  if (!SetLibcurlOption(m_handle, CURLOPT_HTTPHEADER, m_headers.get(), &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_HEADERFUNCTION, HeaderCallback, &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_HEADERDATA, this, &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_WRITEFUNCTION, WriteCallback, &result)
+      || !SetLibcurlOption(m_handle, CURLOPT_WRITEDATA, this, &result)
+      || (method == HttpMethod::Get && !SetLibcurlOption(m_handle, CURLOPT_HTTPGET, 1L, &result))
+      || (method == HttpMethod::Head && !SetLibcurlOption(m_handle, CURLOPT_NOBODY, 1L, &result))
+      || (method != HttpMethod::Get && method != HttpMethod::Head
+          && !SetLibcurlOption(
+              m_handle, CURLOPT_CUSTOMREQUEST, method.ToString().c_str(), &result)))
+  {
+    throw Azure::Core::Http::TransportException(
+        "Error while sending request. " + std::string(curl_easy_strerror(result)));
+  }
+
+  if (hasBody
+      && (!SetLibcurlOption(m_handle, CURLOPT_UPLOAD, 1L, &result)
+          || !SetLibcurlOption(
+              m_handle,
+              CURLOPT_INFILESIZE_LARGE,
+              static_cast<curl_off_t>(m_uploadStream->Length()),
+              &result)
+          || !SetLibcurlOption(m_handle, CURLOPT_READFUNCTION, ReadCallback, &result)
+          || !SetLibcurlOption(m_handle, CURLOPT_READDATA, this, &result)
+          || !SetLibcurlOption(m_handle, CURLOPT_SEEKFUNCTION, SeekCallback, &result)
+          || !SetLibcurlOption(m_handle, CURLOPT_SEEKDATA, this, &result)))
+  {
+    throw Azure::Core::Http::TransportException(
+        "Error while sending request. " + std::string(curl_easy_strerror(result)));
+  }
+}
+
+size_t CurlMultiTransfer::HeaderCallback(char* data, size_t size, size_t count, void* userp)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userp);
+  auto const length = size * count;
+  try
+  {
+    transfer->OnHeader(
+        reinterpret_cast<uint8_t const*>(data), reinterpret_cast<uint8_t const*>(data) + length);
+  }
+  catch (...)
+  {
+    // Returning a different value than the size of the data makes libcurl fail the transfer.
+    return 0;
+  }
+  return length;
+}
+
+void CurlMultiTransfer::OnHeader(uint8_t const* begin, uint8_t const* end)
+{
+  // Remove the CRLF at the end of the header line
+  while (end > begin && (*(end - 1) == '\n' || *(end - 1) == '\r'))
+  {
+    --end;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_headersCompleted)
+  {
+    // trailers from a chunked response are ignored.
+    return;
+  }
+
+  if (end - begin > 5 && std::equal(begin, begin + 5, "HTTP/"))
+  {
+    // Status line. libcurl reports the interim responses (i.e. 100-continue) too, so there might
+    // be more than one status line for a request.
+    m_response = CreateHTTPResponse(begin, end);
+    return;
+  }
+
+  if (!m_response)
+  {
+    throw TransportException("Unexpected format in HTTP response. Missing status line.");
+  }
+
+  if (begin != end)
+  {
+    Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(*m_response, begin, end);
+    return;
+  }
+
+  // End of headers
+  auto const statusCode
+      = static_cast<std::underlying_type<Http::HttpStatusCode>::type>(m_response->GetStatusCode());
+  if (statusCode < 200)
+  {
+    // Interim response, the final response comes next.
+    m_response.reset();
+    return;
+  }
+
+  // For Head request, NoContent and NotModified, the server doesn't send a body even if there's a
+  // content-length header.
+  if (m_isHeadRequest || m_response->GetStatusCode() == HttpStatusCode::NoContent
+      || m_response->GetStatusCode() == HttpStatusCode::NotModified)
+  {
+    m_contentLength = 0;
+  }
+  else
+  {
+    auto const& headers = m_response->GetHeaders();
+    auto contentLengthHeader = headers.find("content-length");
+    if (contentLengthHeader != headers.end())
+    {
+      m_contentLength = static_cast<int64_t>(std::stoull(contentLengthHeader->second));
+    }
+  }
+
+  m_headersCompleted = true;
+  m_stateChanged.notify_all();
+
+  if (m_callback)
+  {
+    // Like the transport policy does, error responses are always downloaded to the buffer.
+    m_bufferResponse = m_bufferResponse || statusCode >= 300;
+    if (!m_bufferResponse)
+    {
+      // The callback can't be invoked from within the libcurl callback.
+      CurlMultiEventLoop::g_curlMultiEventLoop.m_readyTransfers.push_back(shared_from_this());
+    }
+  }
+}
+
+size_t CurlMultiTransfer::WriteCallback(char* data, size_t size, size_t count, void* userp)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userp);
+  auto const length = size * count;
+
+  std::lock_guard<std::mutex> lock(transfer->m_mutex);
+  if (transfer->m_cancelled)
+  {
+    return 0;
+  }
+
+  auto const unread = transfer->m_body.size() - transfer->m_bodyStart;
+  if (!transfer->m_bufferResponse && unread > 0
+      && unread + length > _detail::DefaultMultiTransferBufferSize)
+  {
+    // libcurl keeps the data and delivers it again once the transfer is resumed by the reader.
+    transfer->m_paused = true;
+    return CURL_WRITEFUNC_PAUSE;
+  }
+
+  if (transfer->m_bodyStart > 0)
+  {
+    // Compact the buffer before appending, so it doesn't grow over the limit.
+    transfer->m_body.erase(
+        transfer->m_body.begin(),
+        transfer->m_body.begin() + static_cast<std::ptrdiff_t>(transfer->m_bodyStart));
+    transfer->m_bodyStart = 0;
+  }
+  transfer->m_body.insert(
+      transfer->m_body.end(),
+      reinterpret_cast<uint8_t const*>(data),
+      reinterpret_cast<uint8_t const*>(data) + length);
+  transfer->m_stateChanged.notify_all();
+  return length;
+}
+
+size_t CurlMultiTransfer::ReadCallback(char* buffer, size_t size, size_t count, void* userp)
+{
+  auto transfer = static_cast<CurlMultiTransfer*>(userp);
+
+  size_t length = 0;
+  bool postUploadTask = false;
+  {
+    std::lock_guard<std::mutex> lock(transfer->m_mutex);
+    if (transfer->m_cancelled || transfer->m_uploadStream == nullptr || transfer->m_uploadError)
+    {
+      return CURL_READFUNC_ABORT;
+    }
+
+    auto const& view = transfer->m_uploadView;
+    auto const unsent = view.Size - transfer->m_uploadStart;
+    if (unsent == 0 && !transfer->m_uploadEnded)
+    {
+      // The body stream might block, so libcurl waits for the upload task to read the next chunk.
+      transfer->m_uploadPaused = true;
+      postUploadTask = transfer->StartReadingUploadChunk();
+      length = CURL_READFUNC_PAUSE;
+    }
+    else if (unsent > 0)
+    {
+      length = (std::min)(unsent, size * count);
+      std::memcpy(buffer, view.Data + transfer->m_uploadStart, length);
+      transfer->m_uploadStart += length;
+      if (transfer->m_uploadStart == view.Size)
+      {
+        // Read the next chunk while libcurl sends this one.
+        postUploadTask = transfer->StartReadingUploadChunk();
+      }
+    }
+  }
+
+  if (postUploadTask)
+  {
+    transfer->PostUploadTask();
+  }
+  return length;
+}
+
+int CurlMultiTransfer::SeekCallback(void* userp, curl_off_t offset, int origin)
+{
+  // libcurl only needs to rewind the request body, when it re-sends the request on a new connection
+  // because a cached one was found dead.
+  auto transfer = static_cast<CurlMultiTransfer*>(userp);
+
+  std::lock_guard<std::mutex> lock(transfer->m_mutex);
+  if (offset != 0 || origin != SEEK_SET || transfer->m_uploadStream == nullptr)
+  {
+    return CURL_SEEKFUNC_CANTSEEK;
+  }
+
+  // The upload task rewinds the body stream before it reads the first chunk again.
+  transfer->m_uploadRewind = true;
+  transfer->m_uploadView = Azure::Core::IO::BodyStreamView{};
+  transfer->m_uploadStart = 0;
+  transfer->m_uploadEnded = false;
+  return CURL_SEEKFUNC_OK;
+}
+
+bool CurlMultiTransfer::StartReadingUploadChunk()
+{
+  if (m_uploadReading || m_uploadEnded || m_uploadStream == nullptr || m_cancelled)
+  {
+    return false;
+  }
+  m_uploadReading = true;
+  return true;
+}
+
+void CurlMultiTransfer::PostUploadTask()
+{
+  auto transfer = shared_from_this();
+  Azure::Core::_detail::AsyncTaskScheduler::Post(
+      [transfer](std::exception_ptr error) { transfer->ReadUploadChunk(error); });
+}
+
+void CurlMultiTransfer::ReadFirstUploadChunk()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!StartReadingUploadChunk())
+    {
+      return;
+    }
+  }
+  ReadUploadChunk(nullptr);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_uploadError)
+  {
+    std::rethrow_exception(m_uploadError);
+  }
+}
+
+void CurlMultiTransfer::ReadUploadChunk(std::exception_ptr error)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!error && m_uploadStream != nullptr && !m_cancelled)
+  {
+    auto uploadStream = m_uploadStream;
+    bool const rewind = m_uploadRewind;
+    m_uploadRewind = false;
+    lock.unlock();
+
+    Azure::Core::IO::BodyStreamView view;
+    try
+    {
+      if (rewind)
+      {
+        uploadStream->Rewind();
+      }
+      view = uploadStream->ReadView(_detail::DefaultUploadChunkSize, m_context);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if (m_uploadRewind)
+    {
+      // libcurl rewound the request body meanwhile, the chunk is not the one it expects.
+      error = nullptr;
+      continue;
+    }
+    if (!error)
+    {
+      m_uploadView = view;
+      m_uploadStart = 0;
+      m_uploadEnded = view.Size == 0;
+    }
+    break;
+  }
+
+  if (error)
+  {
+    // Re-thrown to the thread waiting for the response.
+    m_uploadError = error;
+  }
+  m_uploadReading = false;
+  m_stateChanged.notify_all();
+
+  // The callback of an asynchronous transfer is not invoked while its request body is read.
+  bool const resume = m_uploadPaused || (m_callback && (m_headersCompleted || m_completed));
+  m_uploadPaused = false;
+  lock.unlock();
+
+  if (resume)
+  {
+    CurlMultiEventLoop::g_curlMultiEventLoop.Resume(shared_from_this());
+  }
+}
+
+void CurlMultiTransfer::ReleaseUploadStream(std::unique_lock<std::mutex>& lock)
+{
+  m_uploadStream = nullptr;
+  m_stateChanged.wait(lock, [this]() { return !m_uploadReading; });
+}
+
+void CurlMultiTransfer::Complete(CURLcode result)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_completed = true;
+  m_result = result;
+  m_stateChanged.notify_all();
+
+  if (m_callback)
+  {
+    CurlMultiEventLoop::g_curlMultiEventLoop.m_readyTransfers.push_back(shared_from_this());
+  }
+}
+
+void CurlMultiTransfer::InvokeCallback()
+{
+  SendAsyncCallback callback;
+  std::unique_ptr<RawResponse> response;
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_callback || (!m_completed && (!m_headersCompleted || m_bufferResponse)))
+    {
+      // Already invoked, or the response is not ready yet.
+      return;
+    }
+    if (m_uploadReading)
+    {
+      // The upload task hands the transfer back to the event loop once it is done.
+      return;
+    }
+
+    // The request might not outlive the response, so the upload must be done by now.
+    m_uploadStream = nullptr;
+
+    if (m_uploadError)
+    {
+      error = m_uploadError;
+    }
+    else if (m_completed && m_result == CURLE_ABORTED_BY_CALLBACK && m_context.IsCancelled())
+    {
+      error = std::make_exception_ptr(
+          Azure::Core::OperationCancelledException("Request was cancelled by context."));
+    }
+    else if (!m_headersCompleted || (m_bufferResponse && m_result != CURLE_OK))
+    {
+      error = std::make_exception_ptr(TransportException(
+          "Error while sending request. "
+          + std::string(
+              m_result != CURLE_OK ? curl_easy_strerror(m_result)
+                                   : "Connection closed before getting the response headers.")));
+    }
+    else
+    {
+      response = std::move(m_response);
+      if (m_bufferResponse)
+      {
+        response->SetBody(std::move(m_body));
+        m_body.clear();
+        m_bodyStart = 0;
+      }
+    }
+
+    callback = std::move(m_callback);
+    m_callback = nullptr;
+  }
+
+  if (response && !m_bufferResponse)
+  {
+    response->SetBodyStream(std::make_unique<CurlMultiBodyStream>(shared_from_this()));
+  }
+
+  try
+  {
+    callback(std::move(response), error);
+  }
+  catch (std::exception const& e)
+  {
+    Log::Write(
+        Logger::Level::Error,
+        LogMsgPrefix + "Unhandled error in the callback of an async request: " + e.what());
+  }
+  catch (...)
+  {
+    Log::Write(
+        Logger::Level::Error,
+        LogMsgPrefix + "Unhandled error in the callback of an async request.");
+  }
+}
+
+void CurlMultiTransfer::WaitForStateChange(
+    std::unique_lock<std::mutex>& lock,
+    Context const& context)
+{
+  m_stateChanged.wait_for(lock, _detail::DefaultMultiTransferWaitInterval);
+  if (context.IsCancelled())
+  {
+    m_cancelled = true;
+    lock.unlock();
+    CurlMultiEventLoop::g_curlMultiEventLoop.Cancel(shared_from_this());
+    context.ThrowIfCancelled();
+  }
+}
+
+std::unique_ptr<RawResponse> CurlMultiTransfer::WaitForResponse(Context const& context)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  try
+  {
+    while (!m_headersCompleted && !m_completed)
+    {
+      WaitForStateChange(lock, context);
+    }
+  }
+  catch (...)
+  {
+    if (!lock.owns_lock())
+    {
+      lock.lock();
+    }
+    ReleaseUploadStream(lock);
+    throw;
+  }
+
+  // The request might not outlive the response, so the upload must be done by now.
+  ReleaseUploadStream(lock);
+
+  if (m_uploadError)
+  {
+    std::rethrow_exception(m_uploadError);
+  }
+  if (!m_headersCompleted)
+  {
+    throw TransportException(
+        "Error while sending request. "
+        + std::string(
+            m_result != CURLE_OK ? curl_easy_strerror(m_result)
+                                 : "Connection closed before getting the response headers."));
+  }
+  return std::move(m_response);
+}
+
+size_t CurlMultiTransfer::ReadBody(uint8_t* buffer, size_t count, Context const& context)
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (m_bodyStart == m_body.size() && !m_completed)
+  {
+    if (m_paused)
+    {
+      // Nothing left to read, let libcurl deliver the data it is holding.
+      m_paused = false;
+      lock.unlock();
+      CurlMultiEventLoop::g_curlMultiEventLoop.Resume(shared_from_this());
+      lock.lock();
+      continue;
+    }
+    WaitForStateChange(lock, context);
+  }
+
+  auto const unread = m_body.size() - m_bodyStart;
+  if (unread == 0)
+  {
+    if (m_result != CURLE_OK)
+    {
+      throw TransportException(
+          "Error while reading from network socket. CURLE code: " + std::to_string(m_result)
+          + ". " + std::string(curl_easy_strerror(m_result)));
+    }
+    return 0;
+  }
+
+  auto const bytesToCopy = (std::min)(unread, count);
+  std::copy(
+      m_body.begin() + static_cast<std::ptrdiff_t>(m_bodyStart),
+      m_body.begin() + static_cast<std::ptrdiff_t>(m_bodyStart + bytesToCopy),
+      buffer);
+  m_bodyStart += bytesToCopy;
+  if (m_bodyStart == m_body.size())
+  {
+    m_body.clear();
+    m_bodyStart = 0;
+  }
+  return bytesToCopy;
+}
+
+CurlMultiBodyStream::~CurlMultiBodyStream()
+{
+  // An abandoned transfer can't be re-used. Removing it from the multi handle closes its
+  // connection.
+  if (!m_transfer->IsCompleted())
+  {
+    CurlMultiEventLoop::g_curlMultiEventLoop.Cancel(m_transfer);
+  }
+}
+
+CurlMultiEventLoop::~CurlMultiEventLoop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_commandsMutex);
+    m_stop = true;
+  }
+  if (m_thread.joinable())
+  {
+    Wakeup();
+    m_thread.join();
+  }
+  for (auto& transfer : m_activeTransfers)
+  {
+    curl_multi_remove_handle(m_multiHandle, transfer.first);
+  }
+  m_activeTransfers.clear();
+  if (m_multiHandle != nullptr)
+  {
+    curl_multi_cleanup(m_multiHandle);
+  }
+#if defined(AZ_PLATFORM_LINUX)
+  if (m_epollFd >= 0)
+  {
+    close(m_epollFd);
+  }
+  if (m_wakeupFd >= 0)
+  {
+    close(m_wakeupFd);
+  }
+#endif
+}
+
+std::unique_ptr<RawResponse> CurlMultiEventLoop::Send(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context)
+{
+  context.ThrowIfCancelled();
+
+  auto transfer
+      = std::make_shared<CurlMultiTransfer>(request, options, connectionTimeoutOverride, context);
+  transfer->ReadFirstUploadChunk();
+
+  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Adding request to the event loop.");
+  PostCommand(CommandType::Add, transfer);
+
+  std::unique_ptr<RawResponse> response;
+  try
+  {
+    response = transfer->WaitForResponse(context);
+  }
+  catch (...)
+  {
+    Cancel(transfer);
+    throw;
+  }
+
+  Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Response headers received from event loop.");
+  response->SetBodyStream(std::make_unique<CurlMultiBodyStream>(std::move(transfer)));
+  return response;
+}
+
+void CurlMultiEventLoop::SendAsync(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::chrono::milliseconds connectionTimeoutOverride,
+    Context const& context,
+    SendAsyncCallback callback)
+{
+  try
+  {
+    context.ThrowIfCancelled();
+
+    auto transfer
+        = std::make_shared<CurlMultiTransfer>(request, options, connectionTimeoutOverride, context);
+    transfer->ReadFirstUploadChunk();
+    transfer->m_callback = callback;
+    transfer->m_bufferResponse = request.ShouldBufferResponse();
+
+    Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Adding async request to the event loop.");
+    PostCommand(CommandType::Add, std::move(transfer));
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+  }
+}
+
+void CurlMultiEventLoop::Cancel(std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  PostCommand(CommandType::Remove, std::move(transfer));
+}
+
+void CurlMultiEventLoop::Resume(std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  PostCommand(CommandType::Resume, std::move(transfer));
+}
+
+void CurlMultiEventLoop::PostCommand(
+    CommandType type,
+    std::shared_ptr<CurlMultiTransfer> transfer)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_commandsMutex);
+    if (m_stop)
+    {
+      if (type == CommandType::Add)
+      {
+        throw TransportException("Error while sending request. The event loop was stopped.");
+      }
+      // Nothing left to cancel or resume.
+      return;
+    }
+
+    // The event loop thread is started with the first request.
+    if (!m_thread.joinable())
+    {
+      m_multiHandle = curl_multi_init();
+      if (m_multiHandle == nullptr)
+      {
+        throw TransportException(
+            "Error while sending request. curl_multi_init returned Null");
+      }
+#if defined(AZ_PLATFORM_LINUX)
+      m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+      m_wakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (m_epollFd < 0 || m_wakeupFd < 0)
+      {
+        throw TransportException(
+            "Error while sending request. Failed to create the event loop descriptors.");
+      }
+      epoll_event wakeupEvent{};
+      wakeupEvent.events = EPOLLIN;
+      wakeupEvent.data.fd = m_wakeupFd;
+      if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeupFd, &wakeupEvent) != 0
+          || curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETFUNCTION, SocketCallback) != CURLM_OK
+          || curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETDATA, this) != CURLM_OK
+          || curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERFUNCTION, TimerCallback) != CURLM_OK
+          || curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERDATA, this) != CURLM_OK)
+      {
+        throw TransportException(
+            "Error while sending request. Failed to set up the event loop.");
+      }
+#endif
+      Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Start event loop thread");
+      m_thread = std::thread([this]() { Run(); });
+    }
+
+    m_commands.emplace_back(type, std::move(transfer));
+  }
+  Wakeup();
+}
+
+void CurlMultiEventLoop::Wakeup()
+{
+#if defined(AZ_PLATFORM_LINUX)
+  uint64_t const signal = 1;
+  // A failure means the counter is already signaled.
+  static_cast<void>(write(m_wakeupFd, &signal, sizeof(signal)));
+#else
+  curl_multi_wakeup(m_multiHandle);
+#endif
+}
+
+bool CurlMultiEventLoop::ProcessCommands()
+{
+  decltype(m_commands) commands;
+  {
+    std::lock_guard<std::mutex> lock(m_commandsMutex);
+    if (m_stop)
+    {
+      return false;
+    }
+    commands.swap(m_commands);
+  }
+
+  for (auto& command : commands)
+  {
+    CURL* handle = command.second->m_handle.get();
+    switch (command.first)
+    {
+      case CommandType::Add: {
+        auto const result = curl_multi_add_handle(m_multiHandle, handle);
+        if (result != CURLM_OK)
+        {
+          command.second->Complete(CURLE_FAILED_INIT);
+          break;
+        }
+        m_activeTransfers.emplace(handle, std::move(command.second));
+        break;
+      }
+      case CommandType::Remove: {
+        auto activeTransfer = m_activeTransfers.find(handle);
+        if (activeTransfer != m_activeTransfers.end())
+        {
+          curl_multi_remove_handle(m_multiHandle, handle);
+          m_activeTransfers.erase(activeTransfer);
+          command.second->Complete(CURLE_ABORTED_BY_CALLBACK);
+        }
+        break;
+      }
+      case CommandType::Resume: {
+        if (m_activeTransfers.find(handle) != m_activeTransfers.end())
+        {
+          curl_easy_pause(handle, CURLPAUSE_CONT);
+        }
+        if (command.second->IsWaitingForCallback())
+        {
+          // Its callback might have been held back while the request body was read.
+          m_readyTransfers.push_back(std::move(command.second));
+        }
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+void CurlMultiEventLoop::ProcessCompletedTransfers()
+{
+  int messagesInQueue = 0;
+  while (CURLMsg* message = curl_multi_info_read(m_multiHandle, &messagesInQueue))
+  {
+    if (message->msg != CURLMSG_DONE)
+    {
+      continue;
+    }
+    CURL* handle = message->easy_handle;
+    CURLcode const result = message->data.result;
+    curl_multi_remove_handle(m_multiHandle, handle);
+
+    auto activeTransfer = m_activeTransfers.find(handle);
+    if (activeTransfer != m_activeTransfers.end())
+    {
+      activeTransfer->second->Complete(result);
+      m_activeTransfers.erase(activeTransfer);
+    }
+  }
+}
+
+void CurlMultiEventLoop::RemoveCancelledTransfers()
+{
+  // The waiting threads check the context of the synchronous transfers. Nobody waits for the
+  // asynchronous ones, so the event loop checks them at the same interval.
+  auto const now = std::chrono::steady_clock::now();
+  if (now < m_nextCancellationCheck)
+  {
+    return;
+  }
+  m_nextCancellationCheck = now + _detail::DefaultMultiTransferWaitInterval;
+
+  for (auto activeTransfer = m_activeTransfers.begin(); activeTransfer != m_activeTransfers.end();)
+  {
+    auto& transfer = activeTransfer->second;
+    if (transfer->m_context.IsCancelled() && transfer->IsWaitingForCallback())
+    {
+      curl_multi_remove_handle(m_multiHandle, activeTransfer->first);
+      transfer->Complete(CURLE_ABORTED_BY_CALLBACK);
+      activeTransfer = m_activeTransfers.erase(activeTransfer);
+    }
+    else
+    {
+      ++activeTransfer;
+    }
+  }
+}
+
+void CurlMultiEventLoop::InvokeCallbacks()
+{
+  // The callbacks might send new requests, which are added on the next iteration of the loop.
+  while (!m_readyTransfers.empty())
+  {
+    decltype(m_readyTransfers) readyTransfers;
+    readyTransfers.swap(m_readyTransfers);
+    for (auto& transfer : readyTransfers)
+    {
+      transfer->InvokeCallback();
+    }
+  }
+}
+
+#if defined(AZ_PLATFORM_LINUX)
+int CurlMultiEventLoop::SocketCallback(
+    CURL*,
+    curl_socket_t socket,
+    int what,
+    void* userp,
+    void* socketp)
+{
+  auto eventLoop = static_cast<CurlMultiEventLoop*>(userp);
+  if (what == CURL_POLL_REMOVE)
+  {
+    // The socket might be closed already, in which case it was removed from the epoll set.
+    epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_DEL, socket, nullptr);
+    return 0;
+  }
+
+  epoll_event socketEvent{};
+  socketEvent.data.fd = socket;
+  socketEvent.events = 0;
+  if (what & CURL_POLL_IN)
+  {
+    socketEvent.events |= EPOLLIN;
+  }
+  if (what & CURL_POLL_OUT)
+  {
+    socketEvent.events |= EPOLLOUT;
+  }
+  if (socketp == nullptr)
+  {
+    epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_ADD, socket, &socketEvent);
+    // Any non-null value marks the socket as registered in the epoll set.
+    curl_multi_assign(eventLoop->m_multiHandle, socket, eventLoop);
+  }
+  else
+  {
+    epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_MOD, socket, &socketEvent);
+  }
+  return 0;
+}
+
+int CurlMultiEventLoop::TimerCallback(CURLM*, long timeoutMs, void* userp)
+{
+  auto eventLoop = static_cast<CurlMultiEventLoop*>(userp);
+  eventLoop->m_timerSet = timeoutMs >= 0;
+  if (eventLoop->m_timerSet)
+  {
+    eventLoop->m_timerDeadline
+        = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  }
+  return 0;
+}
+
+void CurlMultiEventLoop::Run()
+{
+  std::vector<epoll_event> events(_detail::DefaultMultiEventLoopMaxEvents);
+  while (ProcessCommands())
+  {
+    int waitTimeoutMs = -1;
+    if (m_timerSet)
+    {
+      auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+          m_timerDeadline - std::chrono::steady_clock::now());
+      waitTimeoutMs = remaining.count() > 0 ? static_cast<int>(remaining.count()) : 0;
+    }
+    if (!m_activeTransfers.empty()
+        && (waitTimeoutMs < 0 || waitTimeoutMs > _detail::DefaultMultiTransferWaitInterval.count()))
+    {
+      // Wake up to check the asynchronous transfers for cancellation.
+      waitTimeoutMs = static_cast<int>(_detail::DefaultMultiTransferWaitInterval.count());
+    }
+    if (!m_readyTransfers.empty())
+    {
+      // A command made the response of a transfer ready, its callback is invoked right away.
+      waitTimeoutMs = 0;
+    }
+
+    int const eventCount = epoll_wait(
+        m_epollFd, events.data(), static_cast<int>(events.size()), waitTimeoutMs);
+    if (eventCount < 0 && errno != EINTR)
+    {
+      // Should not happen with valid descriptors, avoid spinning if it does.
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    int runningTransfers = 0;
+    for (int index = 0; index < eventCount; index++)
+    {
+      auto const& event = events[static_cast<size_t>(index)];
+      if (event.data.fd == m_wakeupFd)
+      {
+        uint64_t signal = 0;
+        static_cast<void>(read(m_wakeupFd, &signal, sizeof(signal)));
+        continue;
+      }
+      int const flags = ((event.events & EPOLLIN) ? CURL_CSELECT_IN : 0)
+          | ((event.events & EPOLLOUT) ? CURL_CSELECT_OUT : 0)
+          | ((event.events & (EPOLLERR | EPOLLHUP)) ? CURL_CSELECT_ERR : 0);
+      curl_multi_socket_action(m_multiHandle, event.data.fd, flags, &runningTransfers);
+    }
+
+    if (m_timerSet && std::chrono::steady_clock::now() >= m_timerDeadline)
+    {
+      m_timerSet = false;
+      curl_multi_socket_action(m_multiHandle, CURL_SOCKET_TIMEOUT, 0, &runningTransfers);
+    }
+
+    ProcessCompletedTransfers();
+    RemoveCancelledTransfers();
+    InvokeCallbacks();
+  }
+}
+#else
+void CurlMultiEventLoop::Run()
+{
+  while (ProcessCommands())
+  {
+    int runningTransfers = 0;
+    curl_multi_perform(m_multiHandle, &runningTransfers);
+    ProcessCompletedTransfers();
+    RemoveCancelledTransfers();
+    InvokeCallbacks();
+    curl_multi_poll(
+        m_multiHandle,
+        nullptr,
+        0,
+        static_cast<int>(_detail::DefaultMultiTransferWaitInterval.count()),
+        nullptr);
+  }
+}
+#endif // AZ_PLATFORM_LINUX
+#endif // _azure_CURL_MULTI_EVENT_LOOP_SUPPORTED
@@ -9,20 +9,24 @@
 
 #pragma once
 
+#include "azure/core/context.hpp"
 #include "azure/core/dll_import_export.hpp"
 #include "azure/core/http/http.hpp"
 #include "curl_connection_private.hpp"
 
 #include <azure/core/http/curl_transport.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #if defined(_azure_TESTING_BUILD)
 // Define the class name that reads from ConnectionPool private members
@@ -31,18 +35,29 @@ namespace Azure { namespace Core { namespace Test {
   class CurlConnectionPool_DISABLED_connectionPoolTest_Test;
   class CurlConnectionPool_uniquePort_Test;
   class CurlConnectionPool_connectionClose_Test;
+  class CurlConnectionPool_maxConnectionsPerHost_Test;
   class SdkWithLibcurl_globalCleanUp_Test;
 }}} // namespace Azure::Core::Test
 #endif
 
 namespace Azure { namespace Core { namespace Http { namespace _detail {
 
+  // Number of shards of the connection pool. Each shard has its own lock, so threads getting
+  // connections to different hosts don't wait for each other.
+  constexpr static size_t ConnectionPoolShardCount = 16;
+  // 1 sec -> the threads waiting for a connection to be released wake up at this interval to check
+  // for cancellation.
+  constexpr static std::chrono::milliseconds DefaultConnectionPoolWaitInterval
+      = std::chrono::milliseconds(1000);
+
   /**
    * @brief CURL HTTP connection pool makes it possible to re-use one curl connection to perform
    * more than one request. Use this component when connections are not re-used by default.
    *
    * This pool offers static methods and it is allocated statically. There can be only one
    * connection pool per application.
+   *
+   * @remark The pool is sharded by connection key, each shard having its own lock.
    */
   class CurlConnectionPool final {
 #if defined(_azure_TESTING_BUILD)
@@ -51,27 +66,13 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     friend class Azure::Core::Test::CurlConnectionPool_DISABLED_connectionPoolTest_Test;
     friend class Azure::Core::Test::CurlConnectionPool_uniquePort_Test;
     friend class Azure::Core::Test::CurlConnectionPool_connectionClose_Test;
+    friend class Azure::Core::Test::CurlConnectionPool_maxConnectionsPerHost_Test;
     friend class Azure::Core::Test::SdkWithLibcurl_globalCleanUp_Test;
 #endif
+    friend class Azure::Core::Http::CurlConnection;
 
   public:
-    ~CurlConnectionPool()
-    {
-      using namespace Azure::Core::Http::_detail;
-      if (m_cleanThread.joinable())
-      {
-        {
-          std::unique_lock<std::mutex> lock(ConnectionPoolMutex);
-          // Remove all connections
-          g_curlConnectionPool.ConnectionPoolIndex.clear();
-        }
-        // Signal clean thread to wake up
-        ConditionalVariableForCleanThread.notify_one();
-        // join thread
-        m_cleanThread.join();
-      }
-      curl_global_cleanup();
-    }
+    ~CurlConnectionPool();
 
     /**
      * @brief Finds a connection to be re-used from the connection pool.
@@ -84,6 +85,8 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
      * ConnectionTimeout value, specified in options.
      * @param resetPool Request the pool to remove all current connections for the provided
      * options to force the creation of a new connection.
+     * @param context A context to control the request lifetime, while waiting for a connection to
+     * be released when `options.MaxConnectionsPerHost` is reached.
      *
      * @return #Azure::Core::Http::CurlNetworkConnection to use.
      */
@@ -91,7 +94,8 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
         Request& request,
         CurlTransportOptions const& options,
         std::chrono::milliseconds connectionTimeoutOverride = std::chrono::milliseconds{0},
-        bool resetPool = false);
+        bool resetPool = false,
+        Context const& context = Context{});
 
     /**
      * @brief Moves a connection back to the pool to be re-used.
@@ -105,35 +109,171 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
         bool httpKeepAlive);
 
     /**
-     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     * @brief Reserves the connections to be opened in advance for \p request, so the pool has
+     * \p connectionCount idle connections for it.
      *
-     * @details This way getting a connection for a specific host can be done in O(1) instead of
-     * looping a single connection list to find the first connection for the required host.
+     * @remark The reservation is limited by `options.MaxIdleConnectionsPerHost` and
+     * `options.MaxConnectionsPerHost`, taking into account the existing connections.
      *
-     * @remark There might be multiple connections for each host.
+     * @param request HTTP request to reserve connections for.
+     * @param options The connection settings.
+     * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
+     * ConnectionTimeout value, specified in options.
+     * @param connectionCount The number of idle connections the pool should have for \p request.
+     *
+     * @return The number of connections reserved. Each of them must be opened with
+     * #OpenReservedConnection().
      */
-    std::unordered_map<std::string, std::list<std::unique_ptr<CurlNetworkConnection>>>
-        ConnectionPoolIndex;
+    size_t ReserveConnections(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        size_t connectionCount);
 
-    std::mutex ConnectionPoolMutex;
+    /**
+     * @brief Opens a connection reserved with #ReserveConnections() and moves it to the pool.
+     *
+     * @remark The reservation is released if the connection can't be opened.
+     *
+     * @param request HTTP request the connection was reserved for.
+     * @param options The connection settings the connection was reserved with.
+     * @param connectionTimeoutOverride The connection timeout override the connection was reserved
+     * with.
+     * @param context A context to cancel opening the connection.
+     */
+    void OpenReservedConnection(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        Context const& context);
 
-    // This is used to put the cleaning pool thread to sleep and yet to be able to wake it if the
-    // application finishes.
-    std::condition_variable ConditionalVariableForCleanThread;
+    /**
+     * @brief Runs \p work on \p threadCount threads owned by the pool, which joins them when it is
+     * destroyed.
+     *
+     * @remark Once the pool is being destroyed, \p work runs on the calling thread instead, with
+     * \p context cancelled.
+     *
+     * @param threadCount The number of threads to start.
+     * @param work The function run by each thread.
+     * @param context The context used by \p work, cancelled when the pool is destroyed, before
+     * the threads are joined, for \p work to return early.
+     */
+    void StartPrewarmThreads(
+        size_t threadCount,
+        std::function<void()> const& work,
+        Context context);
 
-    AZ_CORE_DLLEXPORT static Azure::Core::Http::_detail::CurlConnectionPool g_curlConnectionPool;
+    /**
+     * @brief Removes all the idle connections from the pool.
+     *
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of connection keys with idle connections in the pool.
+     *
+     */
+    size_t IndexCount();
 
-    bool IsCleanThreadRunning = false;
+    AZ_CORE_DLLEXPORT static Azure::Core::Http::_detail::CurlConnectionPool g_curlConnectionPool;
 
   private:
+    /**
+     * @brief The connections to one host, for one set of connection options.
+     *
+     */
+    struct HostIndex final
+    {
+      // The idle connections. Connections are added with push_front, so the most recently used
+      // connection is the first one to be re-used (LIFO) and the oldest one is at the end.
+      std::list<std::unique_ptr<CurlNetworkConnection>> Connections;
+      // The connections created by the pool for this index and not yet destroyed, idle or in use.
+      size_t OpenConnections = 0;
+      // The threads waiting for a connection to be released.
+      size_t Waiters = 0;
+      std::condition_variable ConnectionReleased;
+      // Taken from the options of the last request asking for a connection.
+      size_t MaxIdleConnections = DefaultMaxIdleConnectionsPerHost;
+      size_t MaxConnections = 0;
+      std::shared_ptr<CurlConnectionPoolMetrics> Metrics;
+
+      void SetOptions(CurlTransportOptions const& options)
+      {
+        MaxIdleConnections = options.MaxIdleConnectionsPerHost;
+        MaxConnections = options.MaxConnectionsPerHost;
+        Metrics = options.ConnectionPoolMetrics;
+      }
+    };
+
+    struct Shard final
+    {
+      std::mutex Mutex;
+      /**
+       * @brief Keeps a unique key for each host and creates a connection pool for each key.
+       *
+       * @details This way getting a connection for a specific host can be done in O(1) instead of
+       * looping a single connection list to find the first connection for the required host.
+       *
+       * @remark An index without connections, idle or in use, is removed when its last connection
+       * is closed or by the clean thread.
+       */
+      std::unordered_map<std::string, HostIndex> Index;
+    };
+
     // private constructor to keep this as singleton.
     CurlConnectionPool() { curl_global_init(CURL_GLOBAL_ALL); }
 
+    Shard& GetShard(std::string const& connectionKey)
+    {
+      return m_shards[std::hash<std::string>{}(connectionKey) % m_shards.size()];
+    }
+
+    // Creates a connection for which a slot was taken, releasing the slot if it fails.
+    std::unique_ptr<CurlNetworkConnection> CreateConnection(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::string const& hostDisplayName,
+        std::string const& connectionKey,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        Context const& context = Context{});
+
     // Makes possible to know the number of current connections in the connection pool for an
     // index
-    size_t ConnectionsOnPool(std::string const& host) { return ConnectionPoolIndex[host].size(); }
+    size_t ConnectionsOnPool(std::string const& connectionKey);
+
+    // Called by the destructor of the connections created by the pool.
+    void OnConnectionClosed(std::string const& connectionKey);
+
+    // Starts the clean thread, unless it is already running.
+    void StartCleanThread();
+
+    // Closes the expired connections periodically, until the pool is empty.
+    void CleanupThread();
 
+    // Cancels the contexts of the threads started by StartPrewarmThreads, and joins them.
+    void JoinPrewarmThreads();
+
+    std::array<Shard, ConnectionPoolShardCount> m_shards;
+
+    std::mutex m_cleanThreadMutex;
+    // This is used to put the cleaning pool thread to sleep and yet to be able to wake it if the
+    // application finishes.
+    std::condition_variable m_cleanThreadSignal;
+    std::atomic<bool> m_isCleanThreadRunning{false};
     std::thread m_cleanThread;
+
+    struct PrewarmThread final
+    {
+      std::thread Thread;
+      // Set by the thread once it is done, so that it can be joined without waiting.
+      std::shared_ptr<std::atomic<bool>> Done;
+      Context WorkContext;
+    };
+
+    std::mutex m_prewarmThreadsMutex;
+    std::vector<PrewarmThread> m_prewarmThreads;
+    bool m_isClosing = false;
   };
 
 }}}} // namespace Azure::Core::Http::_detail
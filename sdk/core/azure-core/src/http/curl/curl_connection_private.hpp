@@ -13,6 +13,8 @@
 #include "azure/core/internal/unique_handle.hpp"
 
 #include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #if defined(_MSC_VER)
@@ -43,6 +45,15 @@ namespace Azure { namespace Core {
       using type = _internal::BasicUniqueHandle<CURL, curl_easy_cleanup>;
     };
 
+    /**
+     * @brief  Unique handle for libcurl string lists.
+     *
+     */
+    template <> struct UniqueHandleHelper<curl_slist>
+    {
+      using type = _internal::BasicUniqueHandle<curl_slist, curl_slist_free_all>;
+    };
+
     /**
      *
      * @brief Unique handle wrapper for CURLSH handles.
@@ -76,7 +87,8 @@ namespace Azure { namespace Core {
       // libcurl CURL_MAX_WRITE_SIZE is 64k. Using same value for default uploading chunk size.
       // This can be customizable in the HttpRequest
       constexpr static size_t DefaultUploadChunkSize = 1024 * 64;
-      constexpr static size_t DefaultLibcurlReaderSize = 4 * 1024;
+      // Smallest read buffer used by a session, whatever the value of the transport options.
+      constexpr static size_t MinReadBufferSize = 1024;
       // Run time error template
       constexpr static const char* DefaultFailedToGetNewConnectionTemplate
           = "Fail to get a new connection for: ";
@@ -88,11 +100,50 @@ namespace Azure { namespace Core {
       constexpr static int32_t DefaultCleanerIntervalMilliseconds = 1000 * 90;
       // 60 sec -> expired connection is when it waits for 60 sec or more and it's not re-used
       constexpr static int32_t DefaultConnectionExpiredMilliseconds = 1000 * 60;
-      // Define the maximum allowed connections per host-index in the pool. If this number is
-      // reached for the host-index, next connections trying to be added to the pool will be
-      // ignored.
-      constexpr static int32_t MaxConnectionsPerIndex = 1024;
+      // Maximum number of threads opening connections in advance for one call to
+      // CurlTransport::PrewarmConnections().
+      constexpr static size_t MaxConnectionPrewarmThreads = 8;
 
+      /**
+       * @brief Process-wide libcurl share handle, through which the libcurl handles share the TLS
+       * sessions and the resolved host names.
+       *
+       * @remark There is one share handle for each set of TLS verification settings, so a
+       * session established with some settings is never resumed by a connection expecting
+       * different checks (e.g. CRL validation, which is not done again when resuming).
+       *
+       * @remark Every libcurl handle using the share handle keeps a reference to it, since the
+       * share handle can't be cleaned up while libcurl handles still use it.
+       */
+      class CurlShare final {
+      private:
+        Azure::Core::_detail::CURLSHWrapper m_share;
+        std::mutex m_locks[CURL_LOCK_DATA_LAST];
+
+        static void LockCallback(
+            CURL* handle,
+            curl_lock_data data,
+            curl_lock_access access,
+            void* userp);
+        static void UnlockCallback(CURL* handle, curl_lock_data data, void* userp);
+
+        CurlShare() = default;
+
+      public:
+        /**
+         * @brief Gets the share handle for the caching settings and TLS settings of \p options.
+         *
+         * @param options Connection options.
+         * @param outError Set to the libcurl error when the share handle can't be created.
+         * @return `nullptr` when \p options disables the TLS session and DNS caching, or when
+         * \p outError is set.
+         */
+        static std::shared_ptr<CurlShare> Get(
+            Azure::Core::Http::CurlTransportOptions const& options,
+            CURLSHcode* outError);
+
+        CURLSH* GetHandle() const { return m_share.share_handle; }
+      };
     } // namespace _detail
 
     /**
@@ -168,8 +219,9 @@ namespace Azure { namespace Core {
      */
     class CurlConnection final : public CurlNetworkConnection {
     private:
+      // Declared before the handle, which must be cleaned up first.
+      std::shared_ptr<_detail::CurlShare> m_share;
       Azure::Core::_internal::UniqueHandle<CURL> m_handle;
-      Azure::Core::_detail::UniqueCURLSHHandle m_sslShareHandle;
       curl_socket_t m_curlSocket;
       std::chrono::steady_clock::time_point m_lastUseTime;
       std::string m_connectionKey;
@@ -198,6 +250,7 @@ namespace Azure { namespace Core {
        * @param hostDisplayName Display name for remote host, used for diagnostics.
        * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
        * ConnectionTimeout value, specified in options.
+       * @param context A context to cancel opening the connection.
        *
        * @param connectionPropertiesKey CURL connection properties key
        */
@@ -206,13 +259,48 @@ namespace Azure { namespace Core {
           Azure::Core::Http::CurlTransportOptions const& options,
           std::string const& hostDisplayName,
           std::string const& connectionPropertiesKey,
+          std::chrono::milliseconds connectionTimeoutOverride,
+          Context const& context = Context{});
+
+      /**
+       * @brief Applies the libcurl options derived from \p options and \p request which are
+       * common to every libcurl handle created by the transport adapter (url, timeouts, proxy, TLS
+       * settings, etc.).
+       *
+       * @param handle The libcurl handle to configure.
+       * @param request Remote request
+       * @param options Connection options.
+       * @param hostDisplayName Display name for remote host, used for diagnostics.
+       * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
+       * ConnectionTimeout value, specified in options.
+       */
+      static void ConfigureHandle(
+          Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+          Azure::Core::Http::Request& request,
+          Azure::Core::Http::CurlTransportOptions const& options,
+          std::string const& hostDisplayName,
           std::chrono::milliseconds connectionTimeoutOverride);
 
+      /**
+       * @brief Makes \p handle use the process-wide TLS session and DNS caches selected by
+       * \p options.
+       *
+       * @param handle The libcurl handle to configure.
+       * @param options Connection options.
+       * @param hostDisplayName Display name for remote host, used for diagnostics.
+       * @return The share handle used by \p handle, which must outlive it. `nullptr` if none.
+       */
+      static std::shared_ptr<_detail::CurlShare> ConfigureShare(
+          Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+          Azure::Core::Http::CurlTransportOptions const& options,
+          std::string const& hostDisplayName);
+
       /**
        * @brief Destructor.
-       * @details Cleans up CURL (invokes `curl_easy_cleanup()`).
+       * @details Cleans up CURL (invokes `curl_easy_cleanup()`) and releases the slot taken by the
+       * connection on the connection pool.
        */
-      ~CurlConnection() override {}
+      ~CurlConnection() override;
 
       std::string const& GetConnectionKey() const override { return this->m_connectionKey; }
 
@@ -0,0 +1,367 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief The curl multi event loop drives many requests over the libcurl multi interface from a
+ * single background thread.
+ *
+ * @remark This is the implementation of the `CurlTransportOptions::EnableCurlMultiEventLoop`
+ * transport mode.
+ */
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/dll_import_export.hpp"
+#include "azure/core/http/http.hpp"
+#include "azure/core/io/body_stream.hpp"
+#include "curl_connection_private.hpp"
+
+#include <azure/core/http/curl_transport.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// curl_multi_poll() and curl_multi_wakeup() were added on libcurl 7.68.0
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+#define _azure_CURL_MULTI_EVENT_LOOP_SUPPORTED
+#endif
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  // 1 MB -> maximum number of response body bytes buffered by a transfer before libcurl is asked
+  // to pause it until the response body stream consumes them.
+  constexpr static size_t DefaultMultiTransferBufferSize = 1024 * 1024;
+  // Maximum number of socket events handled by the event loop on each wait.
+  constexpr static int DefaultMultiEventLoopMaxEvents = 256;
+  // 1 sec -> the waiting threads wake up at this interval to check for cancellation.
+  constexpr static std::chrono::milliseconds DefaultMultiTransferWaitInterval
+      = std::chrono::milliseconds(1000);
+
+  class CurlMultiEventLoop;
+
+  /**
+   * @brief State of one HTTP request driven by the #CurlMultiEventLoop.
+   *
+   * @remark The state is shared between the event loop thread, which runs the libcurl callbacks,
+   * and the thread waiting for the response or reading the response body.
+   */
+  class CurlMultiTransfer final : public std::enable_shared_from_this<CurlMultiTransfer> {
+    friend class CurlMultiEventLoop;
+
+  private:
+    // Declared before the handle, which must be cleaned up first.
+    std::shared_ptr<CurlShare> m_share;
+    Azure::Core::_internal::UniqueHandle<CURL> m_handle;
+    Azure::Core::_internal::UniqueHandle<curl_slist> m_headers;
+
+    /**
+     * @brief The request body to be uploaded. It is released as soon as the response headers are
+     * received since the request is not guaranteed to outlive the response.
+     *
+     */
+    Azure::Core::IO::BodyStream* m_uploadStream;
+    Context m_context;
+
+    std::mutex m_mutex;
+    std::condition_variable m_stateChanged;
+
+    /**
+     * @brief Request body bytes borrowed from `m_uploadStream` and not yet handed to libcurl. The
+     * unsent bytes start at `m_uploadStart`.
+     *
+     * @remark The body stream might block, so it is never read by the event loop thread. The first
+     * chunk is read by the sending thread, and the next ones by an upload task on the
+     * #Azure::Core::_detail::AsyncTaskScheduler, while libcurl sends the previous one. libcurl is
+     * asked to pause the upload when the chunk was sent before the next one was read.
+     */
+    Azure::Core::IO::BodyStreamView m_uploadView;
+    size_t m_uploadStart = 0;
+    bool m_uploadEnded = false;
+    bool m_uploadReading = false;
+    bool m_uploadPaused = false;
+    bool m_uploadRewind = false;
+
+    std::unique_ptr<RawResponse> m_response;
+    bool m_headersCompleted = false;
+    bool m_completed = false;
+    bool m_cancelled = false;
+    CURLcode m_result = CURLE_OK;
+    std::exception_ptr m_uploadError;
+
+    /**
+     * @brief Response body bytes received from the wire and not yet read. The unread bytes start
+     * at `m_bodyStart`.
+     *
+     */
+    std::vector<uint8_t> m_body;
+    size_t m_bodyStart = 0;
+    bool m_paused = false;
+    bool m_isHeadRequest;
+    int64_t m_contentLength = -1;
+
+    /**
+     * @brief Set for the asynchronous transfers, until it is invoked by the event loop.
+     *
+     */
+    SendAsyncCallback m_callback;
+    /**
+     * @brief For asynchronous transfers, the response is handed to the callback once its whole
+     * body is received, instead of being streamed.
+     *
+     */
+    bool m_bufferResponse = false;
+
+    static size_t HeaderCallback(char* data, size_t size, size_t count, void* userp);
+    static size_t WriteCallback(char* data, size_t size, size_t count, void* userp);
+    static size_t ReadCallback(char* buffer, size_t size, size_t count, void* userp);
+    static int SeekCallback(void* userp, curl_off_t offset, int origin);
+
+    void OnHeader(uint8_t const* begin, uint8_t const* end);
+
+    // Reads the next chunk of the request body, unless \p error is set. Invoked with
+    // `m_uploadReading` set, which it clears once done.
+    void ReadUploadChunk(std::exception_ptr error);
+
+    // Starts an upload task reading the next chunk of the request body, unless one is running or
+    // the body was read to its end. Returns whether a task must be posted, once the lock is
+    // released.
+    bool StartReadingUploadChunk();
+
+    // Posts an upload task started by #StartReadingUploadChunk.
+    void PostUploadTask();
+
+    // Waits for the upload task reading the request body, if any, and stops reading it. The
+    // request is not guaranteed to outlive the response.
+    void ReleaseUploadStream(std::unique_lock<std::mutex>& lock);
+
+    // Invoked from the event loop thread once libcurl is done with the transfer.
+    void Complete(CURLcode result);
+
+    // Invoked from the event loop thread, outside of the libcurl callbacks. Invokes the callback of
+    // an asynchronous transfer, if its response is ready.
+    void InvokeCallback();
+
+    // Checks whether the asynchronous transfer is waiting for its response.
+    bool IsWaitingForCallback()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return static_cast<bool>(m_callback);
+    }
+
+    // Waits for the state to change, periodically checking the context for cancellation.
+    void WaitForStateChange(std::unique_lock<std::mutex>& lock, Context const& context);
+
+  public:
+    /**
+     * @brief Creates the libcurl handle for \p request.
+     *
+     * @param request The HTTP request to be sent.
+     * @param options Transport adapter options.
+     * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
+     * ConnectionTimeout value, specified in options.
+     * @param context A context to control the request lifetime.
+     */
+    CurlMultiTransfer(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        Context const& context);
+
+    /**
+     * @brief Reads the first chunk of the request body on the calling thread, before the transfer
+     * is added to the event loop.
+     *
+     */
+    void ReadFirstUploadChunk();
+
+    /**
+     * @brief Blocks until the status line and the headers of the final response are received.
+     *
+     * @param context A context to control the request lifetime.
+     * @return The HTTP RawResponse, without a body stream.
+     */
+    std::unique_ptr<RawResponse> WaitForResponse(Context const& context);
+
+    /**
+     * @brief Copies up to \p count bytes of the response body into \p buffer, waiting for the
+     * event loop to receive them when none are buffered.
+     *
+     * @return The number of bytes copied. 0 means the end of the response body.
+     */
+    size_t ReadBody(uint8_t* buffer, size_t count, Context const& context);
+
+    /**
+     * @brief The length of the response body, or -1 if unknown.
+     *
+     */
+    int64_t ContentLength() const { return m_contentLength; }
+
+    /**
+     * @brief Checks whether libcurl is done with the transfer.
+     *
+     */
+    bool IsCompleted()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_completed;
+    }
+  };
+
+  /**
+   * @brief The body stream of a response received through the #CurlMultiEventLoop.
+   *
+   */
+  class CurlMultiBodyStream final : public Azure::Core::IO::BodyStream {
+  private:
+    std::shared_ptr<CurlMultiTransfer> m_transfer;
+
+    size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override
+    {
+      return m_transfer->ReadBody(buffer, count, context);
+    }
+
+  public:
+    explicit CurlMultiBodyStream(std::shared_ptr<CurlMultiTransfer> transfer)
+        : m_transfer(std::move(transfer))
+    {
+    }
+
+    /**
+     * @brief Abandons the transfer if the response body was not read completely.
+     *
+     */
+    ~CurlMultiBodyStream() override;
+
+    int64_t Length() const override { return m_transfer->ContentLength(); }
+  };
+
+  /**
+   * @brief Process-wide event loop that drives libcurl easy handles through one libcurl multi
+   * handle from a single background thread.
+   *
+   * @remark All the calls to the libcurl multi handle, and the libcurl callbacks of the transfers,
+   * happen on the event loop thread. Other threads post commands to the loop and wake it up.
+   *
+   * @remark On Linux, the loop waits for socket readiness with epoll, using the libcurl socket
+   * interface (`curl_multi_socket_action()`). On other platforms, it uses `curl_multi_poll()`.
+   */
+  class CurlMultiEventLoop final {
+    friend class CurlMultiTransfer;
+
+  public:
+    ~CurlMultiEventLoop();
+
+    /**
+     * @brief Sends \p request through the event loop.
+     *
+     * @remark The calling thread only waits until the response headers are received.
+     *
+     * @param request The HTTP request to be sent.
+     * @param options Transport adapter options.
+     * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
+     * ConnectionTimeout value, specified in options.
+     * @param context A context to control the request lifetime.
+     *
+     * @return The HTTP RawResponse, with a body stream fed by the event loop.
+     */
+    std::unique_ptr<RawResponse> Send(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        Context const& context);
+
+    /**
+     * @brief Sends \p request through the event loop, without blocking the calling thread.
+     *
+     * @remark \p callback is invoked on the event loop thread. When the response is streamed, the
+     * response body stream must be read on another thread.
+     *
+     * @param request The HTTP request to be sent.
+     * @param options Transport adapter options.
+     * @param connectionTimeoutOverride If greater than 0, specifies the override value for the
+     * ConnectionTimeout value, specified in options.
+     * @param context A context to control the request lifetime.
+     * @param callback Invoked once with the HTTP RawResponse, or with the error.
+     */
+    void SendAsync(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::chrono::milliseconds connectionTimeoutOverride,
+        Context const& context,
+        SendAsyncCallback callback);
+
+    /**
+     * @brief Asks the event loop to stop driving \p transfer and to release it.
+     *
+     */
+    void Cancel(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    /**
+     * @brief Asks the event loop to resume a transfer paused because its body buffer was full, or
+     * because the next chunk of its request body was not read yet.
+     *
+     */
+    void Resume(std::shared_ptr<CurlMultiTransfer> transfer);
+
+    AZ_CORE_DLLEXPORT static Azure::Core::Http::_detail::CurlMultiEventLoop g_curlMultiEventLoop;
+
+  private:
+    enum class CommandType
+    {
+      Add,
+      Remove,
+      Resume,
+    };
+
+    // private constructor to keep this as singleton.
+    CurlMultiEventLoop() = default;
+
+    void PostCommand(CommandType type, std::shared_ptr<CurlMultiTransfer> transfer);
+    void Wakeup();
+    void Run();
+    // Returns false when the loop must stop.
+    bool ProcessCommands();
+    void ProcessCompletedTransfers();
+    // Completes the asynchronous transfers cancelled by their context while waiting for the
+    // response.
+    void RemoveCancelledTransfers();
+    void InvokeCallbacks();
+
+    std::mutex m_commandsMutex;
+    std::vector<std::pair<CommandType, std::shared_ptr<CurlMultiTransfer>>> m_commands;
+    bool m_stop = false;
+    std::thread m_thread;
+
+    // Only accessed by the event loop thread, once it is started.
+    CURLM* m_multiHandle = nullptr;
+    std::unordered_map<CURL*, std::shared_ptr<CurlMultiTransfer>> m_activeTransfers;
+    // Asynchronous transfers whose callback might be ready to be invoked.
+    std::vector<std::shared_ptr<CurlMultiTransfer>> m_readyTransfers;
+    std::chrono::steady_clock::time_point m_nextCancellationCheck;
+
+#if defined(AZ_PLATFORM_LINUX)
+    static int SocketCallback(
+        CURL* easy,
+        curl_socket_t socket,
+        int what,
+        void* userp,
+        void* socketp);
+    static int TimerCallback(CURLM* multi, long timeoutMs, void* userp);
+
+    int m_epollFd = -1;
+    int m_wakeupFd = -1;
+    bool m_timerSet = false;
+    std::chrono::steady_clock::time_point m_timerDeadline;
+#endif
+  };
+
+}}}} // namespace Azure::Core::Http::_detail
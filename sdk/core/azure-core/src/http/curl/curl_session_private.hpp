@@ -15,8 +15,10 @@
 #include "curl_connection_pool_private.hpp"
 #include "curl_connection_private.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef _azure_TESTING_BUILD
 // Define the class name that reads from ConnectionPool private members
@@ -242,10 +244,10 @@ namespace Azure { namespace Core { namespace Http {
      * inner buffer. When a libcurl stream tries to read part of the body, this field will help to
      * decide how much data to take from the inner buffer before pulling more data from network.
      *
-     * @note The initial value is set to the size of the inner buffer as a sentinel that indicate
-     * that the buffer has not data or all data has already taken from it.
+     * @note A value greater than or equal to `m_innerBufferSize` indicates that the buffer has no
+     * data or all data has already been taken from it.
      */
-    size_t m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    size_t m_bodyStartInBuffer = 0;
 
     /**
      * @brief Control field to handle the number of bytes containing relevant data within the
@@ -253,7 +255,7 @@ namespace Azure { namespace Core { namespace Http {
      * from wire into it, it can be holding less then N bytes.
      *
      */
-    size_t m_innerBufferSize = _detail::DefaultLibcurlReaderSize;
+    size_t m_innerBufferSize = 0;
 
     bool m_isChunkedResponseType = false;
 
@@ -284,13 +286,20 @@ namespace Azure { namespace Core { namespace Http {
     bool m_connectionUpgraded = false;
 
     /**
-     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is only
-     * used while constructing an HTTP RawResponse without adding a body to it. Customers would
-     * provide their own buffer to copy from socket when reading the HTTP body using streams.
+     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is used
+     * while constructing an HTTP RawResponse without adding a body to it, and to read the HTTP body
+     * in pieces smaller than the buffer. Customers would provide their own buffer to copy from
+     * socket when reading larger pieces of the HTTP body using streams.
      *
+     * @remark Its size is set by `CurlTransportOptions::ReadBufferSize`.
      */
-    uint8_t m_readBuffer[_detail::DefaultLibcurlReaderSize]
-        = {0}; // to work with libcurl custom read.
+    std::vector<uint8_t> m_readBuffer;
+
+    /**
+     * @brief If true, the internal buffer grows for the responses with a large `Content-Length`.
+     *
+     */
+    bool m_adaptiveReadBuffer;
 
     /**
      * @brief Function used when working with Streams to manually write from the HTTP Request to
@@ -391,6 +400,34 @@ namespace Azure { namespace Core { namespace Http {
      */
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
 
+    /**
+     * @brief Implement Azure::Core::IO::BodyStream::OnReadView. The bytes are handed out from the
+     * internal buffer, which is filled from the wire when it is empty.
+     *
+     * @param count The maximum number of bytes to read.
+     * @param context A context to control the request lifetime.
+     * @return A view on the internal buffer.
+     */
+    Azure::Core::IO::BodyStreamView OnReadView(size_t count, Azure::Core::Context const& context)
+        override;
+
+    /**
+     * @brief Moves to the next chunk of a chunked response when the current one was read.
+     *
+     * @return The number of bytes of the response body, or of the current chunk, which are left
+     * to be read. `0` when the whole response body was read. The maximum value of `size_t` when it
+     * is unknown.
+     */
+    size_t PrepareBodyRead(Azure::Core::Context const& context);
+
+    /**
+     * @brief Reads up to \p count bytes of the response body from the wire into \p buffer. The
+     * caller accounts for the bytes once they are consumed.
+     *
+     * @return The number of bytes read. `0` when the response body of unknown length was read.
+     */
+    size_t ReadBodyFromSocket(uint8_t* buffer, size_t count, Azure::Core::Context const& context);
+
     inline std::string GetHTTPMessagePreBody(Azure::Core::Http::Request const& request);
     inline std::string GetHeadersAsString(Azure::Core::Http::Request const& request);
     inline static void SetHeader(
@@ -410,6 +447,11 @@ namespace Azure { namespace Core { namespace Http {
         std::unique_ptr<CurlNetworkConnection> connection,
         CurlTransportOptions curlOptions)
         : m_connection(std::move(connection)), m_request(request),
+          m_readBuffer(
+              curlOptions.ReadBufferSize != 0
+                  ? (std::max)(curlOptions.ReadBufferSize, _detail::MinReadBufferSize)
+                  : _detail::DefaultReadBufferSize),
+          m_adaptiveReadBuffer(curlOptions.EnableAdaptiveReadBuffer),
           m_keepAlive(curlOptions.HttpKeepAlive), m_httpProxy(curlOptions.Proxy),
           m_httpProxyUser(curlOptions.ProxyUsername), m_httpProxyPassword(curlOptions.ProxyPassword)
     {
@@ -15,6 +15,21 @@ using namespace Azure::Core::Http;
 
 const Context::Key Http::_internal::HttpConnectionTimeout{};
 
+void HttpTransport::SendAsync(Request& request, Context const& context, SendAsyncCallback callback)
+{
+  std::unique_ptr<RawResponse> response;
+  try
+  {
+    response = Send(request, context);
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+    return;
+  }
+  callback(std::move(response), nullptr);
+}
+
 char const Http::_internal::HttpShared::ContentType[] = "content-type";
 char const Http::_internal::HttpShared::ApplicationJson[] = "application/json";
 char const Http::_internal::HttpShared::Accept[] = "accept";
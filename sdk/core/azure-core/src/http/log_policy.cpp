@@ -127,3 +127,38 @@ std::unique_ptr<RawResponse> LogPolicy::Send(
 
   return response;
 }
+
+void LogPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  if (!Log::ShouldWrite(Logger::Level::Verbose))
+  {
+    nextPolicy.SendAsync(request, context, std::move(callback));
+    return;
+  }
+
+  Log::Write(Logger::Level::Informational, GetRequestLogMessage(m_httpSanitizer, request));
+
+  // The pipeline, and therefore this policy, outlives the asynchronous send.
+  auto const start = std::chrono::system_clock::now();
+  nextPolicy.SendAsync(
+      request,
+      context,
+      [this, start, callback = std::move(callback)](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (response)
+        {
+          auto const end = std::chrono::system_clock::now();
+          Log::Write(
+              Logger::Level::Informational,
+              GetResponseLogMessage(m_httpSanitizer, *response, end - start));
+        }
+        callback(std::move(response), error);
+      });
+}
@@ -15,6 +15,84 @@ using namespace Azure::Core::Http::Policies;
 using namespace Azure::Core::Http::Policies::_internal;
 using namespace Azure::Core::Tracing::_internal;
 
+namespace {
+/**
+ * @brief Creates a tracing span over the HTTP request, and propagates it to the request headers.
+ *
+ */
+TracingContextFactory::TracingContext StartRequestActivity(
+    TracingContextFactory const& tracingFactory,
+    Azure::Core::Http::_internal::HttpSanitizer const& httpSanitizer,
+    Request& request,
+    Context const& context)
+{
+  // Create a tracing span over the HTTP request.
+  std::string spanName("HTTP ");
+  spanName.append(request.GetMethod().ToString());
+
+  CreateSpanOptions createOptions;
+  createOptions.Kind = SpanKind::Client;
+  createOptions.Attributes = tracingFactory.CreateAttributeSet();
+  // Note that the AttributeSet takes a *reference* to the values passed into the
+  // AttributeSet. This means that all the values passed into the AttributeSet MUST be
+  // stabilized across the lifetime of the AttributeSet.
+
+  // Note that request.GetMethod() returns an HttpMethod object, which is always a static
+  // object, and thus its lifetime is constant. That is not the case for the other values
+  // stored in the attributes.
+  createOptions.Attributes->AddAttribute(
+      TracingAttributes::HttpMethod.ToString(), request.GetMethod().ToString());
+
+  const std::string sanitizedUrl = httpSanitizer.SanitizeUrl(request.GetUrl()).GetAbsoluteUrl();
+  createOptions.Attributes->AddAttribute(TracingAttributes::HttpUrl.ToString(), sanitizedUrl);
+
+  createOptions.Attributes->AddAttribute(
+      TracingAttributes::NetPeerPort.ToString(), request.GetUrl().GetPort());
+  const std::string host = request.GetUrl().GetScheme() + "://" + request.GetUrl().GetHost();
+  createOptions.Attributes->AddAttribute(TracingAttributes::NetPeerName.ToString(), host);
+
+  const Azure::Nullable<std::string> requestId = request.GetHeader("x-ms-client-request-id");
+  if (requestId.HasValue())
+  {
+    createOptions.Attributes->AddAttribute(
+        TracingAttributes::RequestId.ToString(), requestId.Value());
+  }
+
+  auto userAgent{request.GetHeader("User-Agent")};
+  if (userAgent.HasValue())
+  {
+    createOptions.Attributes->AddAttribute(
+        TracingAttributes::HttpUserAgent.ToString(), userAgent.Value());
+  }
+
+  auto contextAndSpan = tracingFactory.CreateTracingContext(spanName, createOptions, context);
+
+  // Propagate information from the scope to the HTTP headers.
+  //
+  // This will add the "traceparent" header and any other OpenTelemetry related headers.
+  contextAndSpan.Span.PropagateToHttpHeaders(request);
+
+  return contextAndSpan;
+}
+
+/**
+ * @brief Registers the headers received from the service on the span over the HTTP request.
+ *
+ */
+void AddResponseAttributes(ServiceSpan& scope, RawResponse const& response)
+{
+  scope.AddAttribute(
+      TracingAttributes::HttpStatusCode.ToString(),
+      std::to_string(static_cast<int>(response.GetStatusCode())));
+  auto const& responseHeaders = response.GetHeaders();
+  auto serviceRequestId = responseHeaders.find("x-ms-request-id");
+  if (serviceRequestId != responseHeaders.end())
+  {
+    scope.AddAttribute(TracingAttributes::ServiceRequestId.ToString(), serviceRequestId->second);
+  }
+}
+} // namespace
+
 std::unique_ptr<RawResponse> RequestActivityPolicy::Send(
     Request& request,
     NextHttpPolicy nextPolicy,
@@ -27,69 +105,16 @@ std::unique_ptr<RawResponse> RequestActivityPolicy::Send(
   // If our tracing factory has a tracer attached to it, register the request with the tracer.
   if (tracingFactory && tracingFactory->HasTracer())
   {
-    // Create a tracing span over the HTTP request.
-    std::string spanName("HTTP ");
-    spanName.append(request.GetMethod().ToString());
-
-    CreateSpanOptions createOptions;
-    createOptions.Kind = SpanKind::Client;
-    createOptions.Attributes = tracingFactory->CreateAttributeSet();
-    // Note that the AttributeSet takes a *reference* to the values passed into the
-    // AttributeSet. This means that all the values passed into the AttributeSet MUST be
-    // stabilized across the lifetime of the AttributeSet.
-
-    // Note that request.GetMethod() returns an HttpMethod object, which is always a static
-    // object, and thus its lifetime is constant. That is not the case for the other values
-    // stored in the attributes.
-    createOptions.Attributes->AddAttribute(
-        TracingAttributes::HttpMethod.ToString(), request.GetMethod().ToString());
-
-    const std::string sanitizedUrl = m_httpSanitizer.SanitizeUrl(request.GetUrl()).GetAbsoluteUrl();
-    createOptions.Attributes->AddAttribute(TracingAttributes::HttpUrl.ToString(), sanitizedUrl);
-
-    createOptions.Attributes->AddAttribute(
-        TracingAttributes::NetPeerPort.ToString(), request.GetUrl().GetPort());
-    const std::string host = request.GetUrl().GetScheme() + "://" + request.GetUrl().GetHost();
-    createOptions.Attributes->AddAttribute(TracingAttributes::NetPeerName.ToString(), host);
-
-    const Azure::Nullable<std::string> requestId = request.GetHeader("x-ms-client-request-id");
-    if (requestId.HasValue())
-    {
-      createOptions.Attributes->AddAttribute(
-          TracingAttributes::RequestId.ToString(), requestId.Value());
-    }
-
-    auto userAgent{request.GetHeader("User-Agent")};
-    if (userAgent.HasValue())
-    {
-      createOptions.Attributes->AddAttribute(
-          TracingAttributes::HttpUserAgent.ToString(), userAgent.Value());
-    }
-
-    auto contextAndSpan = tracingFactory->CreateTracingContext(spanName, createOptions, context);
+    auto contextAndSpan = StartRequestActivity(*tracingFactory, m_httpSanitizer, request, context);
     auto scope = std::move(contextAndSpan.Span);
 
-    // Propagate information from the scope to the HTTP headers.
-    //
-    // This will add the "traceparent" header and any other OpenTelemetry related headers.
-    scope.PropagateToHttpHeaders(request);
-
     try
     {
       // Send the request on to the service.
       auto response = nextPolicy.Send(request, contextAndSpan.Context);
 
       // And register the headers we received from the service.
-      scope.AddAttribute(
-          TracingAttributes::HttpStatusCode.ToString(),
-          std::to_string(static_cast<int>(response->GetStatusCode())));
-      auto const& responseHeaders = response->GetHeaders();
-      auto serviceRequestId = responseHeaders.find("x-ms-request-id");
-      if (serviceRequestId != responseHeaders.end())
-      {
-        scope.AddAttribute(
-            TracingAttributes::ServiceRequestId.ToString(), serviceRequestId->second);
-      }
+      AddResponseAttributes(scope, *response);
 
       return response;
     }
@@ -107,3 +132,60 @@ std::unique_ptr<RawResponse> RequestActivityPolicy::Send(
     return nextPolicy.Send(request, context);
   }
 }
+
+void RequestActivityPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  auto tracingFactory = TracingContextFactory::CreateFromContext(context);
+  if (!tracingFactory || !tracingFactory->HasTracer())
+  {
+    nextPolicy.SendAsync(request, context, std::move(callback));
+    return;
+  }
+
+  std::shared_ptr<ServiceSpan> scope;
+  Context activityContext;
+  try
+  {
+    auto contextAndSpan = StartRequestActivity(*tracingFactory, m_httpSanitizer, request, context);
+    scope = std::make_shared<ServiceSpan>(std::move(contextAndSpan.Span));
+    activityContext = contextAndSpan.Context;
+  }
+  catch (...)
+  {
+    callback(nullptr, std::current_exception());
+    return;
+  }
+
+  // The span ends when the callback releases the last reference to it.
+  nextPolicy.SendAsync(
+      request,
+      activityContext,
+      [scope, callback = std::move(callback)](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (response)
+        {
+          AddResponseAttributes(*scope, *response);
+        }
+        else
+        {
+          try
+          {
+            std::rethrow_exception(error);
+          }
+          catch (const TransportException& e)
+          {
+            scope->AddEvent(e);
+            scope->SetStatus(SpanStatus::Error);
+          }
+          catch (...)
+          {
+            // Only the transport failures are registered on the span, like the synchronous send.
+          }
+        }
+        callback(std::move(response), error);
+      });
+}
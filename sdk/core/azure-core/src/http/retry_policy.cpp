@@ -3,11 +3,17 @@
 
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/diagnostics/log.hpp"
+#include "../private/async_task_scheduler.hpp"
 
 #include <algorithm>
 #include <cstdlib>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 
 using Azure::Core::Context;
@@ -101,6 +107,37 @@ bool WasLastAttempt(RetryOptions const& retryOptions, int32_t attempt)
 }
 
 Context::Key const RetryKey;
+
+/**
+ * @brief The state of an asynchronous send, shared by the callbacks of its attempts.
+ *
+ */
+struct AsyncRetryState final
+{
+  Request& SentRequest;
+  NextHttpPolicy NextPolicy;
+  Context OperationContext;
+  SendAsyncCallback Callback;
+
+  // retryCount needs to be apart from RetryNumber attempt.
+  int32_t RetryCount = 0;
+  Context RetryContext;
+  int32_t Attempt = 0;
+  std::map<std::string, std::string> OriginalQueryParameters;
+
+  // Receives the state as argument, so the state doesn't own a reference to itself.
+  std::function<void(std::shared_ptr<AsyncRetryState> const&)> StartAttempt;
+
+  AsyncRetryState(
+      Request& request,
+      NextHttpPolicy nextPolicy,
+      Context const& context,
+      SendAsyncCallback callback)
+      : SentRequest(request), NextPolicy(nextPolicy), OperationContext(context),
+        Callback(std::move(callback)), RetryContext(context.WithValue(RetryKey, &RetryCount))
+  {
+  }
+};
 } // namespace
 
 int32_t RetryPolicy::GetRetryCount(Context const& context)
@@ -189,6 +226,115 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
   }
 }
 
+void RetryPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy nextPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  using Azure::Core::_detail::AsyncTaskScheduler;
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  auto state = std::make_shared<AsyncRetryState>(request, nextPolicy, context, std::move(callback));
+
+  // The pipeline, and therefore this policy, outlives the asynchronous send.
+  state->StartAttempt = [this](std::shared_ptr<AsyncRetryState> const& state) {
+    try
+    {
+      ++state->Attempt;
+      state->SentRequest.StartTry();
+      // creates a copy of original query parameters from request
+      state->OriginalQueryParameters = state->SentRequest.GetUrl().GetQueryParameters();
+    }
+    catch (...)
+    {
+      state->Callback(nullptr, std::current_exception());
+      return;
+    }
+
+    state->NextPolicy.SendAsync(
+        state->SentRequest,
+        state->RetryContext,
+        [this, state](std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+          std::chrono::milliseconds retryAfter{};
+          bool shouldRetry = false;
+          try
+          {
+            if (!response)
+            {
+              std::rethrow_exception(error);
+            }
+            // If we are out of retry attempts, if a response is non-retriable (or simply 200 OK,
+            // i.e doesn't need to be retried), then ShouldRetry returns false.
+            shouldRetry
+                = ShouldRetryOnResponse(*response, m_retryOptions, state->Attempt, retryAfter);
+          }
+          catch (const TransportException& e)
+          {
+            if (Log::ShouldWrite(Logger::Level::Warning))
+            {
+              Log::Write(Logger::Level::Warning, std::string("HTTP Transport error: ") + e.what());
+            }
+
+            shouldRetry
+                = ShouldRetryOnTransportFailure(m_retryOptions, state->Attempt, retryAfter);
+          }
+          catch (...)
+          {
+            response.reset();
+            error = std::current_exception();
+          }
+
+          if (!shouldRetry)
+          {
+            state->Callback(std::move(response), error);
+            return;
+          }
+          response.reset();
+
+          if (Log::ShouldWrite(Logger::Level::Informational))
+          {
+            std::ostringstream log;
+
+            log << "HTTP Retry attempt #" << state->Attempt << " will be made in "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(retryAfter).count()
+                << "ms.";
+
+            Log::Write(Logger::Level::Informational, log.str());
+          }
+
+          // Instead of sleeping, the next attempt is started from a scheduler thread.
+          AsyncTaskScheduler::Schedule(retryAfter, [state](std::exception_ptr error) {
+            if (error)
+            {
+              state->Callback(nullptr, error);
+              return;
+            }
+            if (state->OperationContext.IsCancelled())
+            {
+              state->Callback(
+                  nullptr,
+                  std::make_exception_ptr(
+                      Azure::Core::OperationCancelledException(
+                          "Request was cancelled by context.")));
+              return;
+            }
+
+            // Restore the original query parameters before next retry
+            state->SentRequest.GetUrl().SetQueryParameters(
+                std::move(state->OriginalQueryParameters));
+
+            // Update retry number
+            state->RetryCount += 1;
+            state->StartAttempt(state);
+          });
+        });
+  };
+
+  state->StartAttempt(state);
+}
+
 bool RetryPolicy::ShouldRetryOnTransportFailure(
     RetryOptions const& retryOptions,
     int32_t attempt,
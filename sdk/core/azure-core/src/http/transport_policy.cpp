@@ -137,3 +137,53 @@ std::unique_ptr<RawResponse> TransportPolicy::Send(
   // session with sockets or internal state.
   return response;
 }
+
+void TransportPolicy::SendAsync(
+    Request& request,
+    NextHttpPolicy,
+    Context const& context,
+    SendAsyncCallback callback) const
+{
+  // Before doing any work, check to make sure that the context hasn't already been cancelled.
+  if (context.IsCancelled())
+  {
+    callback(
+        nullptr,
+        std::make_exception_ptr(
+            Azure::Core::OperationCancelledException("Request was cancelled by context.")));
+    return;
+  }
+
+  // Transports supporting asynchronous sends download the response to the response's buffer, in
+  // the same cases as the synchronous send below, before invoking the callback. The body stream
+  // left by the other transports is read here, on the thread that called SendAsync.
+  bool const shouldBufferResponse = request.ShouldBufferResponse();
+  m_options.Transport->SendAsync(
+      request,
+      context,
+      [shouldBufferResponse, context, callback = std::move(callback)](
+          std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+        if (response)
+        {
+          auto statusCode = static_cast<typename std::underlying_type<Http::HttpStatusCode>::type>(
+              response->GetStatusCode());
+          if (shouldBufferResponse || statusCode >= 300)
+          {
+            auto bodyStream = response->ExtractBodyStream();
+            if (bodyStream)
+            {
+              try
+              {
+                response->SetBody(bodyStream->ReadToEnd(context));
+              }
+              catch (...)
+              {
+                response.reset();
+                error = std::current_exception();
+              }
+            }
+          }
+        }
+        callback(std::move(response), error);
+      });
+}
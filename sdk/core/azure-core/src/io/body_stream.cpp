@@ -79,6 +79,19 @@ std::vector<uint8_t> BodyStream::ReadToEnd(Context const& context)
   }
 }
 
+BodyStreamView BodyStream::OnReadView(size_t count, Context const& context)
+{
+  // 64 KB -> maximum size of the buffer allocated by the streams which don't hold their data in
+  // memory.
+  constexpr size_t maxViewBufferSize = 64 * 1024;
+  count = (std::min)(count, maxViewBufferSize);
+  if (m_viewBuffer.size() < count)
+  {
+    m_viewBuffer.resize(count);
+  }
+  return BodyStreamView{m_viewBuffer.data(), OnRead(m_viewBuffer.data(), count, context)};
+}
+
 size_t MemoryBodyStream::OnRead(uint8_t* buffer, size_t count, Context const& context)
 {
   (void)context;
@@ -91,6 +104,14 @@ size_t MemoryBodyStream::OnRead(uint8_t* buffer, size_t count, Context const& co
   return copy_length;
 }
 
+BodyStreamView MemoryBodyStream::OnReadView(size_t count, Context const& context)
+{
+  (void)context;
+  BodyStreamView view{m_data + m_offset, (std::min)(count, m_length - m_offset)};
+  m_offset += view.Size;
+  return view;
+}
+
 FileBodyStream::FileBodyStream(const std::string& filename)
 {
   AZURE_ASSERT_MSG(filename.size() > 0, "The file name must not be an empty string.");
@@ -219,6 +240,15 @@ size_t ProgressBodyStream::OnRead(
   return read;
 }
 
+BodyStreamView ProgressBodyStream::OnReadView(size_t count, Azure::Core::Context const& context)
+{
+  auto view = m_bodyStream->ReadView(count, context);
+  m_bytesTransferred += view.Size;
+  m_callback(m_bytesTransferred);
+
+  return view;
+}
+
 int64_t ProgressBodyStream::Length() const { return m_bodyStream->Length(); }
 
 using Azure::Core::IO::_internal::NullBodyStream;
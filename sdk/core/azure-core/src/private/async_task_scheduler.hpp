@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Runs the continuations of the asynchronous HTTP pipeline.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Core { namespace _detail {
+
+  /**
+   * @brief Process-wide scheduler running tasks on a pool of background threads, either as soon as
+   * possible or after a delay.
+   *
+   * @details The asynchronous HTTP pipeline uses it to wait between retries and to move work that
+   * might block (such as getting a token, or sending a request with a synchronous transport) off
+   * the threads owned by the HTTP transports, without dedicating a thread to each request. A
+   * thread is started whenever a task is due and all the threads are busy, up to #MaxThreads, so
+   * that a task which blocks does not hold back the others.
+   *
+   * @remark Tasks must not throw. A task gets the error it is invoked with, which is null unless
+   * the scheduler is stopped, when the process exits: the tasks which are pending, or scheduled
+   * after that, are invoked with an error on the calling thread.
+   */
+  class AsyncTaskScheduler final {
+  public:
+    /**
+     * @brief The type of the tasks, which get null, or the error preventing them from running.
+     *
+     */
+    using TaskFunction = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @brief The maximum number of threads running the tasks.
+     *
+     */
+    static size_t const MaxThreads;
+
+    /**
+     * @brief Runs \p task on a scheduler thread once \p delay has elapsed.
+     *
+     */
+    static void Schedule(std::chrono::milliseconds delay, TaskFunction task);
+
+    /**
+     * @brief Runs \p task on a scheduler thread as soon as possible.
+     *
+     */
+    static void Post(TaskFunction task)
+    {
+      Schedule(std::chrono::milliseconds(0), std::move(task));
+    }
+
+    ~AsyncTaskScheduler();
+
+  private:
+    struct ScheduledTask final
+    {
+      std::chrono::steady_clock::time_point Deadline;
+      // Keeps the tasks with the same deadline in the order they were scheduled.
+      uint64_t Sequence;
+      TaskFunction Task;
+
+      bool operator>(ScheduledTask const& other) const
+      {
+        return Deadline > other.Deadline
+            || (Deadline == other.Deadline && Sequence > other.Sequence);
+      }
+    };
+
+    AsyncTaskScheduler() = default;
+
+    static AsyncTaskScheduler& GetInstance();
+    // Starts a thread if none is waiting for the next task. Called with the lock held.
+    void StartThreadIfNeeded();
+    void Run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_tasksChanged;
+    std::priority_queue<ScheduledTask, std::vector<ScheduledTask>, std::greater<ScheduledTask>>
+        m_tasks;
+    uint64_t m_nextSequence = 0;
+    bool m_stop = false;
+    std::vector<std::thread> m_threads;
+    // The number of threads running a task.
+    size_t m_busyThreads = 0;
+  };
+
+}}} // namespace Azure::Core::_detail
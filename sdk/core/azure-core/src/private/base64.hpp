@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Base64 kernels behind `Azure::Core::Convert`.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Azure { namespace Core { namespace _detail {
+
+  /**
+   * @brief The instruction sets the Base64 kernels can use.
+   *
+   * @details The `%Convert` methods use the fastest one supported by the CPU, which is detected
+   * once per process.
+   */
+  enum class Base64Implementation
+  {
+    Scalar,
+    Sse41,
+    Avx2,
+    Neon,
+  };
+
+  /**
+   * @brief Checks whether \p implementation can run on this CPU.
+   *
+   */
+  bool IsBase64ImplementationSupported(Base64Implementation implementation);
+
+  /**
+   * @brief Gets the fastest implementation supported by this CPU.
+   *
+   */
+  Base64Implementation GetBase64Implementation();
+
+  /**
+   * @brief Encodes \p length bytes of \p data into \p destination, which must hold
+   * `Convert::GetBase64EncodedSize(length)` characters.
+   *
+   * @return The number of characters written.
+   */
+  size_t Base64Encode(
+      uint8_t const* data,
+      size_t length,
+      char* destination,
+      Base64Implementation implementation);
+
+  /**
+   * @brief Decodes \p length characters of \p text into \p destination, which must hold
+   * `Convert::GetBase64DecodedSize(text, length)` bytes.
+   *
+   * @return The number of bytes written.
+   *
+   * @throw std::runtime_error if \p text is not valid Base64.
+   */
+  size_t Base64Decode(
+      char const* text,
+      size_t length,
+      uint8_t* destination,
+      Base64Implementation implementation);
+
+}}} // namespace Azure::Core::_detail
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the Base64 encoding and decoding performance.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/base64.hpp>
+#include <azure/perf.hpp>
+#include <azure/perf/random_stream.hpp>
+
+#include <private/base64.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief Measure the throughput of the Base64 encoder or decoder, into a preallocated buffer.
+   *
+   */
+  class Base64Test : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_data;
+    std::string m_encoded;
+    std::vector<uint8_t> m_decoded;
+    bool m_decode = false;
+    Azure::Core::_detail::Base64Implementation m_implementation
+        = Azure::Core::_detail::Base64Implementation::Scalar;
+
+  public:
+    /**
+     * @brief Construct a new Base64Test test.
+     *
+     * @param options The test options.
+     */
+    Base64Test(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Create the data to encode or decode, and select the implementation.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_decode = m_options.HasOption("Decode");
+
+      const auto implementation
+          = m_options.GetOptionOrDefault<std::string>("Implementation", "default");
+      if (implementation == "default")
+      {
+        m_implementation = Azure::Core::_detail::GetBase64Implementation();
+      }
+      else if (implementation == "scalar")
+      {
+        m_implementation = Azure::Core::_detail::Base64Implementation::Scalar;
+      }
+      else if (implementation == "sse41")
+      {
+        m_implementation = Azure::Core::_detail::Base64Implementation::Sse41;
+      }
+      else if (implementation == "avx2")
+      {
+        m_implementation = Azure::Core::_detail::Base64Implementation::Avx2;
+      }
+      else if (implementation == "neon")
+      {
+        m_implementation = Azure::Core::_detail::Base64Implementation::Neon;
+      }
+      else
+      {
+        throw std::invalid_argument("Unknown Base64 implementation: " + implementation);
+      }
+      if (!Azure::Core::_detail::IsBase64ImplementationSupported(m_implementation))
+      {
+        throw std::runtime_error(
+            "The Base64 implementation is not supported on this machine: " + implementation);
+      }
+
+      m_data = Azure::Perf::RandomStream::Create(size)->ReadToEnd(Azure::Core::Context{});
+      m_encoded = Azure::Core::Convert::Base64Encode(m_data);
+      m_decoded.resize(m_data.size());
+    }
+
+    /**
+     * @brief Encode or decode the data.
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      if (m_decode)
+      {
+        Azure::Core::_detail::Base64Decode(
+            m_encoded.data(), m_encoded.size(), m_decoded.data(), m_implementation);
+      }
+      else
+      {
+        Azure::Core::_detail::Base64Encode(
+            m_data.data(), m_data.size(), &m_encoded[0], m_implementation);
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size", "-s"}, "Size of the binary data (in bytes)", 1, true},
+          {"Decode", {"--decode"}, "Measure the decoder instead of the encoder.", 0, false},
+          {"Implementation",
+           {"--implementation"},
+           "The implementation: default, scalar, sse41, avx2 or neon. By default, the fastest one "
+           "supported by the machine is used.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "base64",
+          "Measures the throughput of the Base64 encoding and decoding",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::Base64Test>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the libcurl transport performance when downloading large response bodies.
+ *
+ */
+
+#pragma once
+
+#include "../../../core/perf/inc/azure/perf.hpp"
+
+#include <azure/core.hpp>
+#include <azure/core/http/curl_transport.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief Measure how the read buffer size of the libcurl transport affects downloading large
+   * response bodies.
+   *
+   * @remark The body is read in pieces of `--read-size` bytes, or through
+   * #Azure::Core::IO::BodyStream::ReadView with `--view`. Comparing runs with different
+   * `--read-buffer-size`, with or without `--adaptive`, under `strace -c -e trace=recvfrom` shows
+   * the number of reads from the network each configuration takes.
+   */
+  class CurlDownloadTest : public Azure::Perf::PerfTest {
+
+    std::string m_target;
+    std::shared_ptr<Azure::Core::Http::HttpTransport> m_transport;
+    size_t m_readSize;
+    bool m_readView;
+    std::vector<uint8_t> m_buffer;
+
+  public:
+    /**
+     * @brief Construct a new CurlDownloadTest test.
+     *
+     * @param options The test options.
+     */
+    CurlDownloadTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    void Setup() override
+    {
+      m_target = m_options.GetMandatoryOption<std::string>("Url");
+      m_readSize = m_options.GetOptionOrDefault<size_t>("ReadSize", 8 * 1024);
+      m_readView = m_options.HasOption("ReadView");
+      m_buffer.resize(m_readSize);
+
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.SslVerifyPeer = false;
+      transportOptions.ReadBufferSize = m_options.GetOptionOrDefault<size_t>(
+          "ReadBufferSize", Azure::Core::Http::_detail::DefaultReadBufferSize);
+      transportOptions.EnableAdaptiveReadBuffer = m_options.HasOption("Adaptive");
+      m_transport = std::make_shared<Azure::Core::Http::CurlTransport>(transportOptions);
+    }
+
+    /**
+     * @brief Download the target and read the whole response body.
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      auto httpRequest = Azure::Core::Http::Request(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(m_target), false);
+      auto response = m_transport->Send(httpRequest, context);
+      auto bodyStream = response->ExtractBodyStream();
+      if (m_readView)
+      {
+        while (bodyStream->ReadView(m_readSize, context).Size != 0)
+        {
+        }
+      }
+      else
+      {
+        while (bodyStream->Read(m_buffer.data(), m_buffer.size(), context) != 0)
+        {
+        }
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Url", {"--url"}, "The URL of a large download.", 1, true},
+          {"ReadSize",
+           {"--read-size"},
+           "The number of bytes read from the response body at a time. Default to 8192.",
+           1,
+           false},
+          {"ReadBufferSize",
+           {"--read-buffer-size"},
+           "The transport read buffer size. Default to 4096.",
+           1,
+           false},
+          {"Adaptive", {"--adaptive"}, "Enable the adaptive read buffer.", 0, false},
+          {"ReadView", {"--view"}, "Read the response body with ReadView.", 0, false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "curlDownload",
+          "Measures the libcurl transport read buffer when downloading large responses",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::CurlDownloadTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -1,6 +1,10 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include "azure/core/test/base64_test.hpp"
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+#include "azure/core/test/curl_download_test.hpp"
+#endif
 #include "azure/core/test/delay_test.hpp"
 #include "azure/core/test/exception_test.hpp"
 #include "azure/core/test/extended_options_test.hpp"
@@ -20,6 +24,7 @@ int main(int argc, char** argv)
 
   // Create the test list
   std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Core::Test::Base64Test::GetTestMetadata(),
       Azure::Core::Test::DelayTest::GetTestMetadata(),
       Azure::Core::Test::ExceptionTest::GetTestMetadata(),
       Azure::Core::Test::ExtendedOptionsTest::GetTestMetadata(),
@@ -29,6 +34,9 @@ int main(int argc, char** argv)
       Azure::Core::Test::NullableTest::GetTestMetadata(),
       Azure::Core::Test::PipelineTest::GetTestMetadata(),
       Azure::Core::Test::UuidTest::GetTestMetadata()};
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+  tests.emplace_back(Azure::Core::Test::CurlDownloadTest::GetTestMetadata());
+#endif
 
   Azure::Perf::Program::Run(Azure::Core::Context{}, tests, argc, argv);
 
@@ -3,6 +3,8 @@
 
 #include <azure/core/base64.hpp>
 
+#include <private/base64.hpp>
+
 #include <random>
 #include <string>
 #include <vector>
@@ -187,6 +189,97 @@ TEST(Base64, InvalidDecode)
   // cspell::enable
 }
 
+TEST(Base64, CallerProvidedBuffer)
+{
+  std::vector<uint8_t> data(100);
+  RandomBuffer(data.data(), data.size());
+
+  std::string encoded(Convert::GetBase64EncodedSize(data.size()), '\0');
+  EXPECT_EQ(
+      Convert::Base64Encode(data.data(), data.size(), &encoded[0], encoded.size()),
+      encoded.size());
+  EXPECT_EQ(encoded, Convert::Base64Encode(data));
+  EXPECT_THROW(
+      Convert::Base64Encode(data.data(), data.size(), &encoded[0], encoded.size() - 1),
+      std::invalid_argument);
+
+  std::vector<uint8_t> decoded(Convert::GetBase64DecodedSize(encoded.data(), encoded.size()));
+  EXPECT_EQ(
+      Convert::Base64Decode(encoded.data(), encoded.size(), decoded.data(), decoded.size()),
+      data.size());
+  EXPECT_EQ(decoded, data);
+  EXPECT_THROW(
+      Convert::Base64Decode(encoded.data(), encoded.size(), decoded.data(), decoded.size() - 1),
+      std::invalid_argument);
+  EXPECT_THROW(Convert::GetBase64DecodedSize("abc", 3), std::runtime_error);
+}
+
+TEST(Base64, Implementations)
+{
+  using _detail::Base64Implementation;
+
+  std::vector<uint8_t> data(4096);
+  RandomBuffer(data.data(), data.size());
+  for (auto implementation :
+       {Base64Implementation::Sse41, Base64Implementation::Avx2, Base64Implementation::Neon})
+  {
+    if (!_detail::IsBase64ImplementationSupported(implementation))
+    {
+      continue;
+    }
+    // Every length around the block sizes of the vector kernels, and every alignment.
+    for (size_t offset = 0; offset < 32; ++offset)
+    {
+      for (size_t length = 0; length < 300; length += (offset == 0 ? 1 : 7))
+      {
+        std::string expected(Convert::GetBase64EncodedSize(length), '\0');
+        _detail::Base64Encode(
+            &data[offset], length, &expected[0], Base64Implementation::Scalar);
+        std::string encoded(expected.size(), '\0');
+        EXPECT_EQ(
+            _detail::Base64Encode(&data[offset], length, &encoded[0], implementation),
+            encoded.size());
+        EXPECT_EQ(encoded, expected);
+
+        std::vector<uint8_t> decoded(length);
+        EXPECT_EQ(
+            _detail::Base64Decode(encoded.data(), encoded.size(), decoded.data(), implementation),
+            length);
+        EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), &data[offset]));
+      }
+    }
+
+    // Every character, valid or not, at every position of a vector block.
+    std::string encoded(Convert::GetBase64EncodedSize(data.size()), '\0');
+    _detail::Base64Encode(data.data(), data.size(), &encoded[0], implementation);
+    std::vector<uint8_t> decoded(data.size());
+    for (size_t position = 0; position < 64; ++position)
+    {
+      for (int c = 0; c < 256; ++c)
+      {
+        std::string text = encoded;
+        text[position] = static_cast<char>(c);
+        const bool isValid = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')
+            || (c >= '0' && c <= '9') || c == '+' || c == '/';
+        if (isValid)
+        {
+          std::vector<uint8_t> expected(data.size());
+          _detail::Base64Decode(
+              text.data(), text.size(), expected.data(), Base64Implementation::Scalar);
+          _detail::Base64Decode(text.data(), text.size(), decoded.data(), implementation);
+          EXPECT_EQ(decoded, expected);
+        }
+        else
+        {
+          EXPECT_THROW(
+              _detail::Base64Decode(text.data(), text.size(), decoded.data(), implementation),
+              std::runtime_error);
+        }
+      }
+    }
+  }
+}
+
 // Base64Url Tests
 TEST(Base64Url, BasicEncode)
 {
@@ -5,6 +5,9 @@
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
 
+#include <mutex>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy;
@@ -549,3 +552,105 @@ TEST(BearerTokenAuthenticationPolicy, ChallengeBasedFailure)
   EXPECT_NE(authHeader, headers.end());
   EXPECT_EQ(authHeader->second, "Bearer ACCESSTOKEN1");
 }
+
+TEST(BearerTokenAuthenticationPolicy, ChallengeBasedSuccessAsync)
+{
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+
+  // The policy only overrides AuthorizeAndSendRequest(), which SendAsync() must still use.
+  policies.emplace_back(std::make_unique<TestChallengeBasedAuthenticationPolicy>(
+      std::make_shared<TestTokenCredentialForChallengeBasedTokenAuthenticationPolicy>(),
+      tokenRequestContext,
+      true));
+
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+
+  HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Url("https://www.azure.com"));
+
+  auto const response = pipeline.SendAsync(request, Context()).get();
+  EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+
+  auto const headers = request.GetHeaders();
+  auto const authHeader = headers.find("authorization");
+  EXPECT_NE(authHeader, headers.end());
+  EXPECT_EQ(authHeader->second, "Bearer ACCESSTOKEN2");
+}
+
+TEST(BearerTokenAuthenticationPolicy, ChallengeBasedFailureAsync)
+{
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+
+  policies.emplace_back(std::make_unique<TestChallengeBasedAuthenticationPolicy>(
+      std::make_shared<TestTokenCredentialForChallengeBasedTokenAuthenticationPolicy>(),
+      tokenRequestContext,
+      false));
+
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+
+  HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Url("https://www.azure.com"));
+
+  auto const response = pipeline.SendAsync(request, Context()).get();
+  EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Unauthorized);
+
+  auto const headers = request.GetHeaders();
+  auto const authHeader = headers.find("authorization");
+  EXPECT_NE(authHeader, headers.end());
+  EXPECT_EQ(authHeader->second, "Bearer ACCESSTOKEN1");
+}
+
+TEST(BearerTokenAuthenticationPolicy, SendAsyncGetsTokenInBackground)
+{
+  using namespace std::chrono_literals;
+
+  class ThreadRecordingTokenCredential final : public TokenCredential {
+  public:
+    mutable std::mutex Mutex;
+    mutable std::vector<std::thread::id> Threads;
+
+    ThreadRecordingTokenCredential() : TokenCredential("ThreadRecordingTokenCredential") {}
+
+    AccessToken GetToken(TokenRequestContext const&, Context const&) const override
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Threads.push_back(std::this_thread::get_id());
+      return {"ACCESSTOKEN1", std::chrono::system_clock::now() + 1h};
+    }
+  };
+
+  auto credential = std::make_shared<ThreadRecordingTokenCredential>();
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(
+      std::make_unique<BearerTokenAuthenticationPolicy>(credential, tokenRequestContext));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+  HttpPipeline pipeline(policies);
+
+  for (int i = 0; i < 2; ++i)
+  {
+    Request request(HttpMethod::Get, Url("https://www.azure.com"));
+    auto const response = pipeline.SendAsync(request, Context()).get();
+    EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+
+    auto const headers = request.GetHeaders();
+    auto const authHeader = headers.find("authorization");
+    EXPECT_NE(authHeader, headers.end());
+    EXPECT_EQ(authHeader->second, "Bearer ACCESSTOKEN1");
+  }
+
+  // The token is got once, not on the thread which sent the request, and then reused.
+  std::lock_guard<std::mutex> lock(credential->Mutex);
+  ASSERT_EQ(credential->Threads.size(), 1U);
+  EXPECT_NE(credential->Threads[0], std::this_thread::get_id());
+}
@@ -152,6 +152,54 @@ TEST(FileBodyStream, Read)
   EXPECT_EQ(buffer[FileSize], 0);
 }
 
+TEST(FileBodyStream, ReadView)
+{
+  std::string testDataPath(AZURE_TEST_DATA_PATH);
+  testDataPath.append("/fileData");
+
+  Azure::Core::IO::FileBodyStream stream(testDataPath);
+  auto const expected = stream.ReadToEnd();
+  stream.Rewind();
+
+  // The file data is read into a buffer owned by the stream.
+  std::vector<uint8_t> readResult;
+  for (auto view = stream.ReadView(100); view.Size != 0; view = stream.ReadView(100))
+  {
+    EXPECT_LE(view.Size, 100);
+    readResult.insert(readResult.end(), view.Data, view.Data + view.Size);
+  }
+  EXPECT_EQ(readResult, expected);
+  EXPECT_EQ(stream.ReadView(0).Size, 0);
+}
+
+TEST(MemoryBodyStream, ReadView)
+{
+  std::vector<uint8_t> data{1, 2, 3, 4, 5};
+  MemoryBodyStream stream(data);
+
+  // The bytes are handed out from the memory buffer, without copies.
+  auto view = stream.ReadView(3);
+  EXPECT_EQ(view.Data, data.data());
+  EXPECT_EQ(view.Size, 3);
+
+  std::vector<uint8_t> buffer(2);
+  EXPECT_EQ(stream.Read(buffer.data(), 1), 1);
+  EXPECT_EQ(buffer[0], 4);
+
+  view = stream.ReadView(10);
+  EXPECT_EQ(view.Data, data.data() + 4);
+  EXPECT_EQ(view.Size, 1);
+  EXPECT_EQ(stream.ReadView(10).Size, 0);
+
+  stream.Rewind();
+  EXPECT_EQ(stream.ReadView(10).Size, data.size());
+
+  Azure::Core::Context context;
+  context.Cancel();
+  stream.Rewind();
+  EXPECT_THROW(stream.ReadView(10, context), Azure::Core::OperationCancelledException);
+}
+
 TEST(ProgressBodyStream, Init)
 {
   int64_t bytesTransferred = -1;
@@ -185,6 +233,24 @@ TEST(ProgressBodyStream, ReadChunk)
   EXPECT_EQ(readSize, 10);
 }
 
+TEST(ProgressBodyStream, ReadView)
+{
+  int64_t bytesTransferred = -1;
+  std::vector<uint8_t> data(30, 1);
+  MemoryBodyStream stream(data);
+
+  ProgressBodyStream progress(stream, [&bytesTransferred](int64_t bt) { bytesTransferred = bt; });
+
+  auto view = progress.ReadView(10);
+  EXPECT_EQ(view.Data, data.data());
+  EXPECT_EQ(view.Size, 10);
+  EXPECT_EQ(bytesTransferred, 10);
+
+  view = progress.ReadView(100);
+  EXPECT_EQ(view.Size, 20);
+  EXPECT_EQ(bytesTransferred, 30);
+}
+
 TEST(ProgressBodyStream, MultiWrapProgressStream)
 {
   int64_t bytesTransferred = -1;
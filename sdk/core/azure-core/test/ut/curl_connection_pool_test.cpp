@@ -11,6 +11,7 @@
 #include "azure/core/http/curl_transport.hpp"
 #endif
 
+#include <future>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -48,11 +49,9 @@ namespace Azure { namespace Core { namespace Test {
 #endif
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -61,7 +60,7 @@ namespace Azure { namespace Core { namespace Test {
       std::string const expectedConnectionKey(CreateConnectionKey(
           AzureSdkHttpbinServer::Schema(),
           AzureSdkHttpbinServer::Host(),
-          ",0,0,0,0,0,1,1,0,0,0,1,0,0"));
+          ",0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
 
       {
         // Creating a new connection with default options
@@ -80,18 +79,13 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto connectionFromPool
-            = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.begin()
-                  ->second.begin()
-                  ->get();
-        EXPECT_EQ(connectionFromPool->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Test that asking a connection with same config will re-use the same connection
@@ -103,8 +97,7 @@ namespace Azure { namespace Core { namespace Test {
 
         // There was just one connection in the pool, it should be empty now
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
         // And the connection key for the connection we got is the expected
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -117,22 +110,19 @@ namespace Azure { namespace Core { namespace Test {
         session->m_httpKeepAlive = true;
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check that after the connection is gone, it is moved back to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Now test that using a different connection config won't re-use the same connection
       std::string const secondExpectedKey = AzureSdkHttpbinServer::Schema() + "://"
-          + AzureSdkHttpbinServer::Host() + ",0,0,0,0,0,1,0,0,0,0,1,0,200000";
+          + AzureSdkHttpbinServer::Host() + ",0,0,0,0,0,1,0,0,0,0,1,1,0,200000";
       {
         // Creating a new connection with options
         Azure::Core::Http::CurlTransportOptions options;
@@ -144,16 +134,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            expectedConnectionKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -165,28 +151,18 @@ namespace Azure { namespace Core { namespace Test {
 
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
       }
 
       {
@@ -209,16 +185,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            secondExpectedKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -229,45 +201,30 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
       }
 
 #ifdef RUN_LONG_UNIT_TESTS
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
 
@@ -294,16 +251,12 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
         EXPECT_EQ(
             Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                .ConnectionPoolIndex[expectedConnectionKey]
-                .size(),
+                .ConnectionsOnPool(expectedConnectionKey),
             5);
       }
 
@@ -321,10 +274,8 @@ namespace Azure { namespace Core { namespace Test {
           std::this_thread::sleep_for(10ms);
           // If test wakes while clean pool is running, it will wait until lock is released by
           // the clean pool thread.
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           poolIsEmpty = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                            .ConnectionPoolIndex.size()
+                            .IndexCount()
               == 0;
         }
         EXPECT_TRUE(poolIsEmpty);
@@ -422,17 +373,190 @@ namespace Azure { namespace Core { namespace Test {
       //   }
     }
 
+    TEST(CurlConnectionPool, maxIdleConnectionsPerHost)
+    {
+      using ::testing::_;
+      using ::testing::Return;
+      using ::testing::ReturnRef;
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      Azure::Core::Http::Request req(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost"));
+      std::string const hostKey(
+          CreateConnectionKey("http", "localhost", ",0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
+
+      Azure::Core::Http::CurlTransportOptions options;
+      options.MaxIdleConnectionsPerHost = 2;
+      options.ConnectionPoolMetrics
+          = std::make_shared<Azure::Core::Http::CurlConnectionPoolMetrics>();
+
+      // Using fake connections to avoid opening real HTTP connections. Each connection returns its
+      // id when reading from it.
+      std::vector<MockCurlNetworkConnection*> connections;
+      for (size_t id = 0; id < 3; id++)
+      {
+        MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+        EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(hostKey));
+        EXPECT_CALL(*curlMock, UpdateLastUsageTime()).WillRepeatedly(Return());
+        EXPECT_CALL(*curlMock, IsExpired()).WillRepeatedly(Return(false));
+        EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _)).WillRepeatedly(Return(id));
+        EXPECT_CALL(*curlMock, DestructObj());
+        connections.emplace_back(curlMock);
+      }
+
+      // The pool settings are taken from the options of the requests getting connections.
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          std::unique_ptr<MockCurlNetworkConnection>(connections[0]), true);
+      auto connection
+          = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, options);
+      EXPECT_EQ(connection->ReadFromSocket(nullptr, 0, Context{}), 0);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
+
+      // The oldest connection is closed when adding a third connection.
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          std::move(connection), true);
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          std::unique_ptr<MockCurlNetworkConnection>(connections[1]), true);
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          std::unique_ptr<MockCurlNetworkConnection>(connections[2]), true);
+      EXPECT_EQ(options.ConnectionPoolMetrics->Evictions, 1);
+
+      // The connections are re-used from the most recently used one.
+      auto lastConnection
+          = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, options);
+      EXPECT_EQ(lastConnection->ReadFromSocket(nullptr, 0, Context{}), 2);
+      auto firstConnection
+          = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, options);
+      EXPECT_EQ(firstConnection->ReadFromSocket(nullptr, 0, Context{}), 1);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
+
+      EXPECT_EQ(options.ConnectionPoolMetrics->Hits, 3);
+      EXPECT_EQ(options.ConnectionPoolMetrics->Misses, 0);
+    }
+
+    TEST(CurlConnectionPool, maxConnectionsPerHost)
+    {
+      using ::testing::_;
+      using ::testing::Return;
+      using ::testing::ReturnRef;
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      Azure::Core::Http::Request req(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url("http://localhost"));
+      std::string const hostKey(
+          CreateConnectionKey("http", "localhost", ",0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
+
+      Azure::Core::Http::CurlTransportOptions options;
+      options.MaxConnectionsPerHost = 2;
+
+      // The reserved connections are held like connections in use, without opening them.
+      EXPECT_EQ(
+          CurlConnectionPool::g_curlConnectionPool.ReserveConnections(req, options, 0ms, 2), 2);
+
+      // The third request waits until it is cancelled.
+      Azure::Core::Context context;
+      auto cancelled = std::async(std::launch::async, [&]() {
+        return CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
+            req, options, 0ms, false, context);
+      });
+      EXPECT_EQ(cancelled.wait_for(200ms), std::future_status::timeout);
+      context.Cancel();
+      EXPECT_THROW(cancelled.get(), Azure::Core::OperationCancelledException);
+
+      // The third request waits until a connection is released to the pool.
+      auto waiting = std::async(std::launch::async, [&]() {
+        return CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
+            req, options);
+      });
+      EXPECT_EQ(waiting.wait_for(200ms), std::future_status::timeout);
+
+      MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+      EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(hostKey));
+      EXPECT_CALL(*curlMock, UpdateLastUsageTime()).WillRepeatedly(Return());
+      EXPECT_CALL(*curlMock, IsExpired()).WillRepeatedly(Return(false));
+      EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _)).WillRepeatedly(Return(7));
+      EXPECT_CALL(*curlMock, DestructObj());
+      CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+          std::unique_ptr<MockCurlNetworkConnection>(curlMock), true);
+      ASSERT_EQ(waiting.wait_for(10s), std::future_status::ready);
+      EXPECT_EQ(waiting.get()->ReadFromSocket(nullptr, 0, Context{}), 7);
+
+      // Releasing the reservations removes the pool-index.
+      CurlConnectionPool::g_curlConnectionPool.OnConnectionClosed(hostKey);
+      CurlConnectionPool::g_curlConnectionPool.OnConnectionClosed(hostKey);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 0);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
+    }
+
+    TEST(CurlConnectionPool, prewarmConnectionsFailure)
+    {
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      Azure::Core::Http::CurlTransportOptions options;
+      options.ConnectionPoolMetrics
+          = std::make_shared<Azure::Core::Http::CurlConnectionPoolMetrics>();
+      Azure::Core::Http::CurlTransport transport(options);
+
+      // Nothing listens on port 1, the failures are not reported by the future.
+      auto prewarmed = transport.PrewarmConnections({Azure::Core::Url("http://localhost:1")}, 3);
+      EXPECT_NO_THROW(prewarmed.get());
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
+
+      // Nothing is opened once the context is cancelled.
+      Azure::Core::Context context;
+      context.Cancel();
+      prewarmed = transport.PrewarmConnections(
+          {Azure::Core::Url("http://localhost:1"), Azure::Core::Url("http://localhost:2")},
+          2,
+          context);
+      EXPECT_NO_THROW(prewarmed.get());
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
+
+      // Opening connections in advance is not counted as pool misses.
+      EXPECT_EQ(options.ConnectionPoolMetrics->Misses, 0);
+    }
+
+    TEST(CurlConnectionPool, sharedCaches)
+    {
+      Azure::Core::Http::CurlTransportOptions options;
+      CURLSHcode result;
+
+      // The same share handle is used by all the transports with the same TLS settings.
+      auto share = CurlShare::Get(options, &result);
+      ASSERT_EQ(result, CURLSHE_OK);
+      ASSERT_NE(share, nullptr);
+      EXPECT_NE(share->GetHandle(), nullptr);
+      options.ConnectionPoolMetrics
+          = std::make_shared<Azure::Core::Http::CurlConnectionPoolMetrics>();
+      EXPECT_EQ(CurlShare::Get(options, &result), share);
+
+      // TLS sessions are not shared between connections doing different checks.
+      options.SslOptions.EnableCertificateRevocationListCheck = true;
+      auto crlShare = CurlShare::Get(options, &result);
+      EXPECT_EQ(result, CURLSHE_OK);
+      EXPECT_NE(crlShare, nullptr);
+      EXPECT_NE(crlShare, share);
+
+      options.EnableCurlSslCaching = false;
+      auto dnsShare = CurlShare::Get(options, &result);
+      EXPECT_EQ(result, CURLSHE_OK);
+      EXPECT_NE(dnsShare, nullptr);
+      EXPECT_NE(dnsShare, share);
+
+      options.EnableCurlDnsCaching = false;
+      EXPECT_EQ(CurlShare::Get(options, &result), nullptr);
+      EXPECT_EQ(result, CURLSHE_OK);
+    }
+
     TEST(CurlConnectionPool, uniquePort)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there is nothing in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
 
@@ -444,18 +568,15 @@ namespace Azure { namespace Core { namespace Test {
         std::string const expectedConnectionKey(CreateConnectionKey(
             AzureSdkHttpbinServer::Schema(),
             AzureSdkHttpbinServer::Host(),
-            ",0,0,0,0,0,1,1,0,0,0,1,0,0"));
+            ",0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
 
         // Creating a new connection with default options
         auto connection = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               0);
           EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         }
@@ -465,12 +586,9 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Test connection was moved to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             1);
       }
 
@@ -482,7 +600,7 @@ namespace Azure { namespace Core { namespace Test {
         std::string const expectedConnectionKey(CreateConnectionKey(
             AzureSdkHttpbinServer::Schema(),
             AzureSdkHttpbinServer::Host(),
-            ":443,0,0,0,0,0,1,1,0,0,0,1,0,0"));
+            ":443,0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
 
         // Creating a new connection with default options
         auto connection = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
@@ -490,12 +608,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         // move connection back to the pool
@@ -503,12 +618,9 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check 2 connections in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
       }
 
@@ -521,18 +633,15 @@ namespace Azure { namespace Core { namespace Test {
         std::string const expectedConnectionKey(CreateConnectionKey(
             AzureSdkHttpbinServer::Schema(),
             AzureSdkHttpbinServer::Host(),
-            ",0,0,0,0,0,1,1,0,0,0,1,0,0"));
+            ",0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
 
         // Creating a new connection with default options
         auto connection = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -543,11 +652,8 @@ namespace Azure { namespace Core { namespace Test {
 
       {
         // Make sure there is nothing in the pool
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
       }
       {
@@ -558,7 +664,7 @@ namespace Azure { namespace Core { namespace Test {
         std::string const expectedConnectionKey(CreateConnectionKey(
             AzureSdkHttpbinServer::Schema(),
             AzureSdkHttpbinServer::Host(),
-            ":443,0,0,0,0,0,1,1,0,0,0,1,0,0"));
+            ":443,0,0,0,0,0,1,1,0,0,0,1,1,0,0"));
 
         // Creating a new connection with default options
         auto connection = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
@@ -566,12 +672,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
               1);
         }
         // move connection back to the pool
@@ -579,14 +682,10 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             2);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
       }
     }
 
@@ -646,11 +745,9 @@ namespace Azure { namespace Core { namespace Test {
       /// When getting the header connection: close from an HTTP response, the connection should not
       /// be moved back to the pool.
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.IndexCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -673,11 +770,8 @@ namespace Azure { namespace Core { namespace Test {
 
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
             0);
       }
     }
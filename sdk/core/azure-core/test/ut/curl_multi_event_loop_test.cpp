@@ -0,0 +1,435 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/curl_transport.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/core/platform.hpp>
+
+// The next include is from an Azure Core private header.
+// It is included to know whether the libcurl version supports the event loop.
+#include <http/curl/curl_multi_private.hpp>
+
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED) && defined(AZ_PLATFORM_LINUX)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Core;
+using namespace Azure::Core::Http;
+using namespace std::chrono_literals;
+
+#if defined(_azure_CURL_MULTI_EVENT_LOOP_SUPPORTED) && defined(AZ_PLATFORM_LINUX)
+namespace {
+// HTTP/1.1 server on the loopback interface, so the event loop can be tested without a network.
+// Each connection is served on its own thread, until the client closes it.
+class LocalHttpServer final {
+public:
+  // Gets the request line and headers, and the request body. Returns the response to send, or an
+  // empty string when it wrote the response to the socket itself.
+  using Handler = std::function<std::string(int socket, std::string const&, std::string const&)>;
+
+  explicit LocalHttpServer(Handler handler) : m_handler(std::move(handler))
+  {
+    m_socket = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addressLength = sizeof(address);
+    if (m_socket < 0 || bind(m_socket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0
+        || listen(m_socket, 16) != 0
+        || getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+    {
+      throw std::runtime_error("Could not start the local HTTP server.");
+    }
+    m_port = ntohs(address.sin_port);
+    m_acceptThread = std::thread([this]() { Accept(); });
+  }
+
+  ~LocalHttpServer()
+  {
+    shutdown(m_socket, SHUT_RDWR);
+    m_acceptThread.join();
+    close(m_socket);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto connection : m_connections)
+    {
+      shutdown(connection, SHUT_RDWR);
+    }
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  std::string Url(std::string const& path) const
+  {
+    return "http://127.0.0.1:" + std::to_string(m_port) + path;
+  }
+
+  static bool SendAll(int socket, std::string const& data)
+  {
+    for (size_t sent = 0; sent < data.size();)
+    {
+      auto const result = send(socket, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (result <= 0)
+      {
+        return false;
+      }
+      sent += static_cast<size_t>(result);
+    }
+    return true;
+  }
+
+private:
+  Handler m_handler;
+  int m_socket = -1;
+  uint16_t m_port = 0;
+  std::thread m_acceptThread;
+  std::mutex m_mutex;
+  std::vector<int> m_connections;
+  std::vector<std::thread> m_threads;
+
+  void Accept()
+  {
+    while (true)
+    {
+      int const connection = accept(m_socket, nullptr, nullptr);
+      if (connection < 0)
+      {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_connections.push_back(connection);
+      m_threads.emplace_back([this, connection]() {
+        Serve(connection);
+        close(connection);
+      });
+    }
+  }
+
+  void Serve(int connection)
+  {
+    std::string received;
+    char buffer[16 * 1024];
+    while (true)
+    {
+      auto const headEnd = received.find("\r\n\r\n");
+      if (headEnd == std::string::npos)
+      {
+        auto const result = recv(connection, buffer, sizeof(buffer), 0);
+        if (result <= 0)
+        {
+          return;
+        }
+        received.append(buffer, static_cast<size_t>(result));
+        continue;
+      }
+
+      auto head = received.substr(0, headEnd);
+      received.erase(0, headEnd + 4);
+      std::transform(head.begin(), head.end(), head.begin(), [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      });
+      if (head.find("expect: 100-continue") != std::string::npos
+          && !SendAll(connection, "HTTP/1.1 100 Continue\r\n\r\n"))
+      {
+        return;
+      }
+
+      size_t contentLength = 0;
+      auto const contentLengthHeader = head.find("content-length:");
+      if (contentLengthHeader != std::string::npos)
+      {
+        contentLength = std::stoul(head.substr(contentLengthHeader + 15));
+      }
+      while (received.size() < contentLength)
+      {
+        auto const result = recv(connection, buffer, sizeof(buffer), 0);
+        if (result <= 0)
+        {
+          return;
+        }
+        received.append(buffer, static_cast<size_t>(result));
+      }
+      auto const body = received.substr(0, contentLength);
+      received.erase(0, contentLength);
+
+      auto const response = m_handler(connection, head, body);
+      if (!response.empty() && !SendAll(connection, response))
+      {
+        return;
+      }
+    }
+  }
+};
+
+std::string OkResponse(std::string const& body)
+{
+  return "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+// Replies to the requests with the length of their body.
+std::string BodyLengthHandler(int, std::string const&, std::string const& body)
+{
+  return OkResponse(std::to_string(body.size()));
+}
+
+// Request body which blocks once it reached an offset, until it is released or its context is
+// cancelled.
+class BlockingBodyStream final : public IO::BodyStream {
+public:
+  BlockingBodyStream(int64_t length, int64_t blockAt) : m_length(length), m_blockAt(blockAt) {}
+
+  int64_t Length() const override { return m_length; }
+  void Rewind() override { m_offset = 0; }
+
+  std::future<void> Blocked() { return m_blocked.get_future(); }
+
+  void Release()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_released = true;
+    m_releasedChanged.notify_all();
+  }
+
+  std::vector<std::thread::id> ReadingThreads()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_readingThreads;
+  }
+
+  std::atomic<int> ActiveReads{0};
+  std::atomic<int> Reads{0};
+
+private:
+  int64_t m_length;
+  int64_t m_blockAt;
+  int64_t m_offset = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_releasedChanged;
+  bool m_released = false;
+  bool m_blockedSignaled = false;
+  std::promise<void> m_blocked;
+  std::vector<std::thread::id> m_readingThreads;
+
+  size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override
+  {
+    ++Reads;
+    ++ActiveReads;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_readingThreads.push_back(std::this_thread::get_id());
+    if (m_offset >= m_blockAt && !m_released)
+    {
+      if (!m_blockedSignaled)
+      {
+        m_blockedSignaled = true;
+        m_blocked.set_value();
+      }
+      while (!m_releasedChanged.wait_for(lock, 10ms, [this]() { return m_released; }))
+      {
+        if (context.IsCancelled())
+        {
+          --ActiveReads;
+          context.ThrowIfCancelled();
+        }
+      }
+    }
+    auto const end = m_released ? m_length : (std::min)(m_length, m_blockAt);
+    auto const length = (std::min)(static_cast<int64_t>(count), end - m_offset);
+    std::fill(buffer, buffer + length, static_cast<uint8_t>('x'));
+    m_offset += length;
+    --ActiveReads;
+    return static_cast<size_t>(length);
+  }
+};
+
+std::shared_ptr<HttpTransport> GetEventLoopTransport()
+{
+  CurlTransportOptions options;
+  options.EnableCurlMultiEventLoop = true;
+  return std::make_shared<CurlTransport>(options);
+}
+
+std::string ReadBody(RawResponse& response)
+{
+  auto const body = response.ExtractBodyStream()->ReadToEnd();
+  return std::string(body.begin(), body.end());
+}
+
+// Gets the thread running the event loop, which invokes the callbacks of the asynchronous sends.
+std::future<std::thread::id> SendAsyncGet(HttpTransport& transport, Request& request)
+{
+  auto promise = std::make_shared<std::promise<std::thread::id>>();
+  transport.SendAsync(
+      request, Context(), [promise](std::unique_ptr<RawResponse> response, std::exception_ptr) {
+        if (response && response->GetStatusCode() == HttpStatusCode::Ok)
+        {
+          promise->set_value(std::this_thread::get_id());
+        }
+        else
+        {
+          promise->set_exception(
+              std::make_exception_ptr(std::runtime_error("The request failed.")));
+        }
+      });
+  return promise->get_future();
+}
+} // namespace
+
+namespace Azure { namespace Core { namespace Test {
+
+  TEST(CurlMultiEventLoop, UploadPausedWhileBodyStreamBlocks)
+  {
+    LocalHttpServer server(BodyLengthHandler);
+    auto transport = GetEventLoopTransport();
+
+    // The first chunk is read by the sending thread, the body stream then blocks.
+    BlockingBodyStream bodyStream(512 * 1024, 64 * 1024);
+    auto blocked = bodyStream.Blocked();
+    Request upload(HttpMethod::Put, Url(server.Url("/upload")), &bodyStream);
+    auto uploaded = std::async(std::launch::async, [&]() {
+      auto response = transport->Send(upload, Context());
+      EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+      return ReadBody(*response);
+    });
+    ASSERT_EQ(blocked.wait_for(10s), std::future_status::ready);
+
+    // The event loop keeps driving the other requests meanwhile.
+    Request get(HttpMethod::Get, Url(server.Url("/get")));
+    auto eventLoopThread = SendAsyncGet(*transport, get);
+    ASSERT_EQ(eventLoopThread.wait_for(10s), std::future_status::ready);
+    auto const eventLoopThreadId = eventLoopThread.get();
+
+    bodyStream.Release();
+    ASSERT_EQ(uploaded.wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(uploaded.get(), std::to_string(512 * 1024));
+
+    auto const readingThreads = bodyStream.ReadingThreads();
+    EXPECT_GT(readingThreads.size(), 2U);
+    EXPECT_EQ(
+        std::find(readingThreads.begin(), readingThreads.end(), eventLoopThreadId),
+        readingThreads.end());
+  }
+
+  TEST(CurlMultiEventLoop, SendAsyncUploadPausedWhileBodyStreamBlocks)
+  {
+    LocalHttpServer server(BodyLengthHandler);
+    auto transport = GetEventLoopTransport();
+
+    BlockingBodyStream bodyStream(512 * 1024, 64 * 1024);
+    auto blocked = bodyStream.Blocked();
+    Request upload(HttpMethod::Put, Url(server.Url("/upload")), &bodyStream);
+    std::promise<std::string> uploaded;
+    transport->SendAsync(
+        upload,
+        Context(),
+        [&uploaded](std::unique_ptr<RawResponse> response, std::exception_ptr error) {
+          if (error)
+          {
+            uploaded.set_exception(error);
+            return;
+          }
+          auto const& body = response->GetBody();
+          uploaded.set_value(std::string(body.begin(), body.end()));
+        });
+    ASSERT_EQ(blocked.wait_for(10s), std::future_status::ready);
+
+    bodyStream.Release();
+    auto response = uploaded.get_future();
+    ASSERT_EQ(response.wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(response.get(), std::to_string(512 * 1024));
+  }
+
+  TEST(CurlMultiEventLoop, CancelWhileWaitingForBodyStream)
+  {
+    LocalHttpServer server(BodyLengthHandler);
+    auto transport = GetEventLoopTransport();
+
+    auto bodyStream = std::make_unique<BlockingBodyStream>(512 * 1024, 64 * 1024);
+    auto blocked = bodyStream->Blocked();
+    Request upload(HttpMethod::Put, Url(server.Url("/upload")), bodyStream.get());
+    Context context;
+    auto uploaded = std::async(
+        std::launch::async, [&]() { static_cast<void>(transport->Send(upload, context)); });
+    ASSERT_EQ(blocked.wait_for(10s), std::future_status::ready);
+
+    context.Cancel();
+    ASSERT_EQ(uploaded.wait_for(10s), std::future_status::ready);
+    EXPECT_THROW(uploaded.get(), Azure::Core::OperationCancelledException);
+
+    // The body stream is not read anymore once the request is done, so the caller can destroy it.
+    EXPECT_EQ(bodyStream->ActiveReads.load(), 0);
+    auto const reads = bodyStream->Reads.load();
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(bodyStream->Reads.load(), reads);
+    bodyStream.reset();
+
+    Request get(HttpMethod::Get, Url(server.Url("/get")));
+    EXPECT_EQ(transport->Send(get, Context())->GetStatusCode(), HttpStatusCode::Ok);
+  }
+
+  TEST(CurlMultiEventLoop, AbandonPartlyReadBody)
+  {
+    constexpr size_t ResponseLength = 16 * 1024 * 1024;
+    std::promise<void> connectionClosed;
+    LocalHttpServer server([&](int socket, std::string const& head, std::string const&) {
+      if (head.find("/large") == std::string::npos)
+      {
+        return OkResponse("ok");
+      }
+      // More than the event loop buffers, so the transfer is paused until the body is read.
+      std::string const chunk(64 * 1024, 'x');
+      bool sent = LocalHttpServer::SendAll(
+          socket,
+          "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(ResponseLength) + "\r\n\r\n");
+      for (size_t length = 0; sent && length < ResponseLength; length += chunk.size())
+      {
+        sent = LocalHttpServer::SendAll(socket, chunk);
+      }
+      if (!sent)
+      {
+        connectionClosed.set_value();
+      }
+      return std::string();
+    });
+    auto transport = GetEventLoopTransport();
+
+    {
+      Request request(HttpMethod::Get, Url(server.Url("/large")));
+      auto response = transport->Send(request, Context());
+      ASSERT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+      auto bodyStream = response->ExtractBodyStream();
+      EXPECT_EQ(bodyStream->Length(), static_cast<int64_t>(ResponseLength));
+      std::vector<uint8_t> buffer(1024);
+      EXPECT_EQ(bodyStream->ReadToCount(buffer.data(), buffer.size(), Context()), buffer.size());
+    }
+
+    // Abandoning the body closes the connection instead of downloading the rest of the body.
+    EXPECT_EQ(connectionClosed.get_future().wait_for(10s), std::future_status::ready);
+
+    Request get(HttpMethod::Get, Url(server.Url("/get")));
+    auto response = transport->Send(get, Context());
+    EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+    EXPECT_EQ(ReadBody(*response), "ok");
+  }
+
+}}} // namespace Azure::Core::Test
+#endif
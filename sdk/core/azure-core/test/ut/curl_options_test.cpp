@@ -104,8 +104,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
   class CurlDerived : public Azure::Core::Http::CurlTransport {
@@ -246,8 +245,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
 #if !defined(AZ_PLATFORM_MAC)
@@ -291,8 +289,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
 #else
     EXPECT_THROW(
         pipeline.Send(request, Azure::Core::Context{}), Azure::Core::Http::TransportException);
@@ -344,8 +341,7 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 
 #if _azure_DISABLE_HTTP_BIN_TESTS
@@ -385,8 +381,7 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Make sure there are no connections in the pool
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
         0);
   }
 
@@ -427,7 +422,6 @@ namespace Azure { namespace Core { namespace Test {
 
     // Clean the connection from the pool *Windows fails to clean if we leave to be clean upon
     // app-destruction
-    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                        .ConnectionPoolIndex.clear());
+    EXPECT_NO_THROW(Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear());
   }
 }}} // namespace Azure::Core::Test
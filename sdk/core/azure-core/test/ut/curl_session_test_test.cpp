@@ -86,8 +86,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, chunkBadFormatResponse)
@@ -137,8 +136,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_THROW(bodyS->ReadToEnd(Azure::Core::Context{}), Azure::Core::Http::TransportException);
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, invalidHeader)
@@ -317,14 +315,130 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(bodyS->ReadToEnd(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, chunkResponseReadView)
+  {
+    // The first chunk is received with the headers, the second one is read from the wire.
+    std::string response0("HTTP/1.1 200 Ok\r\ntransfer-encoding: chunked\r\n\r\n3\r\nabc\r\n");
+    std::string response1("4\r\n");
+    std::string response2("defg");
+    std::string response3("\r\n0\r\n\r\n");
+    int32_t const payloadSize0 = static_cast<int32_t>(response0.size());
+    int32_t const payloadSize1 = static_cast<int32_t>(response1.size());
+    int32_t const payloadSize2 = static_cast<int32_t>(response2.size());
+    int32_t const payloadSize3 = static_cast<int32_t>(response3.size());
+
+    std::string connectionKey("connection-key");
+
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response0.data(), response0.data() + payloadSize0),
+            Return(payloadSize0)))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response1.data(), response1.data() + payloadSize1),
+            Return(payloadSize1)))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response2.data(), response2.data() + payloadSize2),
+            Return(payloadSize2)))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response3.data(), response3.data() + payloadSize3),
+            Return(payloadSize3)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto response = session->ExtractResponse();
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      std::string body;
+      auto view = bodyS->ReadView(2);
+      EXPECT_EQ(view.Size, 2);
+      body.append(view.Data, view.Data + view.Size);
+      for (view = bodyS->ReadView(10); view.Size != 0; view = bodyS->ReadView(10))
+      {
+        body.append(view.Data, view.Data + view.Size);
+      }
+      EXPECT_EQ(body, "abcdefg");
+    }
+    // The whole response was read, the connection was moved to the pool.
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, smallReadsFromReadBuffer)
+  {
+    std::string response0("HTTP/1.1 200 Ok\r\ncontent-length: 3000\r\n\r\n");
+    std::string response1(3000, 'x');
+    int32_t const payloadSize0 = static_cast<int32_t>(response0.size());
+    int32_t const payloadSize1 = static_cast<int32_t>(response1.size());
+
+    std::string connectionKey("connection-key");
+
+    // The whole body is read from the wire at once, through the read buffer which grows up to the
+    // content length.
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, 1024, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response0.data(), response0.data() + payloadSize0),
+            Return(payloadSize0)));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, 3000, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response1.data(), response1.data() + payloadSize1),
+            Return(payloadSize1)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      // Raised to the minimum size.
+      transportOptions.ReadBufferSize = 10;
+      transportOptions.EnableAdaptiveReadBuffer = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto response = session->ExtractResponse();
+      response->SetBodyStream(std::move(session));
+      auto bodyS = response->ExtractBodyStream();
+
+      uint8_t buffer[7];
+      std::string body;
+      for (size_t read; (read = bodyS->Read(buffer, sizeof(buffer))) != 0;)
+      {
+        body.append(buffer, buffer + read);
+      }
+      EXPECT_EQ(body, response1);
+    }
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, DoNotReuseConnectionIfDownloadFail)
   {
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
     // Can't mock the curlMock directly from a unique ptr, heap allocate it first and then make a
     // unique ptr for it
     MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
@@ -351,8 +465,7 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Check connection pool is empty (connection was not moved to the pool)
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.IndexCount(),
         0);
   }
 }}} // namespace Azure::Core::Test
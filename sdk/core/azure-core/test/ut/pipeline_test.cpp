@@ -145,3 +145,43 @@ TEST(Pipeline, AdditionalPolicies)
   EXPECT_EQ(perRetryPolicyCloneCount, 4);
   EXPECT_EQ(perRetryClientPolicyCloneCount, 5);
 }
+
+TEST(Pipeline, SendAsync)
+{
+  using namespace Azure::Core::Http;
+
+  class TestTransport final : public HttpTransport {
+  public:
+    std::unique_ptr<RawResponse> Send(Request&, Azure::Core::Context const&) override
+    {
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+    }
+  };
+
+  Policies::TransportOptions transportOptions;
+  transportOptions.Transport = std::make_shared<TestTransport>();
+  std::vector<std::unique_ptr<Policies::HttpPolicy>> policies;
+  policies.push_back(std::make_unique<Policies::_internal::TelemetryPolicy>("test", "test"));
+  policies.push_back(std::make_unique<Policies::_internal::TransportPolicy>(transportOptions));
+  _internal::HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Azure::Core::Url("http://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context()).get();
+
+  EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+  EXPECT_TRUE(request.GetHeader("User-Agent").HasValue());
+}
+
+TEST(Pipeline, SendAsyncWithoutTransport)
+{
+  using namespace Azure::Core::Http;
+
+  std::vector<std::unique_ptr<Policies::HttpPolicy>> policies;
+  policies.push_back(std::make_unique<Policies::_internal::TelemetryPolicy>("test", "test"));
+  _internal::HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Azure::Core::Url("http://www.microsoft.com"));
+  auto response = pipeline.SendAsync(request, Azure::Core::Context());
+
+  EXPECT_THROW(response.get(), std::invalid_argument);
+}
@@ -6,6 +6,8 @@
 #include "azure/core/internal/http/pipeline.hpp"
 
 #include <functional>
+#include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -833,3 +835,112 @@ TEST(RetryPolicy, LogMessages)
   EXPECT_EQ(log.Entries[4].Level, Logger::Level::Informational);
   EXPECT_EQ(log.Entries[4].Message, "HTTP status code 503 won't be retried.");
 }
+
+TEST(RetryPolicy, SendAsync)
+{
+  using namespace std::chrono_literals;
+  RetryOptions const retryOptions{3, 1ms, 1ms, {HttpStatusCode::ServiceUnavailable}};
+
+  {
+    int attempts = 0;
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<RetryPolicyTest>(retryOptions, nullptr, nullptr));
+    policies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+      ++attempts;
+      return std::make_unique<RawResponse>(
+          1, 1, attempts < 3 ? HttpStatusCode::ServiceUnavailable : HttpStatusCode::Ok, "");
+    }));
+
+    Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+    Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+    auto response = pipeline.SendAsync(request, Azure::Core::Context()).get();
+
+    EXPECT_EQ(response->GetStatusCode(), HttpStatusCode::Ok);
+    EXPECT_EQ(attempts, 3);
+  }
+
+  {
+    int attempts = 0;
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<RetryPolicyTest>(retryOptions, nullptr, nullptr));
+    policies.emplace_back(
+        std::make_unique<TestTransportPolicy>([&]() -> std::unique_ptr<RawResponse> {
+          ++attempts;
+          throw TransportException("Test");
+        }));
+
+    Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+    Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+    auto response = pipeline.SendAsync(request, Azure::Core::Context());
+
+    EXPECT_THROW(response.get(), TransportException);
+    EXPECT_EQ(attempts, 4);
+  }
+
+  {
+    Azure::Core::Context context;
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<RetryPolicyTest>(retryOptions, nullptr, nullptr));
+    policies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+      context.Cancel();
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "");
+    }));
+
+    Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+    Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+    auto response = pipeline.SendAsync(request, context);
+
+    EXPECT_THROW(response.get(), Azure::Core::OperationCancelledException);
+  }
+}
+
+TEST(RetryPolicy, SendAsyncRetriesRunConcurrently)
+{
+  using namespace std::chrono_literals;
+  RetryOptions const retryOptions{1, 1ms, 1ms, {HttpStatusCode::ServiceUnavailable}};
+
+  // The retry of the first request blocks until the retry of the second one has run, which needs
+  // another thread than the one running the first retry.
+  std::promise<void> secondRetried;
+  auto secondRetriedFuture = secondRetried.get_future();
+  int firstAttempts = 0;
+  int secondAttempts = 0;
+
+  std::vector<std::unique_ptr<HttpPolicy>> firstPolicies;
+  firstPolicies.emplace_back(std::make_unique<RetryPolicyTest>(retryOptions, nullptr, nullptr));
+  firstPolicies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+    if (++firstAttempts == 1)
+    {
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "");
+    }
+    return std::make_unique<RawResponse>(
+        1,
+        1,
+        secondRetriedFuture.wait_for(10s) == std::future_status::ready
+            ? HttpStatusCode::Ok
+            : HttpStatusCode::RequestTimeout,
+        "");
+  }));
+
+  std::vector<std::unique_ptr<HttpPolicy>> secondPolicies;
+  secondPolicies.emplace_back(std::make_unique<RetryPolicyTest>(retryOptions, nullptr, nullptr));
+  secondPolicies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+    if (++secondAttempts == 1)
+    {
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "");
+    }
+    secondRetried.set_value();
+    return std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "");
+  }));
+
+  Azure::Core::Http::_internal::HttpPipeline firstPipeline(firstPolicies);
+  Azure::Core::Http::_internal::HttpPipeline secondPipeline(secondPolicies);
+  Request firstRequest(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  Request secondRequest(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto firstResponse = firstPipeline.SendAsync(firstRequest, Azure::Core::Context());
+  std::this_thread::sleep_for(50ms);
+  auto secondResponse = secondPipeline.SendAsync(secondRequest, Azure::Core::Context());
+
+  EXPECT_EQ(secondResponse.get()->GetStatusCode(), HttpStatusCode::Ok);
+  EXPECT_EQ(firstResponse.get()->GetStatusCode(), HttpStatusCode::Ok);
+}
@@ -33,6 +33,16 @@ namespace Azure { namespace Core { namespace Test {
       return TransportAdaptersTestParameter(std::move(suffix), options);
     }
 
+#if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
+    // Produces the libcurl adapter which drives the requests from the multi handle event loop.
+    static std::shared_ptr<Azure::Core::Http::HttpTransport> GetCurlEventLoopTransport()
+    {
+      Azure::Core::Http::CurlTransportOptions curlOptions;
+      curlOptions.EnableCurlMultiEventLoop = true;
+      return std::make_shared<Azure::Core::Http::CurlTransport>(curlOptions);
+    }
+#endif
+
     // When adding more than one parameter, this function should return a unique string.
     static std::string GetSuffix(const testing::TestParamInfo<TransportAdapter::ParamType>& info)
     {
@@ -54,7 +64,8 @@ namespace Azure { namespace Core { namespace Test {
       TransportAdapter,
       testing::Values(
           GetTransportOptions("winHttp", std::make_shared<Azure::Core::Http::WinHttpTransport>()),
-          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>())),
+          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>()),
+          GetTransportOptions("libCurlEventLoop", GetCurlEventLoopTransport())),
       GetSuffix);
 
 #elif defined(BUILD_TRANSPORT_WINHTTP_ADAPTER)
@@ -72,7 +83,8 @@ namespace Azure { namespace Core { namespace Test {
       Test,
       TransportAdapter,
       testing::Values(
-          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>())),
+          GetTransportOptions("libCurl", std::make_shared<Azure::Core::Http::CurlTransport>()),
+          GetTransportOptions("libCurlEventLoop", GetCurlEventLoopTransport())),
       GetSuffix);
 #else
   /* Custom adapter. Not adding tests */
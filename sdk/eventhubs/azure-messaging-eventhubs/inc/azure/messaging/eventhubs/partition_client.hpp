@@ -48,6 +48,17 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
 
     int32_t Prefetch = 300;
+
+    /**@brief MaxPrefetchBytes bounds the size of the internal prefetch buffer, in bytes, including
+     * the events which the service can still send before they are requested.
+     *
+     * When set, the number of events prefetched adapts, up to Prefetch, to the size of the events
+     * received and to the rate at which ReceiveEvents() takes them, so that a slow consumer of
+     * large events does not buffer them without bound.
+     *
+     * Disabled if MaxPrefetchBytes == 0, which is the default.
+     */
+    uint64_t MaxPrefetchBytes{};
   };
 
   /** PartitionClient is used to receive events from an Event Hub partition.
@@ -83,6 +94,20 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         uint32_t maxMessages,
         Core::Context const& context = {});
 
+    /** Receive events from the partition into a vector owned by the caller.
+     *
+     * @remark Reusing the same vector across calls avoids reallocating it for every batch.
+     *
+     * @param events Receives the events. It is cleared first, but its capacity is kept.
+     * @param maxMessages The maximum number of messages to receive.
+     * @param context A context to control the request lifetime.
+     *
+     */
+    void ReceiveEvents(
+        std::vector<std::shared_ptr<const Models::ReceivedEventData>>& events,
+        uint32_t maxMessages,
+        Core::Context const& context = {});
+
     /** @brief Closes the connection to the Event Hub service.
      */
     void Close(Core::Context const& context) { m_receiver.Close(context); }
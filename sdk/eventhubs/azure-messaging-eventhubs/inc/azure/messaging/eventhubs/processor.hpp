@@ -60,6 +60,14 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     int32_t Prefetch{300};
 
+    /**@brief MaxPrefetchBytes bounds the size of the internal prefetch buffer, in bytes, of each
+     * ProcessorPartitionClient created by this Processor. See
+     * PartitionClientOptions::MaxPrefetchBytes.
+     *
+     * Disabled if MaxPrefetchBytes == 0, which is the default.
+     */
+    uint64_t MaxPrefetchBytes{};
+
     /** @brief Specifies the maximum number of partitions to process.
      *
      * By default, the processor will process all available partitions. If a client desires limiting
@@ -270,6 +278,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::shared_ptr<CheckpointStore> m_checkpointStore;
     std::shared_ptr<ConsumerClient> m_consumerClient;
     int32_t m_prefetch;
+    uint64_t m_maxPrefetchBytes;
     Channel<std::shared_ptr<ProcessorPartitionClient>> m_nextPartitionClients;
     Models::ConsumerClientDetails m_consumerClientDetails;
     std::shared_ptr<_detail::ProcessorLoadBalancer> m_loadBalancer;
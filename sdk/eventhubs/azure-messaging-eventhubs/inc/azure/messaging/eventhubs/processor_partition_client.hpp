@@ -43,6 +43,19 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       return m_partitionClient->ReceiveEvents(maxBatchSize, context);
     }
 
+    /** Receives Events from the partition into a vector owned by the caller.
+     * @param events Receives the events. It is cleared first, but its capacity is kept.
+     * @param maxBatchSize The maximum number of events to receive in a single call to the service.
+     * @param context The context to pass to the update checkpoint operation.
+     */
+    void ReceiveEvents(
+        std::vector<std::shared_ptr<const Models::ReceivedEventData>>& events,
+        uint32_t maxBatchSize,
+        Core::Context const& context = {})
+    {
+      m_partitionClient->ReceiveEvents(events, maxBatchSize, context);
+    }
+
     /**
      * @brief Updates the checkpoint for this partition using the given event data.
      *
@@ -13,6 +13,8 @@
 #include <azure/core/credentials/credentials.hpp>
 #include <azure/core/http/policies/policy.hpp>
 
+#include <exception>
+#include <functional>
 #include <iostream>
 
 namespace Azure { namespace Messaging { namespace EventHubs {
@@ -43,6 +45,11 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     Azure::Nullable<std::uint64_t> MaxMessageSize{};
 
+    /**@brief  The maximum number of batches sent with SendAsync to a partition which may be pending
+     * at once. When this many batches are pending, SendAsync blocks until one of them completes.
+     */
+    std::uint32_t MaxPendingSends{16};
+
   private:
     // The friend declaration is needed so that ProducerClient could access CppStandardVersion,
     // and it is not a struct's public field like the ones above to be set non-programmatically.
@@ -144,6 +151,29 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     void Send(std::vector<Models::EventData> const& eventData, Core::Context const& context = {});
 
+    /**@brief Callback invoked when a batch sent with SendAsync completes.
+     *
+     * @param error Null if the batch was accepted by the Event Hub, or the exception describing why
+     * it was not, usually an #EventHubsException.
+     */
+    using SendCompleteCallback = std::function<void(std::exception_ptr error)>;
+
+    /**@brief Send an EventDataBatch to the remote Event Hub without waiting for it to be accepted.
+     *
+     * @remark Successive calls keep up to ProducerClientOptions::MaxPendingSends batches in flight
+     * per partition, so that the throughput is not limited by the round trip to the service. The
+     * batches of a partition are sent in order. Unlike Send, a failed batch is not retried.
+     *
+     * @param eventDataBatch Batch to send
+     * @param onSendComplete Invoked once the batch completes. It is invoked from the AMQP polling
+     * thread, and must not block or call Send or SendAsync.
+     * @param context Request context, used while waiting for a pending batch to complete.
+     */
+    void SendAsync(
+        EventDataBatch const& eventDataBatch,
+        SendCompleteCallback onSendComplete,
+        Core::Context const& context = {});
+
     /**@brief  GetEventHubProperties gets properties of an eventHub. This includes data
      * like name, and partitions.
      *
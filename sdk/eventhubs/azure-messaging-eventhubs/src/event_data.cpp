@@ -10,6 +10,7 @@
 #include <azure/core/internal/diagnostics/log.hpp>
 
 #include <iostream>
+#include <utility>
 
 using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
@@ -49,14 +50,16 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
       {
         continue;
       }
-      auto key = item.first;
-      if (key == _detail::EnqueuedTimeAnnotation)
+      // The Key in MessageAnnotations is normally an AmqpSymbol, cast it to a string Key once, so
+      // that the comparisons below do not each convert the annotation name to an AmqpValue.
+      std::string keyName = static_cast<std::string>(item.first);
+      if (keyName == _detail::EnqueuedTimeAnnotation)
       {
         auto timePoint = static_cast<std::chrono::milliseconds>(item.second.AsTimestamp());
         auto dateTime = Azure::DateTime{Azure::DateTime::time_point{timePoint}};
         EnqueuedTime = dateTime;
       }
-      else if (key == _detail::OffsetAnnotation)
+      else if (keyName == _detail::OffsetAnnotation)
       {
         switch (item.second.GetType())
         {
@@ -67,25 +70,22 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Models {
             break;
         }
       }
-      else if (key == _detail::PartitionKeyAnnotation)
+      else if (keyName == _detail::PartitionKeyAnnotation)
       {
         PartitionKey = static_cast<std::string>(item.second);
       }
-      else if (key == _detail::SequenceNumberAnnotation)
+      else if (keyName == _detail::SequenceNumberAnnotation)
       {
         SequenceNumber = item.second;
       }
       else
       {
-        // The Key in MessageAnnotations is normally an AmqpSymbol, cast it to a string Key when
-        // placing in SystemProperties.
-        std::string keyName = static_cast<std::string>(key);
-        auto result{SystemProperties.emplace(keyName, item.second)};
+        auto result{SystemProperties.emplace(std::move(keyName), item.second)};
         if (!result.second)
         {
           // If the key already exists, log a warning.
           Log::Stream(Logger::Level::Warning)
-              << "Duplicate key in MessageAnnotations: " << key << std::endl;
+              << "Duplicate key in MessageAnnotations: " << item.first << std::endl;
         }
       }
     }
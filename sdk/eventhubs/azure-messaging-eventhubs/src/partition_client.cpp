@@ -131,6 +131,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       {
         receiverOptions.MaxLinkCredit = options.Prefetch;
       }
+      receiverOptions.MaxBufferedBytes = options.MaxPrefetchBytes;
       receiverOptions.Name = receiverName;
       receiverOptions.Properties.emplace("com.microsoft:receiver-name", receiverName);
       if (options.OwnerLevel.HasValue())
@@ -165,6 +166,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       {
         receiverOptions.MaxLinkCredit = options.Prefetch;
       }
+      receiverOptions.MaxBufferedBytes = options.MaxPrefetchBytes;
       receiverOptions.Name = receiverName;
       receiverOptions.Properties.emplace(AmqpSymbol{"com.microsoft:receiver-name"}, receiverName);
       if (options.OwnerLevel.HasValue())
@@ -227,47 +229,60 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       Core::Context const& context)
   {
     std::vector<std::shared_ptr<const Models::ReceivedEventData>> messages;
+    ReceiveEvents(messages, maxMessages, context);
+    return messages;
+  }
+
+  void PartitionClient::ReceiveEvents(
+      std::vector<std::shared_ptr<const Models::ReceivedEventData>>& messages,
+      uint32_t maxMessages,
+      Core::Context const& context)
+  {
+    messages.clear();
+    std::vector<std::pair<
+        std::shared_ptr<const Azure::Core::Amqp::Models::AmqpMessage>,
+        Azure::Core::Amqp::Models::_internal::AmqpError>>
+        results;
 
     while (messages.size() < maxMessages && !context.IsCancelled())
     {
-      std::pair<
-          std::shared_ptr<const Azure::Core::Amqp::Models::AmqpMessage>,
-          Azure::Core::Amqp::Models::_internal::AmqpError>
-          result;
-
-      // TryPeekForIncomingMessage will return two empty values if there is no data available.
-      result = m_receiver.TryWaitForIncomingMessage();
-      if (result.first)
+      // Take all the messages which are already available at once.
+      results.clear();
+      m_receiver.TryWaitForIncomingMessages(results, maxMessages - messages.size());
+      for (auto const& result : results)
       {
-        messages.push_back(std::make_shared<Models::ReceivedEventData>(result.first));
+        if (result.first)
+        {
+          messages.push_back(std::make_shared<const Models::ReceivedEventData>(result.first));
+        }
+        else if (result.second)
+        {
+          throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
+        }
       }
-      else if (result.second)
+      if (!results.empty())
       {
-        throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
+        continue;
       }
-      // If we haven't gotten *any* messages, we're done. Otherwise, we'll wait for more.
-      else if (!messages.empty())
+
+      // No more messages are available. Return the ones we have, or wait for the first one.
+      if (!messages.empty())
       {
         break;
       }
+      auto result = m_receiver.WaitForIncomingMessage(context);
+      if (result.first)
+      {
+        Log::Stream(Logger::Level::Verbose)
+            << "Received message. Message count now " << messages.size();
+        messages.push_back(std::make_shared<const Models::ReceivedEventData>(result.first));
+      }
       else
       {
-        result = m_receiver.WaitForIncomingMessage(context);
-        if (result.first)
-        {
-          Log::Stream(Logger::Level::Verbose)
-              << "Received message. Message count now " << messages.size();
-          messages.push_back(std::make_shared<const Models::ReceivedEventData>(result.first));
-        }
-        else
-        {
-          throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
-        }
+        throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
       }
     }
     Log::Stream(Logger::Level::Verbose)
         << "Receive Events. Return " << messages.size() << " messages.";
-
-    return messages;
   }
 }}} // namespace Azure::Messaging::EventHubs
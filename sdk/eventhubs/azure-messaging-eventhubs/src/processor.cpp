@@ -24,7 +24,8 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       : m_defaultStartPositions(options.StartPositions),
         m_maximumNumberOfPartitions{options.MaximumNumberOfPartitions},
         m_checkpointStore(checkpointStore), m_consumerClient(consumerClient),
-        m_prefetch(options.Prefetch), m_nextPartitionClients{}
+        m_prefetch(options.Prefetch), m_maxPrefetchBytes(options.MaxPrefetchBytes),
+        m_nextPartitionClients{}
   {
     m_ownershipUpdateInterval = options.UpdateInterval == Azure::DateTime::duration::zero()
         ? std::chrono::seconds(10)
@@ -188,6 +189,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     PartitionClientOptions partitionClientOptions;
     partitionClientOptions.StartPosition = startPosition;
     partitionClientOptions.Prefetch = m_prefetch;
+    partitionClientOptions.MaxPrefetchBytes = m_maxPrefetchBytes;
     partitionClientOptions.OwnerLevel = m_processorOwnerLevel;
 
     auto partitionClient{std::make_unique<PartitionClient>(
@@ -112,6 +112,43 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     });
   }
 
+  void ProducerClient::SendAsync(
+      EventDataBatch const& eventDataBatch,
+      SendCompleteCallback onSendComplete,
+      Core::Context const& context)
+  {
+    auto message = eventDataBatch.ToAmqpMessage();
+#if ENABLE_UAMQP
+    GetSender(eventDataBatch.GetPartitionId())
+        .SendAsync(
+            message,
+            [onSendComplete](
+                Azure::Core::Amqp::_internal::MessageSendStatus sendStatus,
+                Azure::Core::Amqp::Models::_internal::AmqpError const& error) {
+              if (sendStatus == Azure::Core::Amqp::_internal::MessageSendStatus::Ok)
+              {
+                onSendComplete(nullptr);
+                return;
+              }
+              onSendComplete(std::make_exception_ptr(
+                  Azure::Messaging::EventHubs::_detail::EventHubsExceptionFactory::
+                      CreateEventHubsException(error)));
+            },
+            context);
+#elif ENABLE_RUST_AMQP
+    // The Rust AMQP library has no asynchronous send, so the batch is sent before returning.
+    auto result = GetSender(eventDataBatch.GetPartitionId()).Send(message, context);
+    if (result)
+    {
+      onSendComplete(std::make_exception_ptr(
+          Azure::Messaging::EventHubs::_detail::EventHubsExceptionFactory::
+              CreateEventHubsException(result)));
+      return;
+    }
+    onSendComplete(nullptr);
+#endif
+  }
+
   void ProducerClient::Send(Models::EventData const& eventData, Core::Context const& context)
   {
     auto batch = CreateBatch(EventDataBatchOptions{}, context);
@@ -212,6 +249,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       senderOptions.Name = m_producerClientOptions.Name;
       senderOptions.EnableTrace = _detail::EnableAmqpTrace;
       senderOptions.MaxMessageSize = m_producerClientOptions.MaxMessageSize;
+      senderOptions.MaxPendingSends = m_producerClientOptions.MaxPendingSends;
 
       Azure::Core::Amqp::_internal::MessageSender sender
           = GetSession(partitionId).CreateMessageSender(targetUrl, senderOptions);
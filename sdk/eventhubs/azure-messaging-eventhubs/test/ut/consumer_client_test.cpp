@@ -72,6 +72,31 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
     EXPECT_TRUE(events[0]->Offset.HasValue());
   }
 
+  TEST_P(ConsumerClientTest, ReceiveEventsIntoVector_LIVEONLY_)
+  {
+    Azure::Messaging::EventHubs::ConsumerClientOptions options;
+    options.ApplicationID = testing::UnitTest::GetInstance()->current_test_info()->name();
+    options.Name = testing::UnitTest::GetInstance()->current_test_case()->name();
+    auto client = CreateConsumerClient("", options);
+    Azure::Messaging::EventHubs::PartitionClientOptions partitionOptions;
+    partitionOptions.StartPosition.Inclusive = true;
+    partitionOptions.StartPosition.Earliest = true;
+
+    Azure::Messaging::EventHubs::PartitionClient partitionClient
+        = client->CreatePartitionClient("1", partitionOptions);
+
+    // The same vector is reused across calls, and is cleared by each of them.
+    std::vector<std::shared_ptr<const Models::ReceivedEventData>> events;
+    partitionClient.ReceiveEvents(events, 2);
+    EXPECT_GE(events.size(), 1ul);
+    EXPECT_LE(events.size(), 2ul);
+    auto lastSequenceNumber = events.back()->SequenceNumber.Value();
+
+    partitionClient.ReceiveEvents(events, 1);
+    ASSERT_EQ(events.size(), 1ul);
+    EXPECT_GT(events[0]->SequenceNumber.Value(), lastSequenceNumber);
+  }
+
   TEST_P(ConsumerClientTest, GetEventHubProperties_LIVEONLY_)
   {
     std::string eventHubName{GetEventHubName()};
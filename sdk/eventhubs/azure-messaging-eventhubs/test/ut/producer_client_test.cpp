@@ -9,6 +9,7 @@
 #include <azure/identity.hpp>
 #include <azure/messaging/eventhubs.hpp>
 
+#include <future>
 #include <numeric>
 
 #include <gtest/gtest.h>
@@ -79,6 +80,36 @@ namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
     }
   }
 
+  TEST_P(ProducerClientTest, SendAsync_LIVEONLY_)
+  {
+    Azure::Messaging::EventHubs::ProducerClientOptions producerOptions;
+    producerOptions.Name = "sender-link";
+    producerOptions.ApplicationID = "some";
+    producerOptions.MaxPendingSends = 4;
+
+    auto client{CreateProducerClient("", producerOptions)};
+
+    Azure::Messaging::EventHubs::EventDataBatchOptions edboptions;
+    edboptions.PartitionId = "1";
+    Azure::Messaging::EventHubs::EventDataBatch eventBatch{client->CreateBatch(edboptions)};
+    EXPECT_TRUE(eventBatch.TryAdd(Azure::Messaging::EventHubs::Models::EventData{"Hello"}));
+
+    constexpr int BatchCount = 20;
+    std::vector<std::promise<std::exception_ptr>> results(BatchCount);
+    for (int i = 0; i < BatchCount; i++)
+    {
+      auto& result = results[i];
+      client->SendAsync(
+          eventBatch, [&result](std::exception_ptr error) { result.set_value(error); });
+    }
+    for (auto& result : results)
+    {
+      auto future = result.get_future();
+      ASSERT_EQ(future.wait_for(std::chrono::seconds(30)), std::future_status::ready);
+      EXPECT_EQ(future.get(), nullptr);
+    }
+  }
+
   TEST_P(ProducerClientTest, EventHubRawMessageSend_LIVEONLY_)
   {
     Azure::Messaging::EventHubs::ProducerClientOptions producerOptions;
@@ -43,6 +43,7 @@ namespace Azure { namespace Security { namespace KeyVault { namespace _internal
         : BearerTokenAuthenticationPolicy(std::move(credential), tokenRequestContext),
           m_tokenRequestContext(tokenRequestContext)
     {
+      EnableAsyncAuthorization();
     }
 
     std::unique_ptr<HttpPolicy> Clone() const override
@@ -53,17 +54,10 @@ namespace Azure { namespace Security { namespace KeyVault { namespace _internal
     }
 
   private:
-    std::unique_ptr<Core::Http::RawResponse> AuthorizeAndSendRequest(
-        Core::Http::Request& request,
-        Core::Http::Policies::NextHttpPolicy& nextPolicy,
-        Core::Context const& context) const override
+    void AuthorizeRequest(Core::Http::Request& request, Core::Context const& context) const override
     {
-      {
-        std::shared_lock<std::shared_timed_mutex> readLock(m_tokenRequestContextMutex);
-        AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
-      }
-
-      return nextPolicy.Send(request, context);
+      std::shared_lock<std::shared_timed_mutex> readLock(m_tokenRequestContextMutex);
+      AuthenticateAndAuthorizeRequest(request, m_tokenRequestContext, context);
     }
 
     bool AuthorizeRequestOnChallenge(
@@ -142,6 +142,24 @@ namespace Azure { namespace Storage { namespace Blobs {
         const AppendBlockOptions& options = AppendBlockOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Gets a stream which appends the data written to it to the end of the existing append
+     * blob.
+     *
+     * @remark The written data is gathered in blocks of TransferOptions.BlockSize bytes, which are
+     * appended in the background, one at a time and in order, while more data is written. Up to
+     * TransferOptions.Concurrency blocks wait to be appended before writing waits. Flushing the
+     * stream appends the data written so far, even if it does not fill a block.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. It is used for all the
+     * requests sent by the stream.
+     * @return A BlobOutputStream appending to the append blob.
+     */
+    BlobOutputStream GetOutputStream(
+        const GetAppendBlobOutputStreamOptions& options = GetAppendBlobOutputStreamOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Commits a new block of data, represented by the content BodyStream to the end
      * of the existing append blob.
@@ -286,6 +286,25 @@ namespace Azure { namespace Storage { namespace Blobs {
         const DownloadBlobToOptions& options = DownloadBlobToOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Opens a seekable stream over the content of the blob, which downloads it in blocks
+     * ahead of the read position.
+     *
+     * @remark TransferOptions.Concurrency blocks of TransferOptions.BlockSize bytes following the
+     * read position are downloaded at once, while the content is read. Up to
+     * TransferOptions.MaxCachedBlocks downloaded blocks are kept in memory, so that random reads
+     * close to each other do not download the same ranges again. All the blocks are read from the
+     * version of the blob the stream is opened on.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. It is used for all the
+     * requests sent by the stream.
+     * @return A BlobInputStream reading the blob.
+     */
+    BlobInputStream GetInputStream(
+        const GetBlobInputStreamOptions& options = GetBlobInputStreamOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Downloads a blob or a blob range from the service to a file using parallel
      * requests.
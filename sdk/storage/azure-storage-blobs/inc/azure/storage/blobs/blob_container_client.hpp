@@ -6,8 +6,10 @@
 #include "azure/storage/blobs/blob_client.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
@@ -212,6 +214,33 @@ namespace Azure { namespace Storage { namespace Blobs {
         const ListBlobsOptions& options = ListBlobsOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Lists the blobs in this container with several chains of requests at once, each one
+     * listing a range of blob names. Unlike #ListBlobs, whose pages can only be requested one after
+     * the other, it scales with the number of ranges, which makes it suited to the inventory of
+     * large containers.
+     *
+     * @param blobsReceived Invoked with the blobs of each page, which it can move from. It is not
+     * invoked concurrently. If it throws, or if a request fails, it is not invoked anymore, the
+     * ranges being listed stop before their next page, and the error is rethrown.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     */
+    void ListBlobsConcurrently(
+        const std::function<void(std::vector<Models::BlobItem>&)>& blobsReceived,
+        const ListBlobsConcurrentlyOptions& options = ListBlobsConcurrentlyOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Returns a reader going through the blobs in this container one at a time, like
+     * #ListBlobs, but parsing each page as it is received rather than once it is complete. Blobs
+     * are ordered lexicographically by name.
+     *
+     * @param options Optional parameters to execute this function.
+     * @return A ListBlobsReader, which sends the first request when it is first read.
+     */
+    ListBlobsReader GetListBlobsReader(const ListBlobsOptions& options = ListBlobsOptions()) const;
+
     /**
      * @brief Returns a collection of blobs in this container. Enumerating the blobs may make
      * multiple requests to the service while fetching all the values. Blobs are ordered
@@ -349,6 +378,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     friend class BlobServiceClient;
     friend class BlobLeaseClient;
     friend class BlobContainerBatch;
+    friend class ListBlobsReader;
     friend class Files::DataLake::DataLakeFileSystemClient;
   };
 
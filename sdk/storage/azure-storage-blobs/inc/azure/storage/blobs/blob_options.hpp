@@ -11,6 +11,8 @@
 #include <azure/core/modified_conditions.hpp>
 #include <azure/storage/common/access_conditions.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/transfer_buffer_pool.hpp>
+#include <azure/storage/common/transfer_executor.hpp>
 
 #include <chrono>
 #include <cstdint>
@@ -428,6 +430,64 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Nullable<std::string> StartFrom;
   };
 
+  /**
+   * @brief Optional parameters for
+   * #Azure::Storage::Blobs::BlobContainerClient::ListBlobsConcurrently.
+   */
+  struct ListBlobsConcurrentlyOptions final
+  {
+    /**
+     * @brief Specifies a string that filters the results to return only blobs whose
+     * name begins with the specified prefix.
+     */
+    Azure::Nullable<std::string> Prefix;
+
+    /**
+     * @brief Specifies the maximum number of blobs to return in each page.
+     */
+    Azure::Nullable<int32_t> PageSizeHint;
+
+    /**
+     * @brief Specifies one or more datasets to include in the response.
+     */
+    Models::ListBlobsIncludeFlags Include = Models::ListBlobsIncludeFlags::None;
+
+    /**
+     * @brief The blob names splitting the container into the ranges listed concurrently, such as
+     * names sampled from a previous listing. Each range starts at a boundary, and ends before the
+     * next one.
+     *
+     * @remark If empty, the boundaries are the virtual directories and the blobs found at the top
+     * of the hierarchy when Delimiter is set, or else the letters and digits following Prefix.
+     */
+    std::vector<std::string> PartitionBoundaries;
+
+    /**
+     * @brief The delimiter of the virtual directories used as boundaries when
+     * PartitionBoundaries is empty. The top of the hierarchy is listed before the ranges, so it
+     * should not hold too many entries.
+     */
+    std::string Delimiter;
+
+    /**
+     * @brief The maximum number of ranges listed at once.
+     */
+    int32_t Concurrency = 16;
+
+    /**
+     * @brief If true, the blobs are passed in the order of their names, and the pages of a range
+     * are held until the previous ranges are done. Otherwise, each page is passed as soon as it is
+     * received.
+     */
+    bool PreserveOrder = false;
+
+    /**
+     * @brief The executor listing the ranges. If null, an executor shared by the whole process,
+     * which bounds the number of threads used by all the transfers, is used.
+     */
+    std::shared_ptr<TransferExecutor> Executor;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::BlobContainerClient::GetAccessPolicy.
    */
@@ -717,6 +777,83 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief If true, the chunk size and the number of chunks downloaded at once are adjusted
+       * during the transfer to the measured throughput and latency. ChunkSize is the size of the
+       * first chunks, and Concurrency the maximum number of chunks downloaded at once.
+       * InitialChunkSize still applies to the first request.
+       */
+      bool EnableAutoTuning = false;
+
+      /**
+       * @brief If true, the destination file is created with its final size and mapped into
+       * memory, so the chunks are received straight into it instead of being written through
+       * intermediate buffers. Disk errors on the mapped file cannot be reported as exceptions, so
+       * this is only recommended for local disks.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * @brief The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * @brief The pool lending the buffers the chunks are gathered in before they are written to
+       * the file. If null, a pool shared by the whole process, which bounds the memory used by all
+       * the transfers, is used.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
+    } TransferOptions;
+  };
+
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlobClient::GetInputStream.
+   */
+  struct GetBlobInputStreamOptions final
+  {
+    /**
+     * @brief Optional conditions that must be met to perform this operation. The stream then reads
+     * the version of the blob it was opened on: the requests fail if the blob is modified.
+     */
+    BlobAccessConditions AccessConditions;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The size of the blocks the blob is downloaded and cached in.
+       */
+      int64_t BlockSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The number of blocks downloaded ahead of the read position, at once.
+       */
+      int32_t Concurrency = 5;
+
+      /**
+       * @brief The maximum number of downloaded blocks kept in memory. The least recently read
+       * ones are dropped first.
+       */
+      int32_t MaxCachedBlocks = 16;
+
+      /**
+       * @brief The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * @brief The pool lending the buffers the blocks are downloaded into. If null, a pool shared
+       * by the whole process, which bounds the memory used by all the transfers, is used. The
+       * buffers are returned once the blocks are downloaded: the cached blocks are copied out of
+       * the pool, and are not charged to its budget.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
     } TransferOptions;
   };
 
@@ -954,6 +1091,41 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief If true, the chunk size and the number of chunks uploaded at once are adjusted
+       * during the transfer to the measured throughput and latency. ChunkSize is the size of the
+       * first chunks, and Concurrency the maximum number of chunks uploaded at once.
+       */
+      bool EnableAutoTuning = false;
+
+      /**
+       * @brief If true, the source file is mapped into memory, so the chunks are sent straight from
+       * the mapped pages instead of being read into intermediate buffers. The file must not be
+       * truncated during the upload.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * @brief If set, the hash of each chunk is computed with this algorithm on the transfer
+       * workers and sent with the chunk, for the service to verify its integrity. When uploading
+       * from a file that is not mapped into memory, the chunks are read into buffers borrowed from
+       * BufferPool to be hashed, and a file larger than a chunk is always uploaded in blocks.
+       */
+      Azure::Nullable<HashAlgorithm> TransactionalHashAlgorithm;
+
+      /**
+       * @brief The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * @brief The pool lending the buffers the blocks are read into when uploading from a
+       * stream, or from a file with TransactionalHashAlgorithm. If null, a pool shared by the
+       * whole process, which bounds the memory used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
     } TransferOptions;
 
     /**
@@ -967,6 +1139,62 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Nullable<bool> HasLegalHold;
   };
 
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::GetOutputStream.
+   */
+  struct GetBlockBlobOutputStreamOptions final
+  {
+    /**
+     * @brief The standard HTTP header system properties to set.
+     */
+    Models::BlobHttpHeaders HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata.
+     */
+    Storage::Metadata Metadata;
+
+    /**
+     * @brief The tags to set for this blob.
+     */
+    std::map<std::string, std::string> Tags;
+
+    /**
+     * @brief Indicates the tier to be set on blob.
+     */
+    Azure::Nullable<Models::AccessTier> AccessTier;
+
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The size of the blocks the written data is staged in. This value cannot be larger
+       * than 4000 MiB.
+       */
+      int64_t BlockSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of blocks staged at once. Writing waits when twice as many
+       * blocks are waiting to be staged.
+       */
+      int32_t Concurrency = 5;
+
+      /**
+       * @brief The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * @brief The pool lending the buffers the blocks are gathered in. If null, a pool shared by
+       * the whole process, which bounds the memory used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
+    } TransferOptions;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::BlockBlobClient::UploadFromUri.
    */
@@ -1366,6 +1594,42 @@ namespace Azure { namespace Storage { namespace Blobs {
     AppendBlobAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for #Azure::Storage::Blobs::AppendBlobClient::GetOutputStream.
+   */
+  struct GetAppendBlobOutputStreamOptions final
+  {
+    /**
+     * @brief Options for parallel transfer.
+     */
+    struct
+    {
+      /**
+       * @brief The size of the blocks the written data is appended in. This value cannot be larger
+       * than 100 MiB.
+       */
+      int64_t BlockSize = 4 * 1024 * 1024;
+
+      /**
+       * @brief The maximum number of blocks waiting to be appended. The blocks are appended one at
+       * a time, in order, while more data is written.
+       */
+      int32_t Concurrency = 5;
+
+      /**
+       * @brief The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * @brief The pool lending the buffers the blocks are gathered in. If null, a pool shared by
+       * the whole process, which bounds the memory used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
+    } TransferOptions;
+  };
+
   /**
    * @brief Optional parameters for #Azure::Storage::Blobs::AppendBlobClient::AppendBlockFromUri.
    */
@@ -6,12 +6,16 @@
 #include "azure/storage/blobs/blob_options.hpp"
 
 #include <azure/core/azure_assert.hpp>
+#include <azure/core/io/body_stream.hpp>
 #include <azure/core/operation.hpp>
 #include <azure/core/paged_response.hpp>
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace Azure { namespace Storage {
@@ -25,8 +29,14 @@ namespace Azure { namespace Storage {
     class BlobServiceClient;
     class BlobContainerClient;
     class BlobClient;
+    class BlockBlobClient;
+    class AppendBlobClient;
     class PageBlobClient;
 
+    namespace _detail {
+      class ListBlobsResultReader;
+    } // namespace _detail
+
     namespace Models {
 
       /**
@@ -354,6 +364,211 @@ namespace Azure { namespace Storage {
       friend class Azure::Core::PagedResponse<ListBlobsPagedResponse>;
     };
 
+    /**
+     * @brief Reads the blobs listed by #Azure::Storage::Blobs::BlobContainerClient::ListBlobs one
+     * at a time, as the body of each page is received.
+     *
+     * @remark The parsing of a page overlaps with its transfer, and the page is never held in
+     * memory as a whole. A request is not retried once the body of its response is being read, in
+     * which case the listing can be resumed from #CurrentPageToken.
+     */
+    class ListBlobsReader final {
+    public:
+      /**
+       * @brief Moves the reader. The moved-from reader can only be destroyed.
+       *
+       */
+      ListBlobsReader(ListBlobsReader&& other) noexcept;
+
+      /**
+       * @brief Moves the reader. The moved-from reader can only be destroyed.
+       *
+       */
+      ListBlobsReader& operator=(ListBlobsReader&& other) noexcept;
+
+      ~ListBlobsReader();
+
+      /**
+       * @brief Reads the next blob, sending the request for the next page once all the blobs of
+       * the current one are read.
+       *
+       * @param blob Set to the blob read.
+       * @param context Context for cancelling long running operations.
+       * @return False once all the blobs are read.
+       */
+      bool ReadNext(
+          Models::BlobItem& blob,
+          const Azure::Core::Context& context = Azure::Core::Context());
+
+      /**
+       * The token of the page the last blob read belongs to. It lists the page again when used as
+       * #Azure::Storage::Blobs::ListBlobsOptions::ContinuationToken.
+       */
+      std::string CurrentPageToken;
+
+    private:
+      std::shared_ptr<BlobContainerClient> m_blobContainerClient;
+      ListBlobsOptions m_operationOptions;
+      std::unique_ptr<_detail::ListBlobsResultReader> m_resultReader;
+      bool m_hasNextPage = true;
+
+      ListBlobsReader();
+
+      friend class BlobContainerClient;
+    };
+
+    /**
+     * @brief Reads the content of a blob at any position, downloading it in blocks ahead of the
+     * read position. Returned by #Azure::Storage::Blobs::BlobClient::GetInputStream.
+     *
+     * @remark The blocks following the read position are downloaded in parallel by the tasks of
+     * the transfer executor, and the recently read blocks are kept, so that reading them again or
+     * seeking back to them does not download them again. Seeking away from the blocks being
+     * downloaded cancels their downloads. A failed download is only reported by the read needing
+     * it, and is retried by the next read.
+     */
+    class BlobInputStream final : public Azure::Core::IO::BodyStream {
+    public:
+      /**
+       * @brief Moves the stream. The moved-from stream can only be destroyed.
+       *
+       */
+      BlobInputStream(BlobInputStream&& other) = default;
+
+      BlobInputStream(const BlobInputStream&) = delete;
+      BlobInputStream& operator=(const BlobInputStream&) = delete;
+
+      /**
+       * @brief Cancels the downloads, and waits for the running ones.
+       *
+       */
+      ~BlobInputStream() override;
+
+      /**
+       * @brief Gets the size of the blob.
+       *
+       */
+      int64_t Length() const override;
+
+      /**
+       * @brief Moves the read position to the beginning of the blob.
+       *
+       */
+      void Rewind() override { Seek(0); }
+
+      /**
+       * @brief Moves the read position.
+       *
+       * @param offset The new read position, which cannot be larger than the size of the blob.
+       */
+      void Seek(int64_t offset);
+
+      /**
+       * @brief Gets the read position.
+       *
+       */
+      int64_t GetPosition() const;
+
+    private:
+      struct State;
+
+      explicit BlobInputStream(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context& context) override;
+
+      // Creates a stream over length bytes, downloading the blocks with downloadRangeFunc, which
+      // gets the offset of the range, the buffer and the length of the range.
+      static BlobInputStream Create(
+          std::function<void(int64_t, uint8_t*, size_t, const Azure::Core::Context&)>
+              downloadRangeFunc,
+          int64_t length,
+          int64_t blockSize,
+          int maxParallelDownloads,
+          int maxCachedBlocks,
+          std::shared_ptr<TransferExecutor> executor,
+          std::shared_ptr<TransferBufferPool> bufferPool,
+          const Azure::Core::Context& context);
+
+      std::shared_ptr<State> m_state;
+
+      friend class BlobClient;
+    };
+
+    /**
+     * @brief Writes the content of a blob incrementally, uploading it in blocks in the background.
+     * Returned by #Azure::Storage::Blobs::BlockBlobClient::GetOutputStream and
+     * #Azure::Storage::Blobs::AppendBlobClient::GetOutputStream.
+     *
+     * @remark The data written is gathered in blocks, which are uploaded by the tasks of the
+     * transfer executor while more data is written. #Write only waits when the maximum number of
+     * blocks are already waiting to be uploaded. Once an upload fails, the stream is broken: the
+     * following calls throw the error. A stream destroyed before being closed stops its uploads,
+     * without committing the blocks of a block blob.
+     */
+    class BlobOutputStream final {
+    public:
+      /**
+       * @brief Moves the stream. The moved-from stream can only be destroyed.
+       *
+       */
+      BlobOutputStream(BlobOutputStream&& other) noexcept = default;
+
+      BlobOutputStream(const BlobOutputStream&) = delete;
+      BlobOutputStream& operator=(const BlobOutputStream&) = delete;
+
+      /**
+       * @brief Stops the uploads of a stream which was not closed, and waits for the running ones.
+       *
+       */
+      ~BlobOutputStream();
+
+      /**
+       * @brief Writes data to the blob.
+       *
+       * @param buffer The data to write.
+       * @param count The number of bytes to write.
+       */
+      void Write(const uint8_t* buffer, size_t count);
+
+      /**
+       * @brief Uploads the data written so far and waits for it to be uploaded. The blocks of a
+       * block blob are committed, so the data can be read from the blob.
+       *
+       */
+      void Flush();
+
+      /**
+       * @brief Flushes the stream, which cannot be written anymore. Closing a closed stream does
+       * nothing.
+       *
+       */
+      void Close();
+
+    private:
+      struct State;
+
+      explicit BlobOutputStream(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+      // Creates a stream uploading the blocks with uploadBlockFunc, which gets the index of the
+      // block, at most maxParallelUploads at once, and committing them with commitFunc, which
+      // gets the number of blocks.
+      static BlobOutputStream Create(
+          std::function<void(int64_t, Azure::Core::IO::BodyStream&, const Azure::Core::Context&)>
+              uploadBlockFunc,
+          std::function<void(int64_t, const Azure::Core::Context&)> commitFunc,
+          int64_t blockSize,
+          int maxParallelUploads,
+          int maxBufferedBlocks,
+          std::shared_ptr<TransferExecutor> executor,
+          std::shared_ptr<TransferBufferPool> bufferPool,
+          const Azure::Core::Context& context);
+
+      std::shared_ptr<State> m_state;
+
+      friend class BlockBlobClient;
+      friend class AppendBlobClient;
+    };
+
     /**
      * @brief Response type for #Azure::Storage::Blobs::BlobContainerClient::ListBlobsByHierarchy.
      */
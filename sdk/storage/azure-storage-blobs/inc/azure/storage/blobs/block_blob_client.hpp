@@ -157,6 +157,48 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions(),
         const Azure::Core::Context& context = Azure::Core::Context()) const;
 
+    /**
+     * @brief Creates a new block blob, or updates the content of an existing block blob, from a
+     * stream which does not need to be seekable nor to know its length. Updating an existing
+     * block blob overwrites any existing metadata on the blob.
+     *
+     * @remark The stream is read one block at a time, into buffers borrowed from
+     * TransferOptions.BufferPool, while the blocks read before it are staged. At most
+     * TransferOptions.Concurrency blocks are held in memory. Content smaller than both
+     * TransferOptions.SingleUploadThreshold and the block size is uploaded with a single request.
+     * Without TransferOptions.ChunkSize, the block size is 4 MiB when the length of the stream is
+     * unknown, which allows for up to about 195 GiB of content.
+     *
+     * @param content A stream containing the content to upload. It is read until its end.
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations.
+     * @return A UploadBlockBlobFromResult describing the state of the updated block blob.
+     */
+    Azure::Response<Models::UploadBlockBlobFromResult> UploadFrom(
+        Azure::Core::IO::BodyStream& content,
+        const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
+    /**
+     * @brief Gets a stream which creates a new block blob, or updates the content of an existing
+     * block blob, with the data written to it. The blob is updated when the stream is flushed or
+     * closed.
+     *
+     * @remark The written data is gathered in blocks of TransferOptions.BlockSize bytes, which are
+     * staged in the background, at most TransferOptions.Concurrency at once, while more data is
+     * written. The blocks staged so far are committed by each flush, which replaces any existing
+     * metadata on the blob. Closing a stream which was not written creates an empty blob. A stream
+     * destroyed before being closed does not commit its blocks.
+     *
+     * @param options Optional parameters to execute this function.
+     * @param context Context for cancelling long running operations. It is used for all the
+     * requests sent by the stream.
+     * @return A BlobOutputStream writing to the block blob.
+     */
+    BlobOutputStream GetOutputStream(
+        const GetBlockBlobOutputStreamOptions& options = GetBlockBlobOutputStreamOptions(),
+        const Azure::Core::Context& context = Azure::Core::Context()) const;
+
     /**
      * @brief Creates a new Block Blob where the contents of the blob are read from a given URL.
      *
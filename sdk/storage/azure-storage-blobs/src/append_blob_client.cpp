@@ -173,6 +173,35 @@ namespace Azure { namespace Storage { namespace Blobs {
         *m_pipeline, m_blobUrl, content, protocolLayerOptions, context);
   }
 
+  BlobOutputStream AppendBlobClient::GetOutputStream(
+      const GetAppendBlobOutputStreamOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t MaxAppendBlockSize = 100 * 1024 * 1024;
+    if (options.TransferOptions.BlockSize > MaxAppendBlockSize)
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+
+    auto appendBlockFunc = [appendBlobClient = *this](
+                               int64_t,
+                               Azure::Core::IO::BodyStream& content,
+                               const Azure::Core::Context& context) {
+      appendBlobClient.AppendBlock(content, AppendBlockOptions(), context);
+    };
+
+    // The blocks are appended one at a time, so that they are appended in order.
+    return BlobOutputStream::Create(
+        std::move(appendBlockFunc),
+        nullptr,
+        options.TransferOptions.BlockSize,
+        1,
+        options.TransferOptions.Concurrency,
+        options.TransferOptions.Executor,
+        options.TransferOptions.BufferPool,
+        context);
+  }
+
   Azure::Response<Models::AppendBlockFromUriResult> AppendBlobClient::AppendBlockFromUri(
       const std::string& sourceUri,
       const AppendBlockFromUriOptions& options,
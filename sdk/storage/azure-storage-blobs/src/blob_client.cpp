@@ -410,12 +410,28 @@ namespace Azure { namespace Storage { namespace Blobs {
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = blobRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+    if (options.TransferOptions.EnableAutoTuning)
+    {
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          (std::min)(options.TransferOptions.ChunkSize, _internal::MinAdaptiveChunkSize),
+          (std::max)(options.TransferOptions.ChunkSize, _internal::MaxAdaptiveChunkSize),
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          options.TransferOptions.Executor);
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          options.TransferOptions.Executor);
+    }
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
     return ret;
@@ -462,29 +478,90 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     firstChunkLength = (std::min)(firstChunkLength, blobRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::IO::BodyStream& stream,
-                               _internal::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
+    const auto bufferPool = options.TransferOptions.BufferPool
+        ? options.TransferOptions.BufferPool
+        : TransferBufferPool::GetDefault();
+    auto bodyStreamToFile = [&bufferPool](
+                                Azure::Core::IO::BodyStream& stream,
+                                _internal::FileWriter& fileWriter,
+                                int64_t offset,
+                                int64_t length,
+                                const Azure::Core::Context& context) {
       constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
+      // Data borrowed from the stream is written to the file directly when there is at least this
+      // much of it, instead of being copied to the buffer first. Socket-backed streams hand out
+      // their receive buffer, 4 KB by default, so after the first smaller view the rest is read
+      // straight into the buffer, without views.
+      constexpr size_t minDirectWriteSize = 64 * 1024;
+      bool readViews = true;
+      TransferBufferPool::Buffer buffer;
       while (length > 0)
       {
         size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
+        Azure::Core::IO::BodyStreamView view;
+        if (readViews)
+        {
+          view = stream.ReadView(readSize, context);
+          if (view.Size == 0)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+          if (view.Size == readSize || view.Size >= minDirectWriteSize)
+          {
+            fileWriter.Write(view.Data, view.Size, offset);
+            length -= view.Size;
+            offset += view.Size;
+            continue;
+          }
+          readViews = false;
+        }
+
+        // The file is written in large blocks from the buffer, which is filled straight from the
+        // stream.
+        if (!buffer.GetData())
+        {
+          buffer = bufferPool->Acquire(bufferSize, context);
+        }
+        std::copy(view.Data, view.Data + view.Size, buffer.GetData());
+        size_t bytesRead = view.Size
+            + stream.ReadToCount(buffer.GetData() + view.Size, readSize - view.Size, context);
         if (bytesRead != readSize)
         {
           throw Azure::Core::RequestFailedException("Error when reading body stream.");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        fileWriter.Write(buffer.GetData(), bytesRead, offset);
         length -= bytesRead;
         offset += bytesRead;
       }
     };
 
-    _internal::FileWriter fileWriter(fileName);
-    bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
+    std::unique_ptr<_internal::FileWriter> fileWriter;
+    std::unique_ptr<_internal::MappedFileWriter> mappedFileWriter;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      mappedFileWriter = std::make_unique<_internal::MappedFileWriter>(fileName, blobRangeSize);
+    }
+    else
+    {
+      fileWriter = std::make_unique<_internal::FileWriter>(fileName);
+    }
+    auto writeChunk = [&](Azure::Core::IO::BodyStream& stream, int64_t offset, int64_t length) {
+      if (mappedFileWriter)
+      {
+        // Read straight into the pages of the file.
+        const size_t readSize = static_cast<size_t>(length);
+        if (stream.ReadToCount(mappedFileWriter->GetData() + offset, readSize, context)
+            != readSize)
+        {
+          throw Azure::Core::RequestFailedException("Error when reading body stream.");
+        }
+      }
+      else
+      {
+        bodyStreamToFile(stream, *fileWriter, offset, length, context);
+      }
+    };
+    writeChunk(*(firstChunk.Value.BodyStream), 0, firstChunkLength);
     firstChunk.Value.BodyStream.reset();
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadBlobResult>& response) {
@@ -508,12 +585,10 @@ namespace Azure { namespace Storage { namespace Blobs {
             chunkOptions.Range.Value().Length = length;
             chunkOptions.AccessConditions.IfMatch = eTag;
             auto chunk = Download(chunkOptions, context);
-            bodyStreamToFile(
+            writeChunk(
                 *(chunk.Value.BodyStream),
-                fileWriter,
                 offset - firstChunkOffset,
-                chunkOptions.Range.Value().Length.Value(),
-                context);
+                chunkOptions.Range.Value().Length.Value());
 
             if (chunkId == numChunks - 1)
             {
@@ -525,17 +600,72 @@ namespace Azure { namespace Storage { namespace Blobs {
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = blobRangeSize - firstChunkLength;
 
-    _internal::ConcurrentTransfer(
-        remainingOffset,
-        remainingSize,
-        options.TransferOptions.ChunkSize,
-        options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+    if (options.TransferOptions.EnableAutoTuning)
+    {
+      _internal::AdaptiveConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          (std::min)(options.TransferOptions.ChunkSize, _internal::MinAdaptiveChunkSize),
+          (std::max)(options.TransferOptions.ChunkSize, _internal::MaxAdaptiveChunkSize),
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          options.TransferOptions.Executor);
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          remainingOffset,
+          remainingSize,
+          options.TransferOptions.ChunkSize,
+          options.TransferOptions.Concurrency,
+          downloadChunkFunc,
+          options.TransferOptions.Executor);
+    }
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
     return ret;
   }
 
+  BlobInputStream BlobClient::GetInputStream(
+      const GetBlobInputStreamOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    GetBlobPropertiesOptions getPropertiesOptions;
+    getPropertiesOptions.AccessConditions = options.AccessConditions;
+    auto properties = GetProperties(getPropertiesOptions, context);
+
+    // The blocks are all read from the version of the blob the stream is opened on.
+    DownloadBlobOptions blockOptions;
+    blockOptions.AccessConditions.IfMatch = properties.Value.ETag;
+    blockOptions.AccessConditions.LeaseId = options.AccessConditions.LeaseId;
+    auto downloadRangeFunc = [blobClient = *this, blockOptions](
+                                 int64_t offset,
+                                 uint8_t* buffer,
+                                 size_t length,
+                                 const Azure::Core::Context& context) {
+      DownloadBlobOptions rangeOptions = blockOptions;
+      rangeOptions.Range = Core::Http::HttpRange();
+      rangeOptions.Range.Value().Offset = offset;
+      rangeOptions.Range.Value().Length = static_cast<int64_t>(length);
+      auto response = blobClient.Download(rangeOptions, context);
+      if (response.Value.BodyStream->ReadToCount(buffer, length, context) != length)
+      {
+        throw Azure::Core::RequestFailedException("Error when reading body stream.");
+      }
+    };
+
+    return BlobInputStream::Create(
+        std::move(downloadRangeFunc),
+        properties.Value.BlobSize,
+        options.TransferOptions.BlockSize,
+        options.TransferOptions.Concurrency,
+        options.TransferOptions.MaxCachedBlocks,
+        options.TransferOptions.Executor,
+        options.TransferOptions.BufferPool,
+        context);
+  }
+
   Azure::Response<Models::BlobProperties> BlobClient::GetProperties(
       const GetBlobPropertiesOptions& options,
       const Azure::Core::Context& context) const
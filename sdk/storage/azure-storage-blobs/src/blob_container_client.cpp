@@ -7,10 +7,12 @@
 #include "azure/storage/blobs/blob_batch.hpp"
 #include "azure/storage/blobs/block_blob_client.hpp"
 #include "azure/storage/blobs/page_blob_client.hpp"
+#include "private/list_blobs_reader.hpp"
 #include "private/package_version.hpp"
 
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
 #include <azure/storage/common/internal/constants.hpp>
 #include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/internal/storage_bearer_token_auth.hpp>
@@ -20,6 +22,10 @@
 #include <azure/storage/common/storage_common.hpp>
 #include <azure/storage/common/storage_exception.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
   namespace {
@@ -101,6 +107,108 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
       return blobItem;
     }
+
+    // The boundaries of the ranges listed by ListBlobsConcurrently, after the prefix, when neither
+    // boundaries nor a delimiter are given.
+    constexpr const char* DefaultPartitionCharacters
+        = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    /**
+     * @brief Passes the blobs listed by the ranges of ListBlobsConcurrently to the callback, one
+     * page at a time, and in the order of the ranges if needed. Once stopped, it drops the pages
+     * instead.
+     *
+     */
+    class ListedBlobsMerger final {
+    public:
+      ListedBlobsMerger(
+          size_t numRanges,
+          bool preserveOrder,
+          const std::function<void(std::vector<Models::BlobItem>&)>& blobsReceived)
+          : m_blobsReceived(blobsReceived), m_preserveOrder(preserveOrder),
+            m_pendingPages(numRanges), m_rangeDone(numRanges, false)
+      {
+      }
+
+      // Stops when listing a range fails. The ranges being listed check IsStopped before each
+      // page.
+      void Stop() { m_stopped = true; }
+
+      bool IsStopped() const { return m_stopped; }
+
+      void OnPage(size_t rangeIndex, std::vector<Models::BlobItem> blobs)
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (m_stopped)
+        {
+          return;
+        }
+        if (!m_preserveOrder)
+        {
+          PassBlobs(blobs);
+          return;
+        }
+        m_pendingPages[rangeIndex].push_back(std::move(blobs));
+        PassPendingPages();
+      }
+
+      void OnRangeDone(size_t rangeIndex)
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_rangeDone[rangeIndex] = true;
+        if (m_preserveOrder && !m_stopped)
+        {
+          PassPendingPages();
+        }
+      }
+
+    private:
+      // Invokes the callback, and stops if it throws, while the lock is still held so that it is
+      // not invoked again.
+      void PassBlobs(std::vector<Models::BlobItem>& blobs)
+      {
+        if (blobs.empty())
+        {
+          return;
+        }
+        try
+        {
+          m_blobsReceived(blobs);
+        }
+        catch (...)
+        {
+          m_stopped = true;
+          throw;
+        }
+      }
+
+      // Passes the pages of the ranges whose previous ranges are done.
+      void PassPendingPages()
+      {
+        while (m_nextRange < m_rangeDone.size())
+        {
+          auto& pages = m_pendingPages[m_nextRange];
+          for (auto& blobs : pages)
+          {
+            PassBlobs(blobs);
+          }
+          pages.clear();
+          if (!m_rangeDone[m_nextRange])
+          {
+            break;
+          }
+          ++m_nextRange;
+        }
+      }
+
+      std::mutex m_mutex;
+      const std::function<void(std::vector<Models::BlobItem>&)>& m_blobsReceived;
+      bool m_preserveOrder;
+      std::vector<std::vector<std::vector<Models::BlobItem>>> m_pendingPages;
+      std::vector<bool> m_rangeDone;
+      size_t m_nextRange = 0;
+      std::atomic<bool> m_stopped{false};
+    };
   } // namespace
 
   BlobContainerClient BlobContainerClient::CreateFromConnectionString(
@@ -350,29 +458,193 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
     protocolLayerOptions.StartFrom = options.StartFrom;
-    auto response = _detail::BlobContainerClient::ListBlobs(
+    auto rawResponse = _detail::SendListBlobs(
         *m_pipeline,
         m_blobContainerUrl,
         protocolLayerOptions,
+        true,
         _internal::WithReplicaStatus(context));
 
     ListBlobsPagedResponse pagedResponse;
-    pagedResponse.ServiceEndpoint = std::move(response.Value.ServiceEndpoint);
-    pagedResponse.BlobContainerName = std::move(response.Value.BlobContainerName);
-    pagedResponse.Prefix = std::move(response.Value.Prefix);
-    for (auto& i : response.Value.Items)
+    _detail::ListBlobsResultReader resultReader(
+        std::make_unique<Azure::Core::IO::MemoryBodyStream>(rawResponse->GetBody()));
+    Models::_detail::BlobItem item;
+    while (resultReader.ReadNext(item, context))
     {
-      pagedResponse.Blobs.push_back(BlobItemConversion(i));
+      pagedResponse.Blobs.push_back(BlobItemConversion(item));
     }
+    auto& result = resultReader.Result;
+    pagedResponse.ServiceEndpoint = std::move(result.ServiceEndpoint);
+    pagedResponse.BlobContainerName = std::move(result.BlobContainerName);
+    pagedResponse.Prefix = std::move(result.Prefix);
     pagedResponse.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
     pagedResponse.m_operationOptions = options;
     pagedResponse.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
-    pagedResponse.NextPageToken = response.Value.ContinuationToken;
-    pagedResponse.RawResponse = std::move(response.RawResponse);
+    pagedResponse.NextPageToken = std::move(result.ContinuationToken);
+    pagedResponse.RawResponse = std::move(rawResponse);
 
     return pagedResponse;
   }
 
+  void BlobContainerClient::ListBlobsConcurrently(
+      const std::function<void(std::vector<Models::BlobItem>&)>& blobsReceived,
+      const ListBlobsConcurrentlyOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    const std::string prefix = options.Prefix.ValueOr(std::string());
+
+    // Range i starts at boundaries[i - 1] and ends before boundaries[i]. The first and last ranges
+    // are open.
+    std::vector<std::string> boundaries = options.PartitionBoundaries;
+    if (boundaries.empty() && !options.Delimiter.empty())
+    {
+      ListBlobsOptions hierarchyOptions;
+      hierarchyOptions.Prefix = options.Prefix;
+      for (auto pageResult = ListBlobsByHierarchy(options.Delimiter, hierarchyOptions, context);
+           pageResult.HasPage();
+           pageResult.MoveToNextPage(context))
+      {
+        for (auto& blobPrefix : pageResult.BlobPrefixes)
+        {
+          boundaries.push_back(std::move(blobPrefix));
+        }
+        for (auto& blob : pageResult.Blobs)
+        {
+          boundaries.push_back(std::move(blob.Name));
+        }
+      }
+    }
+    else if (boundaries.empty())
+    {
+      for (const char* c = DefaultPartitionCharacters; *c != '\0'; ++c)
+      {
+        boundaries.push_back(prefix + *c);
+      }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+    // The blobs before the prefix are not listed.
+    boundaries.erase(
+        boundaries.begin(),
+        std::upper_bound(boundaries.begin(), boundaries.end(), prefix));
+
+    const size_t numRanges = boundaries.size() + 1;
+    ListedBlobsMerger merger(numRanges, options.PreserveOrder, blobsReceived);
+    auto listRange = [&](int64_t offset, int64_t, int64_t, int64_t) {
+      const size_t rangeIndex = static_cast<size_t>(offset);
+      ListBlobsOptions rangeOptions;
+      rangeOptions.Prefix = options.Prefix;
+      rangeOptions.PageSizeHint = options.PageSizeHint;
+      rangeOptions.Include = options.Include;
+      if (rangeIndex != 0)
+      {
+        rangeOptions.StartFrom = boundaries[rangeIndex - 1];
+      }
+      const std::string* rangeEnd
+          = rangeIndex < boundaries.size() ? &boundaries[rangeIndex] : nullptr;
+
+      try
+      {
+        for (auto pageResult = ListBlobs(rangeOptions, context);
+             pageResult.HasPage() && !merger.IsStopped();
+             pageResult.MoveToNextPage(context))
+        {
+          auto blobsEnd = pageResult.Blobs.end();
+          if (rangeEnd != nullptr)
+          {
+            blobsEnd = std::lower_bound(
+                pageResult.Blobs.begin(),
+                pageResult.Blobs.end(),
+                *rangeEnd,
+                [](const Models::BlobItem& blob, const std::string& name) {
+                  return blob.Name < name;
+                });
+          }
+          const bool isRangeDone = blobsEnd != pageResult.Blobs.end();
+          pageResult.Blobs.erase(blobsEnd, pageResult.Blobs.end());
+          merger.OnPage(rangeIndex, std::move(pageResult.Blobs));
+          if (isRangeDone)
+          {
+            break;
+          }
+        }
+      }
+      catch (...)
+      {
+        // The ranges being listed stop at their next page, and the callback is not invoked
+        // anymore.
+        merger.Stop();
+        throw;
+      }
+      merger.OnRangeDone(rangeIndex);
+    };
+
+    _internal::ConcurrentTransfer(
+        0,
+        static_cast<int64_t>(numRanges),
+        1,
+        (std::max)(options.Concurrency, 1),
+        listRange,
+        options.Executor);
+  }
+
+  ListBlobsReader BlobContainerClient::GetListBlobsReader(const ListBlobsOptions& options) const
+  {
+    ListBlobsReader reader;
+    reader.m_blobContainerClient = std::make_shared<BlobContainerClient>(*this);
+    reader.m_operationOptions = options;
+    reader.CurrentPageToken = options.ContinuationToken.ValueOr(std::string());
+    return reader;
+  }
+
+  ListBlobsReader::ListBlobsReader() = default;
+
+  ListBlobsReader::ListBlobsReader(ListBlobsReader&& other) noexcept = default;
+
+  ListBlobsReader& ListBlobsReader::operator=(ListBlobsReader&& other) noexcept = default;
+
+  ListBlobsReader::~ListBlobsReader() = default;
+
+  bool ListBlobsReader::ReadNext(Models::BlobItem& blob, const Azure::Core::Context& context)
+  {
+    Models::_detail::BlobItem item;
+    while (true)
+    {
+      if (!m_resultReader)
+      {
+        if (!m_hasNextPage)
+        {
+          return false;
+        }
+        _detail::BlobContainerClient::ListBlobContainerBlobsOptions protocolLayerOptions;
+        protocolLayerOptions.Prefix = m_operationOptions.Prefix;
+        protocolLayerOptions.Marker = m_operationOptions.ContinuationToken;
+        protocolLayerOptions.MaxResults = m_operationOptions.PageSizeHint;
+        protocolLayerOptions.Include = m_operationOptions.Include;
+        protocolLayerOptions.StartFrom = m_operationOptions.StartFrom;
+        auto rawResponse = _detail::SendListBlobs(
+            *m_blobContainerClient->m_pipeline,
+            m_blobContainerClient->m_blobContainerUrl,
+            protocolLayerOptions,
+            false,
+            _internal::WithReplicaStatus(context));
+        m_resultReader
+            = std::make_unique<_detail::ListBlobsResultReader>(rawResponse->ExtractBodyStream());
+        CurrentPageToken = m_operationOptions.ContinuationToken.ValueOr(std::string());
+      }
+
+      if (m_resultReader->ReadNext(item, context))
+      {
+        blob = BlobItemConversion(item);
+        return true;
+      }
+      const auto& continuationToken = m_resultReader->Result.ContinuationToken;
+      m_hasNextPage = continuationToken.HasValue() && !continuationToken.Value().empty();
+      m_operationOptions.ContinuationToken = continuationToken;
+      m_resultReader.reset();
+    }
+  }
+
   ListBlobsByHierarchyPagedResponse BlobContainerClient::ListBlobsByHierarchy(
       const std::string& delimiter,
       const ListBlobsOptions& options,
@@ -385,7 +657,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
     protocolLayerOptions.StartFrom = options.StartFrom;
-    auto response = _detail::BlobContainerClient::ListBlobsByHierarchy(
+    auto response = _detail::ListBlobsByHierarchy(
         *m_pipeline,
         m_blobContainerUrl,
         protocolLayerOptions,
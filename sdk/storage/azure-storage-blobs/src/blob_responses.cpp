@@ -8,6 +8,20 @@
 #include "azure/storage/blobs/blob_service_client.hpp"
 #include "azure/storage/blobs/page_blob_client.hpp"
 
+#include <azure/core/io/body_stream.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
   std::unique_ptr<Azure::Core::Http::RawResponse> StartBlobCopyOperation::PollInternal(
@@ -123,4 +137,502 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
   }
 
+  struct BlobOutputStream::State final
+  {
+    std::function<void(int64_t, Azure::Core::IO::BodyStream&, const Azure::Core::Context&)>
+        UploadBlockFunc;
+    std::function<void(int64_t, const Azure::Core::Context&)> CommitFunc;
+    size_t BlockSize = 0;
+    int MaxParallelUploads = 1;
+    int MaxBufferedBlocks = 1;
+    std::shared_ptr<TransferExecutor> Executor;
+    std::shared_ptr<TransferBufferPool> BufferPool;
+    // Child of the context of the operation, cancelled when the stream is abandoned.
+    Azure::Core::Context Context;
+
+    // Only used by the writing thread.
+    TransferBufferPool::Buffer CurrentBlock;
+    size_t CurrentBlockLength = 0;
+    int64_t NumBlocks = 0;
+    int64_t NumCommittedBlocks = -1;
+    bool Closed = false;
+
+    struct PendingBlock final
+    {
+      int64_t Index;
+      TransferBufferPool::Buffer Data;
+      size_t Length;
+    };
+
+    std::mutex Mutex;
+    std::condition_variable StateChanged;
+    std::deque<PendingBlock> PendingBlocks;
+    int NumUploading = 0;
+    std::exception_ptr Error;
+    bool Abandoned = false;
+
+    // Uploads the pending blocks, as long as fewer than MaxParallelUploads are being uploaded.
+    // Returns false if no block could be uploaded.
+    bool UploadPendingBlocks(std::unique_lock<std::mutex>& lock)
+    {
+      bool uploaded = false;
+      while (!PendingBlocks.empty() && NumUploading < MaxParallelUploads && !Error && !Abandoned)
+      {
+        PendingBlock block = std::move(PendingBlocks.front());
+        PendingBlocks.pop_front();
+        ++NumUploading;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+          Azure::Core::IO::MemoryBodyStream contentStream(block.Data.GetData(), block.Length);
+          UploadBlockFunc(block.Index, contentStream, Context);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+        block.Data = TransferBufferPool::Buffer();
+        lock.lock();
+        --NumUploading;
+        if (error && !Error)
+        {
+          Error = error;
+        }
+        StateChanged.notify_all();
+        uploaded = true;
+      }
+      return uploaded;
+    }
+
+    // Waits until ready returns true, uploading the pending blocks on this thread when no other
+    // thread does, since the executor may not run the tasks before ready is true.
+    template <class Predicate> void Wait(std::unique_lock<std::mutex>& lock, Predicate ready)
+    {
+      while (!Error && !ready())
+      {
+        if (!UploadPendingBlocks(lock))
+        {
+          StateChanged.wait(lock);
+        }
+      }
+      if (Error)
+      {
+        std::rethrow_exception(Error);
+      }
+    }
+
+    void ThrowIfUnusable()
+    {
+      if (Closed)
+      {
+        throw std::runtime_error("The stream is closed.");
+      }
+      std::lock_guard<std::mutex> lock(Mutex);
+      if (Error)
+      {
+        std::rethrow_exception(Error);
+      }
+    }
+
+    void EnqueueCurrentBlock(const std::shared_ptr<State>& self)
+    {
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        Wait(lock, [this]() {
+          return PendingBlocks.size() < static_cast<size_t>(MaxBufferedBlocks);
+        });
+        PendingBlocks.push_back(
+            PendingBlock{NumBlocks, std::move(CurrentBlock), CurrentBlockLength});
+      }
+      ++NumBlocks;
+      CurrentBlockLength = 0;
+      Executor->Submit([self]() {
+        std::unique_lock<std::mutex> lock(self->Mutex);
+        self->UploadPendingBlocks(lock);
+      });
+    }
+  };
+
+  BlobOutputStream BlobOutputStream::Create(
+      std::function<void(int64_t, Azure::Core::IO::BodyStream&, const Azure::Core::Context&)>
+          uploadBlockFunc,
+      std::function<void(int64_t, const Azure::Core::Context&)> commitFunc,
+      int64_t blockSize,
+      int maxParallelUploads,
+      int maxBufferedBlocks,
+      std::shared_ptr<TransferExecutor> executor,
+      std::shared_ptr<TransferBufferPool> bufferPool,
+      const Azure::Core::Context& context)
+  {
+    if (blockSize <= 0 || static_cast<uint64_t>(blockSize) > (std::numeric_limits<size_t>::max)())
+    {
+      throw std::invalid_argument("Invalid block size.");
+    }
+    auto state = std::make_shared<State>();
+    state->UploadBlockFunc = std::move(uploadBlockFunc);
+    state->CommitFunc = std::move(commitFunc);
+    state->BlockSize = static_cast<size_t>(blockSize);
+    state->MaxParallelUploads = (std::max)(maxParallelUploads, 1);
+    state->MaxBufferedBlocks = (std::max)(maxBufferedBlocks, 1);
+    state->Executor
+        = executor ? std::move(executor) : WorkStealingTransferExecutor::GetDefault();
+    state->BufferPool = bufferPool ? std::move(bufferPool) : TransferBufferPool::GetDefault();
+    state->Context = context.WithDeadline((Azure::DateTime::max)());
+    return BlobOutputStream(std::move(state));
+  }
+
+  BlobOutputStream::~BlobOutputStream()
+  {
+    if (!m_state || m_state->Closed)
+    {
+      return;
+    }
+    std::deque<State::PendingBlock> pendingBlocks;
+    std::unique_lock<std::mutex> lock(m_state->Mutex);
+    m_state->Abandoned = true;
+    m_state->Context.Cancel();
+    pendingBlocks.swap(m_state->PendingBlocks);
+    m_state->StateChanged.wait(lock, [this]() { return m_state->NumUploading == 0; });
+  }
+
+  void BlobOutputStream::Write(const uint8_t* buffer, size_t count)
+  {
+    auto& state = *m_state;
+    state.ThrowIfUnusable();
+    while (count != 0)
+    {
+      if (!state.CurrentBlock.GetData())
+      {
+        state.CurrentBlock = state.BufferPool->Acquire(state.BlockSize, state.Context);
+      }
+      const size_t bytesToCopy = (std::min)(count, state.BlockSize - state.CurrentBlockLength);
+      std::memcpy(state.CurrentBlock.GetData() + state.CurrentBlockLength, buffer, bytesToCopy);
+      state.CurrentBlockLength += bytesToCopy;
+      buffer += bytesToCopy;
+      count -= bytesToCopy;
+      if (state.CurrentBlockLength == state.BlockSize)
+      {
+        state.EnqueueCurrentBlock(m_state);
+      }
+    }
+  }
+
+  void BlobOutputStream::Flush()
+  {
+    auto& state = *m_state;
+    state.ThrowIfUnusable();
+    if (state.CurrentBlockLength != 0)
+    {
+      state.EnqueueCurrentBlock(m_state);
+    }
+    {
+      std::unique_lock<std::mutex> lock(state.Mutex);
+      state.Wait(lock, [&state]() {
+        return state.PendingBlocks.empty() && state.NumUploading == 0;
+      });
+    }
+    if (state.CommitFunc && state.NumCommittedBlocks != state.NumBlocks)
+    {
+      try
+      {
+        state.CommitFunc(state.NumBlocks, state.Context);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        state.Error = std::current_exception();
+        throw;
+      }
+      state.NumCommittedBlocks = state.NumBlocks;
+    }
+  }
+
+  void BlobOutputStream::Close()
+  {
+    if (m_state->Closed)
+    {
+      return;
+    }
+    Flush();
+    m_state->Closed = true;
+    m_state->CurrentBlock = TransferBufferPool::Buffer();
+  }
+
+  struct BlobInputStream::State final
+  {
+    std::function<void(int64_t, uint8_t*, size_t, const Azure::Core::Context&)>
+        DownloadRangeFunc;
+    int64_t Length = 0;
+    size_t BlockSize = 0;
+    int MaxParallelDownloads = 1;
+    size_t MaxCachedBlocks = 1;
+    std::shared_ptr<TransferExecutor> Executor;
+    std::shared_ptr<TransferBufferPool> BufferPool;
+    // Child of the context of the operation, cancelled when the stream is destroyed.
+    Azure::Core::Context Context;
+
+    // Only used by the reading thread.
+    int64_t Position = 0;
+
+    enum class BlockStatus
+    {
+      Queued,
+      Downloading,
+      Downloaded,
+      Failed,
+    };
+
+    struct Block final
+    {
+      BlockStatus Status = BlockStatus::Queued;
+      // Set when the download is cancelled, for the block to be dropped once it completes.
+      bool Discarded = false;
+      Azure::Core::Context Context;
+      // Not borrowed from the pool, which would stay charged for the cached blocks for as long
+      // as the stream is open.
+      std::vector<uint8_t> Data;
+      std::exception_ptr Error;
+      // Position in RecentBlocks, once downloaded.
+      std::list<int64_t>::iterator RecentPosition;
+    };
+
+    std::mutex Mutex;
+    std::condition_variable StateChanged;
+    // The blocks queued, being downloaded, or downloaded, by index.
+    std::map<int64_t, Block> Blocks;
+    // The indexes of the downloaded blocks, most recently read first.
+    std::list<int64_t> RecentBlocks;
+    int NumDownloading = 0;
+
+    int64_t GetNumBlocks() const
+    {
+      return (Length + static_cast<int64_t>(BlockSize) - 1) / static_cast<int64_t>(BlockSize);
+    }
+
+    // Downloads a queued block, on the calling thread.
+    void DownloadBlock(std::unique_lock<std::mutex>& lock, int64_t index)
+    {
+      auto& block = Blocks.at(index);
+      block.Status = BlockStatus::Downloading;
+      const Azure::Core::Context blockContext = block.Context;
+      ++NumDownloading;
+      lock.unlock();
+      const int64_t offset = index * static_cast<int64_t>(BlockSize);
+      const size_t length = static_cast<size_t>(
+          (std::min)(static_cast<int64_t>(BlockSize), Length - offset));
+      std::vector<uint8_t> data;
+      std::exception_ptr error;
+      try
+      {
+        // The pool only lends the buffer while the block is being downloaded.
+        auto buffer = BufferPool->Acquire(length, blockContext);
+        DownloadRangeFunc(offset, buffer.GetData(), length, blockContext);
+        data.assign(buffer.GetData(), buffer.GetData() + length);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+        data.clear();
+      }
+      lock.lock();
+      --NumDownloading;
+      // The block stays in Blocks while it is being downloaded.
+      auto ite = Blocks.find(index);
+      if (ite->second.Discarded)
+      {
+        Blocks.erase(ite);
+      }
+      else if (error)
+      {
+        ite->second.Status = BlockStatus::Failed;
+        ite->second.Error = error;
+      }
+      else
+      {
+        ite->second.Status = BlockStatus::Downloaded;
+        ite->second.Data = std::move(data);
+        RecentBlocks.push_front(index);
+        ite->second.RecentPosition = RecentBlocks.begin();
+        EvictBlocks();
+      }
+      StateChanged.notify_all();
+    }
+
+    void EvictBlocks()
+    {
+      while (RecentBlocks.size() > MaxCachedBlocks)
+      {
+        Blocks.erase(RecentBlocks.back());
+        RecentBlocks.pop_back();
+      }
+    }
+
+    // Queues the blocks from the one at the read position, up to MaxParallelDownloads of them.
+    void QueueBlocks(const std::shared_ptr<State>& self, int64_t firstIndex)
+    {
+      const int64_t lastIndex
+          = (std::min)(firstIndex + MaxParallelDownloads, GetNumBlocks()) - 1;
+      for (int64_t index = firstIndex; index <= lastIndex; ++index)
+      {
+        if (Blocks.count(index) != 0)
+        {
+          continue;
+        }
+        Blocks[index].Context = Context.WithDeadline((Azure::DateTime::max)());
+        Executor->Submit([self, index]() {
+          std::unique_lock<std::mutex> lock(self->Mutex);
+          auto ite = self->Blocks.find(index);
+          if (ite != self->Blocks.end() && ite->second.Status == BlockStatus::Queued)
+          {
+            self->DownloadBlock(lock, index);
+          }
+        });
+      }
+    }
+
+    // Cancels the downloads of the blocks out of [firstIndex, lastIndex].
+    void CancelDownloads(int64_t firstIndex, int64_t lastIndex)
+    {
+      for (auto ite = Blocks.begin(); ite != Blocks.end();)
+      {
+        auto& block = ite->second;
+        if ((ite->first < firstIndex || ite->first > lastIndex)
+            && block.Status != BlockStatus::Downloaded)
+        {
+          if (block.Status == BlockStatus::Downloading)
+          {
+            block.Discarded = true;
+            block.Context.Cancel();
+            ++ite;
+            continue;
+          }
+          ite = Blocks.erase(ite);
+          continue;
+        }
+        ++ite;
+      }
+    }
+  };
+
+  BlobInputStream BlobInputStream::Create(
+      std::function<void(int64_t, uint8_t*, size_t, const Azure::Core::Context&)>
+          downloadRangeFunc,
+      int64_t length,
+      int64_t blockSize,
+      int maxParallelDownloads,
+      int maxCachedBlocks,
+      std::shared_ptr<TransferExecutor> executor,
+      std::shared_ptr<TransferBufferPool> bufferPool,
+      const Azure::Core::Context& context)
+  {
+    if (blockSize <= 0 || static_cast<uint64_t>(blockSize) > (std::numeric_limits<size_t>::max)())
+    {
+      throw std::invalid_argument("Invalid block size.");
+    }
+    auto state = std::make_shared<State>();
+    state->DownloadRangeFunc = std::move(downloadRangeFunc);
+    state->Length = length;
+    state->BlockSize = static_cast<size_t>(blockSize);
+    state->MaxParallelDownloads = (std::max)(maxParallelDownloads, 1);
+    // The blocks downloaded ahead of the read position are cached too.
+    state->MaxCachedBlocks
+        = static_cast<size_t>((std::max)(maxCachedBlocks, state->MaxParallelDownloads + 1));
+    state->Executor
+        = executor ? std::move(executor) : WorkStealingTransferExecutor::GetDefault();
+    state->BufferPool = bufferPool ? std::move(bufferPool) : TransferBufferPool::GetDefault();
+    state->Context = context.WithDeadline((Azure::DateTime::max)());
+    return BlobInputStream(std::move(state));
+  }
+
+  BlobInputStream::~BlobInputStream()
+  {
+    if (!m_state)
+    {
+      return;
+    }
+    std::map<int64_t, State::Block> blocks;
+    std::unique_lock<std::mutex> lock(m_state->Mutex);
+    m_state->Context.Cancel();
+    m_state->CancelDownloads(0, -1);
+    m_state->StateChanged.wait(lock, [this]() { return m_state->NumDownloading == 0; });
+    blocks.swap(m_state->Blocks);
+    m_state->RecentBlocks.clear();
+  }
+
+  int64_t BlobInputStream::Length() const { return m_state->Length; }
+
+  int64_t BlobInputStream::GetPosition() const { return m_state->Position; }
+
+  void BlobInputStream::Seek(int64_t offset)
+  {
+    auto& state = *m_state;
+    if (offset < 0 || offset > state.Length)
+    {
+      throw std::out_of_range("The offset is out of the blob.");
+    }
+    const int64_t blockSize = static_cast<int64_t>(state.BlockSize);
+    if (offset / blockSize != state.Position / blockSize)
+    {
+      const int64_t firstIndex = offset / blockSize;
+      std::lock_guard<std::mutex> lock(state.Mutex);
+      state.CancelDownloads(firstIndex, firstIndex + state.MaxParallelDownloads - 1);
+    }
+    state.Position = offset;
+  }
+
+  size_t BlobInputStream::OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context&)
+  {
+    auto& state = *m_state;
+    if (count == 0 || state.Position >= state.Length)
+    {
+      return 0;
+    }
+    const int64_t blockSize = static_cast<int64_t>(state.BlockSize);
+    const int64_t index = state.Position / blockSize;
+
+    std::unique_lock<std::mutex> lock(state.Mutex);
+    state.QueueBlocks(m_state, index);
+    State::Block* block;
+    while (true)
+    {
+      auto ite = state.Blocks.find(index);
+      if (ite == state.Blocks.end())
+      {
+        // The block was evicted, or its cancelled download completed.
+        state.QueueBlocks(m_state, index);
+        continue;
+      }
+      block = &ite->second;
+      if (block->Status == State::BlockStatus::Downloaded)
+      {
+        break;
+      }
+      if (block->Status == State::BlockStatus::Failed)
+      {
+        // The next read downloads the block again.
+        std::exception_ptr error = block->Error;
+        state.Blocks.erase(ite);
+        std::rethrow_exception(error);
+      }
+      if (block->Status == State::BlockStatus::Queued)
+      {
+        // The executor may not have run the task yet.
+        state.DownloadBlock(lock, index);
+      }
+      else
+      {
+        state.StateChanged.wait(lock);
+      }
+    }
+
+    state.RecentBlocks.splice(
+        state.RecentBlocks.begin(), state.RecentBlocks, block->RecentPosition);
+    const size_t offsetInBlock = static_cast<size_t>(state.Position - index * blockSize);
+    const size_t bytesToCopy = (std::min)(count, block->Data.size() - offsetInBlock);
+    std::memcpy(buffer, block->Data.data() + offsetInBlock, bytesToCopy);
+    state.Position += static_cast<int64_t>(bytesToCopy);
+    return bytesToCopy;
+  }
+
 }}} // namespace Azure::Storage::Blobs
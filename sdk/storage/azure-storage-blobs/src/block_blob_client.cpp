@@ -26,6 +26,9 @@
 #include <azure/storage/common/storage_common.hpp>
 #include <azure/storage/common/storage_exception.hpp>
 
+#include <limits>
+#include <mutex>
+
 namespace Azure { namespace Storage { namespace Blobs {
 
   BlockBlobClient BlockBlobClient::CreateFromConnectionString(
@@ -171,9 +174,16 @@ namespace Azure { namespace Storage { namespace Blobs {
       uploadBlockBlobOptions.AccessTier = options.AccessTier;
       uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
       uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
+      if (options.TransferOptions.TransactionalHashAlgorithm.HasValue())
+      {
+        uploadBlockBlobOptions.TransactionalContentHash = _internal::ComputeContentHash(
+            buffer, bufferSize, options.TransferOptions.TransactionalHashAlgorithm.Value());
+      }
       return Upload(contentStream, uploadBlockBlobOptions, context);
     }
 
+    int64_t minChunkSize = (bufferSize + MaxBlockNumber - 1) / MaxBlockNumber;
+    minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
     int64_t chunkSize;
     if (options.TransferOptions.ChunkSize.HasValue())
     {
@@ -181,8 +191,6 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     else
     {
-      int64_t minChunkSize = (bufferSize + MaxBlockNumber - 1) / MaxBlockNumber;
-      minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
       chunkSize = (std::max)(DefaultStageBlockSize, minChunkSize);
     }
     if (chunkSize > MaxStageBlockSize)
@@ -202,6 +210,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       Azure::Core::IO::MemoryBodyStream contentStream(buffer + offset, static_cast<size_t>(length));
       StageBlockOptions chunkOptions;
+      if (options.TransferOptions.TransactionalHashAlgorithm.HasValue())
+      {
+        chunkOptions.TransactionalContentHash = _internal::ComputeContentHash(
+            buffer + offset,
+            static_cast<size_t>(length),
+            options.TransferOptions.TransactionalHashAlgorithm.Value());
+      }
       auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
       if (chunkId == numChunks - 1)
       {
@@ -209,8 +224,28 @@ namespace Azure { namespace Storage { namespace Blobs {
       }
     };
 
-    _internal::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc);
+    if (options.TransferOptions.EnableAutoTuning)
+    {
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          bufferSize,
+          chunkSize,
+          (std::max)((std::min)(chunkSize, _internal::MinAdaptiveChunkSize), minChunkSize),
+          (std::min)((std::max)(chunkSize, _internal::MaxAdaptiveChunkSize), MaxStageBlockSize),
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          options.TransferOptions.Executor);
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          options.TransferOptions.Executor);
+    }
 
     for (size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -246,20 +281,104 @@ namespace Azure { namespace Storage { namespace Blobs {
     constexpr int64_t MaxBlockNumber = 50000;
     constexpr int64_t BlockGrainSize = 1 * 1024 * 1024;
 
+    std::unique_ptr<_internal::MappedFileReader> mappedFileReader;
+    std::unique_ptr<_internal::FileReader> fileReader;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      mappedFileReader = std::make_unique<_internal::MappedFileReader>(fileName);
+    }
+    else
+    {
+      fileReader = std::make_unique<_internal::FileReader>(fileName);
+    }
+    const int64_t fileSize
+        = mappedFileReader ? mappedFileReader->GetFileSize() : fileReader->GetFileSize();
+
+    int64_t minChunkSize = (fileSize + MaxBlockNumber - 1) / MaxBlockNumber;
+    minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
+    int64_t chunkSize;
+    if (options.TransferOptions.ChunkSize.HasValue())
+    {
+      chunkSize = options.TransferOptions.ChunkSize.Value();
+    }
+    else
     {
-      Azure::Core::IO::FileBodyStream contentStream(fileName);
+      chunkSize = (std::max)(DefaultStageBlockSize, minChunkSize);
+    }
 
-      if (contentStream.Length() <= options.TransferOptions.SingleUploadThreshold)
+    const auto& hashAlgorithm = options.TransferOptions.TransactionalHashAlgorithm;
+    // The chunks of a file which is not mapped are read into buffers to be hashed, so a file is
+    // only uploaded at once if it fits in a chunk buffer.
+    const bool readChunks = hashAlgorithm.HasValue() && !mappedFileReader;
+    std::shared_ptr<TransferBufferPool> bufferPool;
+    if (readChunks)
+    {
+      if (static_cast<uint64_t>(chunkSize) > (std::numeric_limits<size_t>::max)())
       {
-        UploadBlockBlobOptions uploadBlockBlobOptions;
-        uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
-        uploadBlockBlobOptions.Metadata = options.Metadata;
-        uploadBlockBlobOptions.Tags = options.Tags;
-        uploadBlockBlobOptions.AccessTier = options.AccessTier;
-        uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
-        uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
-        return Upload(contentStream, uploadBlockBlobOptions, context);
+        throw Azure::Core::RequestFailedException("Block size is too big.");
       }
+      bufferPool = options.TransferOptions.BufferPool ? options.TransferOptions.BufferPool
+                                                      : TransferBufferPool::GetDefault();
+    }
+
+    // Gets the content of a chunk, and computes its hash if requested. The content is read into
+    // buffer if it needs to be hashed and the file is not mapped.
+    auto getChunk = [&](int64_t offset,
+                        int64_t length,
+                        TransferBufferPool::Buffer& buffer,
+                        Azure::Nullable<ContentHash>& hash) {
+      std::unique_ptr<Azure::Core::IO::BodyStream> contentStream;
+      const uint8_t* data = nullptr;
+      if (mappedFileReader)
+      {
+        data = mappedFileReader->GetData() + offset;
+      }
+      else if (readChunks)
+      {
+        buffer = bufferPool->Acquire(static_cast<size_t>(length), context);
+        Azure::Core::IO::_internal::RandomAccessFileBodyStream fileStream(
+            fileReader->GetHandle(), offset, length);
+        if (fileStream.ReadToCount(buffer.GetData(), static_cast<size_t>(length), context)
+            != static_cast<size_t>(length))
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        data = buffer.GetData();
+      }
+      if (hashAlgorithm.HasValue())
+      {
+        hash = _internal::ComputeContentHash(
+            data, static_cast<size_t>(length), hashAlgorithm.Value());
+      }
+      if (mappedFileReader || readChunks)
+      {
+        contentStream = std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+            data, static_cast<size_t>(length));
+      }
+      else
+      {
+        contentStream = std::make_unique<Azure::Core::IO::_internal::RandomAccessFileBodyStream>(
+            fileReader->GetHandle(), offset, length);
+      }
+      return contentStream;
+    };
+
+    const int64_t singleUploadThreshold = readChunks
+        ? (std::min)(options.TransferOptions.SingleUploadThreshold, chunkSize)
+        : options.TransferOptions.SingleUploadThreshold;
+    if (fileSize <= singleUploadThreshold)
+    {
+      UploadBlockBlobOptions uploadBlockBlobOptions;
+      uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
+      uploadBlockBlobOptions.Metadata = options.Metadata;
+      uploadBlockBlobOptions.Tags = options.Tags;
+      uploadBlockBlobOptions.AccessTier = options.AccessTier;
+      uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
+      uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
+      TransferBufferPool::Buffer buffer;
+      auto contentStream
+          = getChunk(0, fileSize, buffer, uploadBlockBlobOptions.TransactionalContentHash);
+      return Upload(*contentStream, uploadBlockBlobOptions, context);
     }
 
     std::vector<std::string> blockIds;
@@ -271,19 +390,79 @@ namespace Azure { namespace Storage { namespace Blobs {
           std::vector<uint8_t>(blockId.begin(), blockId.end()));
     };
 
-    _internal::FileReader fileReader(fileName);
-
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
-          fileReader.GetHandle(), offset, length);
       StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      TransferBufferPool::Buffer buffer;
+      auto contentStream = getChunk(offset, length, buffer, chunkOptions.TransactionalContentHash);
+      auto blockInfo = StageBlock(getBlockId(chunkId), *contentStream, chunkOptions, context);
       if (chunkId == numChunks - 1)
       {
         blockIds.resize(static_cast<size_t>(numChunks));
       }
     };
 
+    if (chunkSize > MaxStageBlockSize)
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+
+    if (options.TransferOptions.EnableAutoTuning)
+    {
+      _internal::AdaptiveConcurrentTransfer(
+          0,
+          fileSize,
+          chunkSize,
+          (std::max)((std::min)(chunkSize, _internal::MinAdaptiveChunkSize), minChunkSize),
+          (std::min)((std::max)(chunkSize, _internal::MaxAdaptiveChunkSize), MaxStageBlockSize),
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          options.TransferOptions.Executor);
+    }
+    else
+    {
+      _internal::ConcurrentTransfer(
+          0,
+          fileSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadBlockFunc,
+          options.TransferOptions.Executor);
+    }
+
+    for (size_t i = 0; i < blockIds.size(); ++i)
+    {
+      blockIds[i] = getBlockId(static_cast<int64_t>(i));
+    }
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.HttpHeaders = options.HttpHeaders;
+    commitBlockListOptions.Metadata = options.Metadata;
+    commitBlockListOptions.Tags = options.Tags;
+    commitBlockListOptions.AccessTier = options.AccessTier;
+    commitBlockListOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
+    commitBlockListOptions.HasLegalHold = options.HasLegalHold;
+    auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions, context);
+
+    Models::UploadBlockBlobFromResult result;
+    result.ETag = commitBlockListResponse.Value.ETag;
+    result.LastModified = commitBlockListResponse.Value.LastModified;
+    result.VersionId = commitBlockListResponse.Value.VersionId;
+    result.IsServerEncrypted = commitBlockListResponse.Value.IsServerEncrypted;
+    result.EncryptionKeySha256 = commitBlockListResponse.Value.EncryptionKeySha256;
+    result.EncryptionScope = commitBlockListResponse.Value.EncryptionScope;
+    return Azure::Response<Models::UploadBlockBlobFromResult>(
+        std::move(result), std::move(commitBlockListResponse.RawResponse));
+  }
+
+  Azure::Response<Models::UploadBlockBlobFromResult> BlockBlobClient::UploadFrom(
+      Azure::Core::IO::BodyStream& content,
+      const UploadBlockBlobFromOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t DefaultStageBlockSize = 4 * 1024 * 1024ULL;
+    constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
+    constexpr int64_t MaxBlockNumber = 50000;
+    constexpr int64_t BlockGrainSize = 1 * 1024 * 1024;
+
     int64_t chunkSize;
     if (options.TransferOptions.ChunkSize.HasValue())
     {
@@ -291,7 +470,9 @@ namespace Azure { namespace Storage { namespace Blobs {
     }
     else
     {
-      int64_t minChunkSize = (fileReader.GetFileSize() + MaxBlockNumber - 1) / MaxBlockNumber;
+      // The length is -1 when it is unknown.
+      int64_t minChunkSize = ((std::max)(content.Length(), int64_t(0)) + MaxBlockNumber - 1)
+          / MaxBlockNumber;
       minChunkSize = (minChunkSize + BlockGrainSize - 1) / BlockGrainSize * BlockGrainSize;
       chunkSize = (std::max)(DefaultStageBlockSize, minChunkSize);
     }
@@ -299,17 +480,140 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       throw Azure::Core::RequestFailedException("Block size is too big.");
     }
+    if (static_cast<uint64_t>(chunkSize) > (std::numeric_limits<size_t>::max)())
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+    const size_t blockSize = static_cast<size_t>(chunkSize);
+    const auto bufferPool = options.TransferOptions.BufferPool
+        ? options.TransferOptions.BufferPool
+        : TransferBufferPool::GetDefault();
+
+    // The first block tells whether the content fits in a single upload.
+    auto firstBuffer = bufferPool->Acquire(blockSize, context);
+    const size_t firstBlockLength = content.ReadToCount(firstBuffer.GetData(), blockSize, context);
+    if (firstBlockLength < blockSize
+        && static_cast<int64_t>(firstBlockLength) <= options.TransferOptions.SingleUploadThreshold)
+    {
+      Azure::Core::IO::MemoryBodyStream contentStream(firstBuffer.GetData(), firstBlockLength);
+      UploadBlockBlobOptions uploadBlockBlobOptions;
+      uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
+      uploadBlockBlobOptions.Metadata = options.Metadata;
+      uploadBlockBlobOptions.Tags = options.Tags;
+      uploadBlockBlobOptions.AccessTier = options.AccessTier;
+      uploadBlockBlobOptions.ImmutabilityPolicy = options.ImmutabilityPolicy;
+      uploadBlockBlobOptions.HasLegalHold = options.HasLegalHold;
+      if (options.TransferOptions.TransactionalHashAlgorithm.HasValue())
+      {
+        uploadBlockBlobOptions.TransactionalContentHash = _internal::ComputeContentHash(
+            firstBuffer.GetData(),
+            firstBlockLength,
+            options.TransferOptions.TransactionalHashAlgorithm.Value());
+      }
+      return Upload(contentStream, uploadBlockBlobOptions, context);
+    }
+
+    auto getBlockId = [](int64_t id) {
+      constexpr size_t BlockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    // The workers take turns reading the next block from the stream, then stage it while the
+    // others read and stage the following blocks. Each worker holds a single buffer.
+    std::mutex readMutex;
+    int64_t numBlocks = 0;
+    bool endOfStream = firstBlockLength < blockSize;
+    bool failed = false;
+    size_t pendingBlockLength = firstBlockLength;
+    TransferBufferPool::Buffer pendingBuffer = std::move(firstBuffer);
+
+    auto stageBlocksFunc = [&](int64_t, int64_t, int64_t, int64_t) {
+      TransferBufferPool::Buffer buffer;
+      while (true)
+      {
+        int64_t blockId;
+        size_t blockLength;
+        try
+        {
+          std::unique_lock<std::mutex> lock(readMutex);
+          if (pendingBuffer.GetData())
+          {
+            buffer = std::move(pendingBuffer);
+            blockLength = pendingBlockLength;
+          }
+          else
+          {
+            if (endOfStream || failed)
+            {
+              return;
+            }
+            if (!buffer.GetData())
+            {
+              // Waiting for the pool must not hold up the other workers.
+              lock.unlock();
+              buffer = bufferPool->Acquire(blockSize, context);
+              lock.lock();
+              if (endOfStream || failed)
+              {
+                return;
+              }
+            }
+            blockLength = content.ReadToCount(buffer.GetData(), blockSize, context);
+            endOfStream = blockLength < blockSize;
+            if (blockLength == 0)
+            {
+              return;
+            }
+          }
+          if (numBlocks == MaxBlockNumber)
+          {
+            throw Azure::Core::RequestFailedException(
+                "The content is too large for the block size.");
+          }
+          blockId = numBlocks++;
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> guard(readMutex);
+          failed = true;
+          throw;
+        }
 
+        try
+        {
+          // Hashed after the read, so that it overlaps the other workers' reads and uploads.
+          StageBlockOptions stageBlockOptions;
+          if (options.TransferOptions.TransactionalHashAlgorithm.HasValue())
+          {
+            stageBlockOptions.TransactionalContentHash = _internal::ComputeContentHash(
+                buffer.GetData(),
+                blockLength,
+                options.TransferOptions.TransactionalHashAlgorithm.Value());
+          }
+          Azure::Core::IO::MemoryBodyStream blockContent(buffer.GetData(), blockLength);
+          StageBlock(getBlockId(blockId), blockContent, stageBlockOptions, context);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> guard(readMutex);
+          failed = true;
+          throw;
+        }
+      }
+    };
+
+    const int concurrency = (std::max)(options.TransferOptions.Concurrency, 1);
     _internal::ConcurrentTransfer(
-        0,
-        fileReader.GetFileSize(),
-        chunkSize,
-        options.TransferOptions.Concurrency,
-        uploadBlockFunc);
+        0, concurrency, 1, concurrency, stageBlocksFunc, options.TransferOptions.Executor);
 
-    for (size_t i = 0; i < blockIds.size(); ++i)
+    std::vector<std::string> blockIds;
+    blockIds.reserve(static_cast<size_t>(numBlocks));
+    for (int64_t i = 0; i < numBlocks; ++i)
     {
-      blockIds[i] = getBlockId(static_cast<int64_t>(i));
+      blockIds.push_back(getBlockId(i));
     }
     CommitBlockListOptions commitBlockListOptions;
     commitBlockListOptions.HttpHeaders = options.HttpHeaders;
@@ -331,6 +635,57 @@ namespace Azure { namespace Storage { namespace Blobs {
         std::move(result), std::move(commitBlockListResponse.RawResponse));
   }
 
+  BlobOutputStream BlockBlobClient::GetOutputStream(
+      const GetBlockBlobOutputStreamOptions& options,
+      const Azure::Core::Context& context) const
+  {
+    constexpr int64_t MaxStageBlockSize = 4000 * 1024 * 1024ULL;
+    if (options.TransferOptions.BlockSize > MaxStageBlockSize)
+    {
+      throw Azure::Core::RequestFailedException("Block size is too big.");
+    }
+
+    auto getBlockId = [](int64_t id) {
+      constexpr size_t BlockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(BlockIdLength - blockId.length(), '0') + blockId;
+      return Azure::Core::Convert::Base64Encode(
+          std::vector<uint8_t>(blockId.begin(), blockId.end()));
+    };
+
+    auto uploadBlockFunc = [blockBlobClient = *this, getBlockId](
+                               int64_t blockIndex,
+                               Azure::Core::IO::BodyStream& content,
+                               const Azure::Core::Context& context) {
+      blockBlobClient.StageBlock(getBlockId(blockIndex), content, StageBlockOptions(), context);
+    };
+
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.HttpHeaders = options.HttpHeaders;
+    commitBlockListOptions.Metadata = options.Metadata;
+    commitBlockListOptions.Tags = options.Tags;
+    commitBlockListOptions.AccessTier = options.AccessTier;
+    auto commitFunc = [blockBlobClient = *this, getBlockId, commitBlockListOptions](
+                          int64_t numBlocks, const Azure::Core::Context& context) {
+      std::vector<std::string> blockIds(static_cast<size_t>(numBlocks));
+      for (size_t i = 0; i < blockIds.size(); ++i)
+      {
+        blockIds[i] = getBlockId(static_cast<int64_t>(i));
+      }
+      blockBlobClient.CommitBlockList(blockIds, commitBlockListOptions, context);
+    };
+
+    return BlobOutputStream::Create(
+        std::move(uploadBlockFunc),
+        std::move(commitFunc),
+        options.TransferOptions.BlockSize,
+        options.TransferOptions.Concurrency,
+        options.TransferOptions.Concurrency * 2,
+        options.TransferOptions.Executor,
+        options.TransferOptions.BufferPool,
+        context);
+  }
+
   Azure::Response<Models::UploadBlockBlobFromUriResult> BlockBlobClient::UploadFromUri(
       const std::string& sourceUri,
       const UploadBlockBlobFromUriOptions& options,
@@ -0,0 +1,1490 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "list_blobs_reader.hpp"
+
+#include <azure/core/http/http.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+#include <azure/storage/common/storage_exception.hpp>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  namespace {
+    std::string ListBlobsIncludeFlagsToString(
+        const Azure::Storage::Blobs::Models::ListBlobsIncludeFlags& val)
+    {
+      const Azure::Storage::Blobs::Models::ListBlobsIncludeFlags valueList[] = {
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Copy,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Deleted,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Metadata,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Snapshots,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::UncomittedBlobs,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Versions,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::Tags,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::ImmutabilityPolicy,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::LegalHold,
+          Azure::Storage::Blobs::Models::ListBlobsIncludeFlags::DeletedWithVersions,
+      };
+      const char* stringList[] = {
+          "copy",
+          "deleted",
+          "metadata",
+          "snapshots",
+          "uncommittedblobs",
+          "versions",
+          "tags",
+          "immutabilitypolicy",
+          "legalhold",
+          "deletedwithversions",
+      };
+      std::string ret;
+      for (size_t i = 0; i < 10; ++i)
+      {
+        if ((val & valueList[i]) == valueList[i])
+        {
+          if (!ret.empty())
+          {
+            ret += ",";
+          }
+          ret += stringList[i];
+        }
+      }
+      return ret;
+    }
+  } // namespace
+
+  std::unique_ptr<Core::Http::RawResponse> SendListBlobs(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const BlobContainerClient::ListBlobContainerBlobsOptions& options,
+      bool shouldBufferResponse,
+      const Core::Context& context)
+  {
+    auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url, shouldBufferResponse);
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue() && !options.Prefix.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.Marker.HasValue() && !options.Marker.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.Marker.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    if (options.Include.HasValue()
+        && !ListBlobsIncludeFlagsToString(options.Include.Value()).empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include",
+          _internal::UrlEncodeQueryParameter(
+              ListBlobsIncludeFlagsToString(options.Include.Value())));
+    }
+    if (options.StartFrom.HasValue() && !options.StartFrom.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "startFrom", _internal::UrlEncodeQueryParameter(options.StartFrom.Value()));
+    }
+    request.SetHeader("x-ms-version", "2026-02-06");
+    auto pRawResponse = pipeline.Send(request, context);
+    auto httpStatusCode = pRawResponse->GetStatusCode();
+    if (httpStatusCode != Core::Http::HttpStatusCode::Ok)
+    {
+      throw StorageException::CreateFromResponse(std::move(pRawResponse));
+    }
+    return pRawResponse;
+  }
+
+  struct ListBlobsResultReader::State final
+  {
+    enum class XmlTagEnum
+    {
+      kUnknown,
+      kEnumerationResults,
+      kPrefix,
+      kNextMarker,
+      kBlobs,
+      kBlob,
+      kName,
+      kDeleted,
+      kSnapshot,
+      kVersionId,
+      kIsCurrentVersion,
+      kProperties,
+      kCreationTime,
+      kLastModified,
+      kEtag,
+      kXMsBlobSequenceNumber,
+      kLeaseStatus,
+      kLeaseState,
+      kLeaseDuration,
+      kCopyId,
+      kCopyStatus,
+      kCopySource,
+      kCopyProgress,
+      kCopyCompletionTime,
+      kCopyStatusDescription,
+      kServerEncrypted,
+      kIncrementalCopy,
+      kCopyDestinationSnapshot,
+      kDeletedTime,
+      kRemainingRetentionDays,
+      kAccessTier,
+      kAccessTierInferred,
+      kArchiveStatus,
+      kCustomerProvidedKeySha256,
+      kEncryptionScope,
+      kAccessTierChangeTime,
+      kExpiryTime,
+      kSealed,
+      kRehydratePriority,
+      kLastAccessTime,
+      kLegalHold,
+      kContentType,
+      kContentEncoding,
+      kContentLanguage,
+      kContentMD5,
+      kContentDisposition,
+      kCacheControl,
+      kMetadata,
+      kTags,
+      kTagSet,
+      kTag,
+      kKey,
+      kValue,
+      kOrMetadata,
+      kImmutabilityPolicyUntilDate,
+      kImmutabilityPolicyMode,
+      kHasVersionsOnly,
+      kContentLength,
+      kBlobType,
+      kDeletionId,
+    };
+    explicit State(std::unique_ptr<Core::IO::BodyStream> body)
+        : Body(std::move(body)), Reader(*Body)
+    {
+    }
+    std::unique_ptr<Core::IO::BodyStream> Body;
+    _internal::XmlPullReader Reader;
+    std::vector<XmlTagEnum> XmlPath;
+    Models::_detail::BlobItem VectorElement1;
+    std::string MapKey2;
+    std::string MapValue3;
+    std::string MapKey4;
+    std::string MapValue5;
+    Models::ObjectReplicationPolicy VectorElement6;
+    Models::ObjectReplicationRule VectorElement7;
+  };
+
+  ListBlobsResultReader::ListBlobsResultReader(std::unique_ptr<Core::IO::BodyStream> bodyStream)
+      : m_state(std::make_unique<State>(std::move(bodyStream)))
+  {
+  }
+
+  ListBlobsResultReader::~ListBlobsResultReader() = default;
+
+  bool ListBlobsResultReader::ReadNext(
+      Models::_detail::BlobItem& item,
+      const Core::Context& context)
+  {
+    using XmlTagEnum = State::XmlTagEnum;
+    static const _internal::XmlTagMap<XmlTagEnum> XmlTagEnumMap{
+        {"EnumerationResults", XmlTagEnum::kEnumerationResults},
+        {"Prefix", XmlTagEnum::kPrefix},
+        {"NextMarker", XmlTagEnum::kNextMarker},
+        {"Blobs", XmlTagEnum::kBlobs},
+        {"Blob", XmlTagEnum::kBlob},
+        {"Name", XmlTagEnum::kName},
+        {"Deleted", XmlTagEnum::kDeleted},
+        {"Snapshot", XmlTagEnum::kSnapshot},
+        {"VersionId", XmlTagEnum::kVersionId},
+        {"IsCurrentVersion", XmlTagEnum::kIsCurrentVersion},
+        {"Properties", XmlTagEnum::kProperties},
+        {"Creation-Time", XmlTagEnum::kCreationTime},
+        {"Last-Modified", XmlTagEnum::kLastModified},
+        {"Etag", XmlTagEnum::kEtag},
+        {"x-ms-blob-sequence-number", XmlTagEnum::kXMsBlobSequenceNumber},
+        {"LeaseStatus", XmlTagEnum::kLeaseStatus},
+        {"LeaseState", XmlTagEnum::kLeaseState},
+        {"LeaseDuration", XmlTagEnum::kLeaseDuration},
+        {"CopyId", XmlTagEnum::kCopyId},
+        {"CopyStatus", XmlTagEnum::kCopyStatus},
+        {"CopySource", XmlTagEnum::kCopySource},
+        {"CopyProgress", XmlTagEnum::kCopyProgress},
+        {"CopyCompletionTime", XmlTagEnum::kCopyCompletionTime},
+        {"CopyStatusDescription", XmlTagEnum::kCopyStatusDescription},
+        {"ServerEncrypted", XmlTagEnum::kServerEncrypted},
+        {"IncrementalCopy", XmlTagEnum::kIncrementalCopy},
+        {"CopyDestinationSnapshot", XmlTagEnum::kCopyDestinationSnapshot},
+        {"DeletedTime", XmlTagEnum::kDeletedTime},
+        {"RemainingRetentionDays", XmlTagEnum::kRemainingRetentionDays},
+        {"AccessTier", XmlTagEnum::kAccessTier},
+        {"AccessTierInferred", XmlTagEnum::kAccessTierInferred},
+        {"ArchiveStatus", XmlTagEnum::kArchiveStatus},
+        {"CustomerProvidedKeySha256", XmlTagEnum::kCustomerProvidedKeySha256},
+        {"EncryptionScope", XmlTagEnum::kEncryptionScope},
+        {"AccessTierChangeTime", XmlTagEnum::kAccessTierChangeTime},
+        {"Expiry-Time", XmlTagEnum::kExpiryTime},
+        {"Sealed", XmlTagEnum::kSealed},
+        {"RehydratePriority", XmlTagEnum::kRehydratePriority},
+        {"LastAccessTime", XmlTagEnum::kLastAccessTime},
+        {"LegalHold", XmlTagEnum::kLegalHold},
+        {"Content-Type", XmlTagEnum::kContentType},
+        {"Content-Encoding", XmlTagEnum::kContentEncoding},
+        {"Content-Language", XmlTagEnum::kContentLanguage},
+        {"Content-MD5", XmlTagEnum::kContentMD5},
+        {"Content-Disposition", XmlTagEnum::kContentDisposition},
+        {"Cache-Control", XmlTagEnum::kCacheControl},
+        {"Metadata", XmlTagEnum::kMetadata},
+        {"Tags", XmlTagEnum::kTags},
+        {"TagSet", XmlTagEnum::kTagSet},
+        {"Tag", XmlTagEnum::kTag},
+        {"Key", XmlTagEnum::kKey},
+        {"Value", XmlTagEnum::kValue},
+        {"OrMetadata", XmlTagEnum::kOrMetadata},
+        {"ImmutabilityPolicyUntilDate", XmlTagEnum::kImmutabilityPolicyUntilDate},
+        {"ImmutabilityPolicyMode", XmlTagEnum::kImmutabilityPolicyMode},
+        {"HasVersionsOnly", XmlTagEnum::kHasVersionsOnly},
+        {"Content-Length", XmlTagEnum::kContentLength},
+        {"BlobType", XmlTagEnum::kBlobType},
+        {"DeletionId", XmlTagEnum::kDeletionId},
+    };
+    auto& reader = m_state->Reader;
+    auto& response = Result;
+    auto& xmlPath = m_state->XmlPath;
+    auto& vectorElement1 = m_state->VectorElement1;
+    auto& mapKey2 = m_state->MapKey2;
+    auto& mapValue3 = m_state->MapValue3;
+    auto& mapKey4 = m_state->MapKey4;
+    auto& mapValue5 = m_state->MapValue5;
+    auto& vectorElement6 = m_state->VectorElement6;
+    auto& vectorElement7 = m_state->VectorElement7;
+    while (true)
+    {
+      auto node = reader.Read(context);
+      if (node.Type == _internal::XmlNodeType::End)
+      {
+        return false;
+      }
+      else if (node.Type == _internal::XmlNodeType::StartTag)
+      {
+        xmlPath.push_back(XmlTagEnumMap.Find(node.Name));
+        if (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kMetadata)
+        {
+          mapKey2 = node.Name;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kOrMetadata)
+        {
+          vectorElement6.PolicyId = node.Name;
+          vectorElement7.RuleId = node.Name;
+        }
+        else if (
+            ((xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyUntilDate)
+             || (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+                 && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+                 && xmlPath[3] == XmlTagEnum::kProperties
+                 && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyMode))
+            && !vectorElement1.Details.ImmutabilityPolicy.HasValue())
+        {
+          vectorElement1.Details.ImmutabilityPolicy = Models::BlobImmutabilityPolicy();
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Text)
+      {
+        if (xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kPrefix)
+        {
+          response.Prefix = node.Value;
+        }
+        else if (
+            xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kNextMarker)
+        {
+          response.ContinuationToken = node.Value;
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kName)
+        {
+          vectorElement1.Name.Content = node.Value;
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kDeleted)
+        {
+          vectorElement1.IsDeleted = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kSnapshot)
+        {
+          vectorElement1.Snapshot = node.Value;
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kVersionId)
+        {
+          vectorElement1.VersionId = node.Value;
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kIsCurrentVersion)
+        {
+          vectorElement1.IsCurrentVersion = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCreationTime)
+        {
+          vectorElement1.Details.CreatedOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLastModified)
+        {
+          vectorElement1.Details.LastModified
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kEtag)
+        {
+          vectorElement1.Details.ETag = ETag(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kXMsBlobSequenceNumber)
+        {
+          vectorElement1.Details.SequenceNumber = std::stoll(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLeaseStatus)
+        {
+          vectorElement1.Details.LeaseStatus = Models::LeaseStatus(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLeaseState)
+        {
+          vectorElement1.Details.LeaseState = Models::LeaseState(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kLeaseDuration)
+        {
+          vectorElement1.Details.LeaseDuration = Models::LeaseDurationType(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyId)
+        {
+          vectorElement1.Details.CopyId = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyStatus)
+        {
+          vectorElement1.Details.CopyStatus = Models::CopyStatus(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopySource)
+        {
+          vectorElement1.Details.CopySource = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyProgress)
+        {
+          vectorElement1.Details.CopyProgress = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kCopyCompletionTime)
+        {
+          vectorElement1.Details.CopyCompletedOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kCopyStatusDescription)
+        {
+          vectorElement1.Details.CopyStatusDescription = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kServerEncrypted)
+        {
+          vectorElement1.Details.IsServerEncrypted = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kIncrementalCopy)
+        {
+          vectorElement1.Details.IsIncrementalCopy = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kCopyDestinationSnapshot)
+        {
+          vectorElement1.Details.IncrementalCopyDestinationSnapshot = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kDeletedTime)
+        {
+          vectorElement1.Details.DeletedOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kRemainingRetentionDays)
+        {
+          vectorElement1.Details.RemainingRetentionDays = std::stoi(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kAccessTier)
+        {
+          vectorElement1.Details.AccessTier = Models::AccessTier(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kAccessTierInferred)
+        {
+          vectorElement1.Details.IsAccessTierInferred = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kArchiveStatus)
+        {
+          vectorElement1.Details.ArchiveStatus = Models::ArchiveStatus(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kCustomerProvidedKeySha256)
+        {
+          vectorElement1.Details.EncryptionKeySha256 = Core::Convert::Base64Decode(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kEncryptionScope)
+        {
+          vectorElement1.Details.EncryptionScope = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kAccessTierChangeTime)
+        {
+          vectorElement1.Details.AccessTierChangedOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kExpiryTime)
+        {
+          vectorElement1.Details.ExpiresOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kSealed)
+        {
+          vectorElement1.Details.IsSealed = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kRehydratePriority)
+        {
+          vectorElement1.Details.RehydratePriority = Models::RehydratePriority(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kLastAccessTime)
+        {
+          vectorElement1.Details.LastAccessedOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLegalHold)
+        {
+          vectorElement1.Details.HasLegalHold = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kContentType)
+        {
+          vectorElement1.Details.HttpHeaders.ContentType = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kContentEncoding)
+        {
+          vectorElement1.Details.HttpHeaders.ContentEncoding = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kContentLanguage)
+        {
+          vectorElement1.Details.HttpHeaders.ContentLanguage = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kContentMD5)
+        {
+          vectorElement1.Details.HttpHeaders.ContentHash.Value
+              = Core::Convert::Base64Decode(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kContentDisposition)
+        {
+          vectorElement1.Details.HttpHeaders.ContentDisposition = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCacheControl)
+        {
+          vectorElement1.Details.HttpHeaders.CacheControl = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kMetadata)
+        {
+          mapValue3 = node.Value;
+        }
+        else if (
+            xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+            && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kKey)
+        {
+          mapKey4 = node.Value;
+        }
+        else if (
+            xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+            && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kValue)
+        {
+          mapValue5 = node.Value;
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kOrMetadata)
+        {
+          vectorElement7.ReplicationStatus = Models::ObjectReplicationStatus(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyUntilDate)
+        {
+          vectorElement1.Details.ImmutabilityPolicy.Value().ExpiresOn
+              = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyMode)
+        {
+          vectorElement1.Details.ImmutabilityPolicy.Value().PolicyMode
+              = Models::BlobImmutabilityPolicyMode(node.Value);
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kHasVersionsOnly)
+        {
+          vectorElement1.HasVersionsOnly = node.Value == std::string("true");
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties
+            && xmlPath[4] == XmlTagEnum::kContentLength)
+        {
+          vectorElement1.BlobSize = std::stoll(node.Value);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kBlobType)
+        {
+          vectorElement1.BlobType = Models::BlobType(node.Value);
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kDeletionId)
+        {
+          vectorElement1.DeletionId = node.Value;
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::Attribute)
+      {
+        if (xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && node.Name == "ServiceEndpoint")
+        {
+          response.ServiceEndpoint = node.Value;
+        }
+        else if (
+            xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && node.Name == "ContainerName")
+        {
+          response.BlobContainerName = node.Value;
+        }
+        else if (
+            xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kName && node.Name == "Encoded")
+        {
+          vectorElement1.Name.Encoded = node.Value == std::string("true");
+        }
+      }
+      else if (node.Type == _internal::XmlNodeType::EndTag)
+      {
+        if (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kMetadata)
+        {
+          vectorElement1.Details.Metadata[std::move(mapKey2)] = std::move(mapValue3);
+        }
+        else if (
+            xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+            && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kValue)
+        {
+          vectorElement1.Details.Tags[std::move(mapKey4)] = std::move(mapValue5);
+        }
+        else if (
+            xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+            && xmlPath[3] == XmlTagEnum::kOrMetadata)
+        {
+          vectorElement6.Rules.push_back(std::move(vectorElement7));
+          vectorElement7 = Models::ObjectReplicationRule();
+          vectorElement1.Details.ObjectReplicationSourceProperties.push_back(
+              std::move(vectorElement6));
+          vectorElement6 = Models::ObjectReplicationPolicy();
+        }
+        else if (
+            xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+            && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob)
+        {
+          item = std::move(vectorElement1);
+          vectorElement1 = Models::_detail::BlobItem();
+          xmlPath.pop_back();
+          return true;
+        }
+        xmlPath.pop_back();
+      }
+    }
+  }
+
+  Response<Models::_detail::ListBlobsByHierarchyResult> ListBlobsByHierarchy(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const BlobContainerClient::ListBlobContainerBlobsByHierarchyOptions& options,
+      const Core::Context& context)
+  {
+    auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("restype", "container");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue() && !options.Prefix.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (!options.Delimiter.empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "delimiter", _internal::UrlEncodeQueryParameter(options.Delimiter));
+    }
+    if (options.Marker.HasValue() && !options.Marker.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.Marker.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    if (options.Include.HasValue()
+        && !ListBlobsIncludeFlagsToString(options.Include.Value()).empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include",
+          _internal::UrlEncodeQueryParameter(
+              ListBlobsIncludeFlagsToString(options.Include.Value())));
+    }
+    if (options.StartFrom.HasValue() && !options.StartFrom.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "startFrom", _internal::UrlEncodeQueryParameter(options.StartFrom.Value()));
+    }
+    request.SetHeader("x-ms-version", "2026-02-06");
+    if (options.ShowOnly.HasValue() && !options.ShowOnly.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "showonly", _internal::UrlEncodeQueryParameter(options.ShowOnly.Value()));
+    }
+    auto pRawResponse = pipeline.Send(request, context);
+    auto httpStatusCode = pRawResponse->GetStatusCode();
+    if (httpStatusCode != Core::Http::HttpStatusCode::Ok)
+    {
+      throw StorageException::CreateFromResponse(std::move(pRawResponse));
+    }
+    Models::_detail::ListBlobsByHierarchyResult response;
+    {
+      // The reader decodes the document in its own buffer, so that the body of the raw response
+      // is left intact.
+      Core::IO::MemoryBodyStream responseBody(pRawResponse->GetBody());
+      _internal::XmlPullReader reader(responseBody);
+      enum class XmlTagEnum
+      {
+        kUnknown,
+        kEnumerationResults,
+        kPrefix,
+        kDelimiter,
+        kNextMarker,
+        kBlobs,
+        kBlob,
+        kName,
+        kDeleted,
+        kSnapshot,
+        kVersionId,
+        kIsCurrentVersion,
+        kProperties,
+        kCreationTime,
+        kLastModified,
+        kEtag,
+        kXMsBlobSequenceNumber,
+        kLeaseStatus,
+        kLeaseState,
+        kLeaseDuration,
+        kCopyId,
+        kCopyStatus,
+        kCopySource,
+        kCopyProgress,
+        kCopyCompletionTime,
+        kCopyStatusDescription,
+        kServerEncrypted,
+        kIncrementalCopy,
+        kCopyDestinationSnapshot,
+        kDeletedTime,
+        kRemainingRetentionDays,
+        kAccessTier,
+        kAccessTierInferred,
+        kArchiveStatus,
+        kCustomerProvidedKeySha256,
+        kEncryptionScope,
+        kAccessTierChangeTime,
+        kExpiryTime,
+        kSealed,
+        kRehydratePriority,
+        kLastAccessTime,
+        kLegalHold,
+        kContentType,
+        kContentEncoding,
+        kContentLanguage,
+        kContentMD5,
+        kContentDisposition,
+        kCacheControl,
+        kMetadata,
+        kTags,
+        kTagSet,
+        kTag,
+        kKey,
+        kValue,
+        kOrMetadata,
+        kImmutabilityPolicyUntilDate,
+        kImmutabilityPolicyMode,
+        kHasVersionsOnly,
+        kContentLength,
+        kBlobType,
+        kDeletionId,
+        kBlobPrefix,
+      };
+      static const _internal::XmlTagMap<XmlTagEnum> XmlTagEnumMap{
+          {"EnumerationResults", XmlTagEnum::kEnumerationResults},
+          {"Prefix", XmlTagEnum::kPrefix},
+          {"Delimiter", XmlTagEnum::kDelimiter},
+          {"NextMarker", XmlTagEnum::kNextMarker},
+          {"Blobs", XmlTagEnum::kBlobs},
+          {"Blob", XmlTagEnum::kBlob},
+          {"Name", XmlTagEnum::kName},
+          {"Deleted", XmlTagEnum::kDeleted},
+          {"Snapshot", XmlTagEnum::kSnapshot},
+          {"VersionId", XmlTagEnum::kVersionId},
+          {"IsCurrentVersion", XmlTagEnum::kIsCurrentVersion},
+          {"Properties", XmlTagEnum::kProperties},
+          {"Creation-Time", XmlTagEnum::kCreationTime},
+          {"Last-Modified", XmlTagEnum::kLastModified},
+          {"Etag", XmlTagEnum::kEtag},
+          {"x-ms-blob-sequence-number", XmlTagEnum::kXMsBlobSequenceNumber},
+          {"LeaseStatus", XmlTagEnum::kLeaseStatus},
+          {"LeaseState", XmlTagEnum::kLeaseState},
+          {"LeaseDuration", XmlTagEnum::kLeaseDuration},
+          {"CopyId", XmlTagEnum::kCopyId},
+          {"CopyStatus", XmlTagEnum::kCopyStatus},
+          {"CopySource", XmlTagEnum::kCopySource},
+          {"CopyProgress", XmlTagEnum::kCopyProgress},
+          {"CopyCompletionTime", XmlTagEnum::kCopyCompletionTime},
+          {"CopyStatusDescription", XmlTagEnum::kCopyStatusDescription},
+          {"ServerEncrypted", XmlTagEnum::kServerEncrypted},
+          {"IncrementalCopy", XmlTagEnum::kIncrementalCopy},
+          {"CopyDestinationSnapshot", XmlTagEnum::kCopyDestinationSnapshot},
+          {"DeletedTime", XmlTagEnum::kDeletedTime},
+          {"RemainingRetentionDays", XmlTagEnum::kRemainingRetentionDays},
+          {"AccessTier", XmlTagEnum::kAccessTier},
+          {"AccessTierInferred", XmlTagEnum::kAccessTierInferred},
+          {"ArchiveStatus", XmlTagEnum::kArchiveStatus},
+          {"CustomerProvidedKeySha256", XmlTagEnum::kCustomerProvidedKeySha256},
+          {"EncryptionScope", XmlTagEnum::kEncryptionScope},
+          {"AccessTierChangeTime", XmlTagEnum::kAccessTierChangeTime},
+          {"Expiry-Time", XmlTagEnum::kExpiryTime},
+          {"Sealed", XmlTagEnum::kSealed},
+          {"RehydratePriority", XmlTagEnum::kRehydratePriority},
+          {"LastAccessTime", XmlTagEnum::kLastAccessTime},
+          {"LegalHold", XmlTagEnum::kLegalHold},
+          {"Content-Type", XmlTagEnum::kContentType},
+          {"Content-Encoding", XmlTagEnum::kContentEncoding},
+          {"Content-Language", XmlTagEnum::kContentLanguage},
+          {"Content-MD5", XmlTagEnum::kContentMD5},
+          {"Content-Disposition", XmlTagEnum::kContentDisposition},
+          {"Cache-Control", XmlTagEnum::kCacheControl},
+          {"Metadata", XmlTagEnum::kMetadata},
+          {"Tags", XmlTagEnum::kTags},
+          {"TagSet", XmlTagEnum::kTagSet},
+          {"Tag", XmlTagEnum::kTag},
+          {"Key", XmlTagEnum::kKey},
+          {"Value", XmlTagEnum::kValue},
+          {"OrMetadata", XmlTagEnum::kOrMetadata},
+          {"ImmutabilityPolicyUntilDate", XmlTagEnum::kImmutabilityPolicyUntilDate},
+          {"ImmutabilityPolicyMode", XmlTagEnum::kImmutabilityPolicyMode},
+          {"HasVersionsOnly", XmlTagEnum::kHasVersionsOnly},
+          {"Content-Length", XmlTagEnum::kContentLength},
+          {"BlobType", XmlTagEnum::kBlobType},
+          {"DeletionId", XmlTagEnum::kDeletionId},
+          {"BlobPrefix", XmlTagEnum::kBlobPrefix},
+      };
+      std::vector<XmlTagEnum> xmlPath;
+      Models::_detail::BlobItem vectorElement1;
+      std::string mapKey2;
+      std::string mapValue3;
+      std::string mapKey4;
+      std::string mapValue5;
+      Models::ObjectReplicationPolicy vectorElement6;
+      Models::ObjectReplicationRule vectorElement7;
+      Models::_detail::BlobName vectorElement8;
+      while (true)
+      {
+        auto node = reader.Read(context);
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          break;
+        }
+        else if (node.Type == _internal::XmlNodeType::StartTag)
+        {
+          xmlPath.push_back(XmlTagEnumMap.Find(node.Name));
+          if (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kMetadata)
+          {
+            mapKey2 = node.Name;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kOrMetadata)
+          {
+            vectorElement6.PolicyId = node.Name;
+            vectorElement7.RuleId = node.Name;
+          }
+          else if (
+              ((xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+                && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+                && xmlPath[3] == XmlTagEnum::kProperties
+                && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyUntilDate)
+               || (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+                   && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+                   && xmlPath[3] == XmlTagEnum::kProperties
+                   && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyMode))
+              && !vectorElement1.Details.ImmutabilityPolicy.HasValue())
+          {
+            vectorElement1.Details.ImmutabilityPolicy = Models::BlobImmutabilityPolicy();
+          }
+        }
+        else if (node.Type == _internal::XmlNodeType::Text)
+        {
+          if (xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kPrefix)
+          {
+            response.Prefix = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kDelimiter)
+          {
+            response.Delimiter = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kNextMarker)
+          {
+            response.ContinuationToken = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kName)
+          {
+            vectorElement1.Name.Content = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kDeleted)
+          {
+            vectorElement1.IsDeleted = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kSnapshot)
+          {
+            vectorElement1.Snapshot = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kVersionId)
+          {
+            vectorElement1.VersionId = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kIsCurrentVersion)
+          {
+            vectorElement1.IsCurrentVersion = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCreationTime)
+          {
+            vectorElement1.Details.CreatedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLastModified)
+          {
+            vectorElement1.Details.LastModified
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kEtag)
+          {
+            vectorElement1.Details.ETag = ETag(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kXMsBlobSequenceNumber)
+          {
+            vectorElement1.Details.SequenceNumber = std::stoll(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLeaseStatus)
+          {
+            vectorElement1.Details.LeaseStatus = Models::LeaseStatus(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLeaseState)
+          {
+            vectorElement1.Details.LeaseState = Models::LeaseState(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLeaseDuration)
+          {
+            vectorElement1.Details.LeaseDuration = Models::LeaseDurationType(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyId)
+          {
+            vectorElement1.Details.CopyId = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyStatus)
+          {
+            vectorElement1.Details.CopyStatus = Models::CopyStatus(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopySource)
+          {
+            vectorElement1.Details.CopySource = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCopyProgress)
+          {
+            vectorElement1.Details.CopyProgress = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kCopyCompletionTime)
+          {
+            vectorElement1.Details.CopyCompletedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kCopyStatusDescription)
+          {
+            vectorElement1.Details.CopyStatusDescription = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kServerEncrypted)
+          {
+            vectorElement1.Details.IsServerEncrypted = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kIncrementalCopy)
+          {
+            vectorElement1.Details.IsIncrementalCopy = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kCopyDestinationSnapshot)
+          {
+            vectorElement1.Details.IncrementalCopyDestinationSnapshot = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kDeletedTime)
+          {
+            vectorElement1.Details.DeletedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kRemainingRetentionDays)
+          {
+            vectorElement1.Details.RemainingRetentionDays = std::stoi(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kAccessTier)
+          {
+            vectorElement1.Details.AccessTier = Models::AccessTier(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kAccessTierInferred)
+          {
+            vectorElement1.Details.IsAccessTierInferred = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kArchiveStatus)
+          {
+            vectorElement1.Details.ArchiveStatus = Models::ArchiveStatus(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kCustomerProvidedKeySha256)
+          {
+            vectorElement1.Details.EncryptionKeySha256 = Core::Convert::Base64Decode(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kEncryptionScope)
+          {
+            vectorElement1.Details.EncryptionScope = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kAccessTierChangeTime)
+          {
+            vectorElement1.Details.AccessTierChangedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kExpiryTime)
+          {
+            vectorElement1.Details.ExpiresOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kSealed)
+          {
+            vectorElement1.Details.IsSealed = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kRehydratePriority)
+          {
+            vectorElement1.Details.RehydratePriority = Models::RehydratePriority(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLastAccessTime)
+          {
+            vectorElement1.Details.LastAccessedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLegalHold)
+          {
+            vectorElement1.Details.HasLegalHold = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kContentType)
+          {
+            vectorElement1.Details.HttpHeaders.ContentType = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kContentEncoding)
+          {
+            vectorElement1.Details.HttpHeaders.ContentEncoding = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kContentLanguage)
+          {
+            vectorElement1.Details.HttpHeaders.ContentLanguage = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kContentMD5)
+          {
+            vectorElement1.Details.HttpHeaders.ContentHash.Value
+                = Core::Convert::Base64Decode(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kContentDisposition)
+          {
+            vectorElement1.Details.HttpHeaders.ContentDisposition = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCacheControl)
+          {
+            vectorElement1.Details.HttpHeaders.CacheControl = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kMetadata)
+          {
+            mapValue3 = node.Value;
+          }
+          else if (
+              xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+              && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kKey)
+          {
+            mapKey4 = node.Value;
+          }
+          else if (
+              xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+              && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kValue)
+          {
+            mapValue5 = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kOrMetadata)
+          {
+            vectorElement7.ReplicationStatus = Models::ObjectReplicationStatus(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyUntilDate)
+          {
+            vectorElement1.Details.ImmutabilityPolicy.Value().ExpiresOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kImmutabilityPolicyMode)
+          {
+            vectorElement1.Details.ImmutabilityPolicy.Value().PolicyMode
+                = Models::BlobImmutabilityPolicyMode(node.Value);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kHasVersionsOnly)
+          {
+            vectorElement1.HasVersionsOnly = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kContentLength)
+          {
+            vectorElement1.BlobSize = std::stoll(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kBlobType)
+          {
+            vectorElement1.BlobType = Models::BlobType(node.Value);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kDeletionId)
+          {
+            vectorElement1.DeletionId = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlobPrefix
+              && xmlPath[3] == XmlTagEnum::kName)
+          {
+            vectorElement8.Content = node.Value;
+          }
+        }
+        else if (node.Type == _internal::XmlNodeType::Attribute)
+        {
+          if (xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "ServiceEndpoint")
+          {
+            response.ServiceEndpoint = node.Value;
+          }
+          else if (
+              xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "ContainerName")
+          {
+            response.BlobContainerName = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kName && node.Name == "Encoded")
+          {
+            vectorElement1.Name.Encoded = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlobPrefix
+              && xmlPath[3] == XmlTagEnum::kName && node.Name == "Encoded")
+          {
+            vectorElement8.Encoded = node.Value == std::string("true");
+          }
+        }
+        else if (node.Type == _internal::XmlNodeType::EndTag)
+        {
+          if (xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kMetadata)
+          {
+            vectorElement1.Details.Metadata[std::move(mapKey2)] = std::move(mapValue3);
+          }
+          else if (
+              xmlPath.size() == 7 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kTags && xmlPath[4] == XmlTagEnum::kTagSet
+              && xmlPath[5] == XmlTagEnum::kTag && xmlPath[6] == XmlTagEnum::kValue)
+          {
+            vectorElement1.Details.Tags[std::move(mapKey4)] = std::move(mapValue5);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob
+              && xmlPath[3] == XmlTagEnum::kOrMetadata)
+          {
+            vectorElement6.Rules.push_back(std::move(vectorElement7));
+            vectorElement7 = Models::ObjectReplicationRule();
+            vectorElement1.Details.ObjectReplicationSourceProperties.push_back(
+                std::move(vectorElement6));
+            vectorElement6 = Models::ObjectReplicationPolicy();
+          }
+          else if (
+              xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlob)
+          {
+            response.Items.push_back(std::move(vectorElement1));
+            vectorElement1 = Models::_detail::BlobItem();
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kBlobs && xmlPath[2] == XmlTagEnum::kBlobPrefix
+              && xmlPath[3] == XmlTagEnum::kName)
+          {
+            response.BlobPrefixes.push_back(std::move(vectorElement8));
+            vectorElement8 = Models::_detail::BlobName();
+          }
+          xmlPath.pop_back();
+        }
+      }
+    }
+    return Response<Models::_detail::ListBlobsByHierarchyResult>(
+        std::move(response), std::move(pRawResponse));
+  }
+
+}}}} // namespace Azure::Storage::Blobs::_detail
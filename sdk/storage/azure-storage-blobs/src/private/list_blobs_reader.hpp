@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/storage/blobs/rest_client.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/http/raw_response.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/core/response.hpp>
+#include <azure/core/url.hpp>
+
+#include <memory>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace _detail {
+
+  /**
+   * @brief Sends a ListBlobs request, the same one as BlobContainerClient::ListBlobs, and returns
+   * the response without deserializing its body. The body is left in the response stream when
+   * shouldBufferResponse is false.
+   */
+  std::unique_ptr<Core::Http::RawResponse> SendListBlobs(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const BlobContainerClient::ListBlobContainerBlobsOptions& options,
+      bool shouldBufferResponse,
+      const Core::Context& context);
+
+  /**
+   * @brief Deserializes the body of a ListBlobs response one blob at a time, as it is read from the
+   * body stream.
+   */
+  class ListBlobsResultReader final {
+  public:
+    explicit ListBlobsResultReader(std::unique_ptr<Core::IO::BodyStream> bodyStream);
+    ~ListBlobsResultReader();
+
+    /**
+     * Reads the next blob. Returns false once the whole body is read, and Result has all the fields
+     * but Items.
+     */
+    bool ReadNext(Models::_detail::BlobItem& item, const Core::Context& context);
+
+    Models::_detail::ListBlobsResult Result;
+
+  private:
+    struct State;
+    std::unique_ptr<State> m_state;
+  };
+
+  /**
+   * @brief Sends the same request as BlobContainerClient::ListBlobsByHierarchy, and deserializes
+   * the response with the pull parser instead of the generated XmlReader code.
+   */
+  Response<Models::_detail::ListBlobsByHierarchyResult> ListBlobsByHierarchy(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const BlobContainerClient::ListBlobContainerBlobsByHierarchyOptions& options,
+      const Core::Context& context);
+
+}}}} // namespace Azure::Storage::Blobs::_detail
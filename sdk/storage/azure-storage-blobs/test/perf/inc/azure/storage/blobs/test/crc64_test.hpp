@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the performance of the CRC64 hash used for the transactional hashes.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/random_stream.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief Measure the throughput of the CRC64 hash, with the implementation selected at runtime
+   * or with a given one.
+   *
+   */
+  class Crc64Test : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_buffer;
+    bool m_useDefault = true;
+    Azure::Storage::_detail::Crc64Implementation m_implementation
+        = Azure::Storage::_detail::Crc64Implementation::LookupTable;
+
+  public:
+    /**
+     * @brief Construct a new Crc64Test test.
+     *
+     * @param options The test options.
+     */
+    Crc64Test(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Create the buffer to hash and select the implementation.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_buffer = Azure::Perf::RandomStream::Create(size)->ReadToEnd(Azure::Core::Context{});
+
+      const auto implementation
+          = m_options.GetOptionOrDefault<std::string>("Implementation", "default");
+      if (implementation == "default")
+      {
+        return;
+      }
+      m_useDefault = false;
+      if (implementation == "table")
+      {
+        m_implementation = Azure::Storage::_detail::Crc64Implementation::LookupTable;
+      }
+      else if (implementation == "clmul")
+      {
+        m_implementation = Azure::Storage::_detail::Crc64Implementation::CarrylessMultiply;
+      }
+      else if (implementation == "vpclmul")
+      {
+        m_implementation = Azure::Storage::_detail::Crc64Implementation::VectorCarrylessMultiply;
+      }
+      else
+      {
+        throw std::invalid_argument("Unknown CRC64 implementation: " + implementation);
+      }
+      if (!Azure::Storage::_detail::IsCrc64ImplementationSupported(m_implementation))
+      {
+        throw std::runtime_error(
+            "The CRC64 implementation is not supported on this machine: " + implementation);
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      if (m_useDefault)
+      {
+        Azure::Storage::Crc64Hash hash;
+        hash.Append(m_buffer.data(), m_buffer.size());
+        hash.Final();
+      }
+      else
+      {
+        Azure::Storage::_detail::Crc64Append(
+            0, m_buffer.data(), m_buffer.size(), m_implementation);
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Implementation",
+           {"--implementation"},
+           "The CRC64 implementation: default, table, clmul or vpclmul. By default, the fastest "
+           "one supported by the machine is used.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"Crc64", "Compute the CRC64 hash of a buffer.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Blobs::Test::Crc64Test>(options);
+              }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -16,6 +16,7 @@
 #include <azure/perf/random_stream.hpp>
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
   private:
     // C++ can upload and download from contiguous memory or file only
     std::vector<uint8_t> m_uploadBuffer;
+    Azure::Storage::Blobs::UploadBlockBlobFromOptions m_uploadOptions;
 
   public:
     /**
@@ -49,6 +51,20 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
 
       long size = m_options.GetMandatoryOption<long>("Size");
       m_uploadBuffer = Azure::Perf::RandomStream::Create(size)->ReadToEnd(Azure::Core::Context{});
+
+      const auto hashAlgorithm = m_options.GetOptionOrDefault<std::string>("Hash", "none");
+      if (hashAlgorithm == "md5")
+      {
+        m_uploadOptions.TransferOptions.TransactionalHashAlgorithm = HashAlgorithm::Md5;
+      }
+      else if (hashAlgorithm == "crc64")
+      {
+        m_uploadOptions.TransferOptions.TransactionalHashAlgorithm = HashAlgorithm::Crc64;
+      }
+      else if (hashAlgorithm != "none")
+      {
+        throw std::invalid_argument("Unknown hash algorithm: " + hashAlgorithm);
+      }
     }
 
     /**
@@ -57,7 +73,7 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
      */
     void Run(Azure::Core::Context const&) override
     {
-      m_blobClient->UploadFrom(m_uploadBuffer.data(), m_uploadBuffer.size());
+      m_blobClient->UploadFrom(m_uploadBuffer.data(), m_uploadBuffer.size(), m_uploadOptions);
     }
 
     /**
@@ -73,7 +89,13 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Test {
            {"--token-credential"},
            "Use a token credential to run the test. By default, a connection string is used.",
            0},
-          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true}};
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Hash",
+           {"--hash"},
+           "The hash computed for each chunk and verified by the service: none, md5 or crc64. "
+           "None by default.",
+           1,
+           false}};
     }
 
     /**
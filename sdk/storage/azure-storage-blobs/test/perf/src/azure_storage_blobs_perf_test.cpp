@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include "azure/storage/blobs/test/crc64_test.hpp"
 #include "azure/storage/blobs/test/download_blob_from_sas.hpp"
 #include "azure/storage/blobs/test/download_blob_pipeline_only.hpp"
 #include "azure/storage/blobs/test/download_blob_test.hpp"
@@ -25,6 +26,7 @@ int main(int argc, char** argv)
         Azure::Storage::Blobs::Test::UploadBlob::GetTestMetadata(),
         Azure::Storage::Blobs::Test::ListBlob::GetTestMetadata(),
         Azure::Storage::Blobs::Test::DownloadBlobSas::GetTestMetadata(),
+        Azure::Storage::Blobs::Test::Crc64Test::GetTestMetadata(),
 #if defined(BUILD_CURL_HTTP_TRANSPORT_ADAPTER)
         Azure::Storage::Blobs::Test::DownloadBlobWithTransportOnly::GetTestMetadata(),
 #endif
@@ -152,6 +152,31 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_THROW(blobClient.Delete(), StorageException);
   }
 
+  TEST_F(AppendBlobClientTest, OutputStream_LIVEONLY_)
+  {
+    auto blobClient = GetAppendBlobClientForTest(RandomString());
+    blobClient.Create();
+
+    const auto blobContent = RandomBuffer(static_cast<size_t>(3_MB + 123));
+    Blobs::GetAppendBlobOutputStreamOptions options;
+    options.TransferOptions.BlockSize = 256_KB;
+    options.TransferOptions.Concurrency = 3;
+    auto outputStream = blobClient.GetOutputStream(options);
+    outputStream.Write(blobContent.data(), 1_KB);
+    outputStream.Flush();
+    EXPECT_EQ(blobClient.GetProperties().Value.BlobSize, static_cast<int64_t>(1_KB));
+    for (size_t offset = 1_KB; offset < blobContent.size(); offset += 100_KB)
+    {
+      outputStream.Write(
+          blobContent.data() + offset,
+          (std::min)(static_cast<size_t>(100_KB), blobContent.size() - offset));
+    }
+    outputStream.Close();
+
+    auto downloadResult = blobClient.Download();
+    EXPECT_EQ(ReadBodyStream(downloadResult.Value.BodyStream), blobContent);
+  }
+
   TEST_F(AppendBlobClientTest, AccessConditionLastModifiedTime)
   {
     auto blobClient = *m_appendBlobClient;
@@ -369,6 +369,136 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_EQ(listBlobs, startFromBlobs);
   }
 
+  TEST_F(BlobContainerClientTest, ListBlobsReader_LIVEONLY_)
+  {
+    auto containerClient = *m_blobContainerClient;
+    const std::string prefix = RandomString() + "-";
+
+    std::vector<std::string> blobNames;
+    for (int i = 0; i < 7; ++i)
+    {
+      std::string blobName = prefix + std::to_string(i);
+      auto blobClient = containerClient.GetBlockBlobClient(blobName);
+      Blobs::UploadBlockBlobOptions uploadOptions;
+      uploadOptions.Metadata["key"] = "value" + std::to_string(i);
+      auto content = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+      blobClient.Upload(content, uploadOptions);
+      blobNames.push_back(blobName);
+    }
+
+    Azure::Storage::Blobs::ListBlobsOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 3;
+    options.Include = Blobs::Models::ListBlobsIncludeFlags::Metadata;
+    std::vector<Blobs::Models::BlobItem> pagedBlobs;
+    for (auto pageResult = containerClient.ListBlobs(options); pageResult.HasPage();
+         pageResult.MoveToNextPage())
+    {
+      pagedBlobs.insert(pagedBlobs.end(), pageResult.Blobs.begin(), pageResult.Blobs.end());
+    }
+
+    auto reader = containerClient.GetListBlobsReader(options);
+    std::vector<Blobs::Models::BlobItem> readBlobs;
+    std::set<std::string> pageTokens;
+    Blobs::Models::BlobItem blob;
+    while (reader.ReadNext(blob))
+    {
+      readBlobs.push_back(blob);
+      pageTokens.insert(reader.CurrentPageToken);
+    }
+    EXPECT_FALSE(reader.ReadNext(blob));
+    EXPECT_EQ(pageTokens.size(), 3U);
+
+    ASSERT_EQ(readBlobs.size(), blobNames.size());
+    ASSERT_EQ(readBlobs.size(), pagedBlobs.size());
+    for (size_t i = 0; i < readBlobs.size(); ++i)
+    {
+      EXPECT_EQ(readBlobs[i].Name, blobNames[i]);
+      EXPECT_EQ(readBlobs[i].Name, pagedBlobs[i].Name);
+      EXPECT_EQ(readBlobs[i].Details.ETag, pagedBlobs[i].Details.ETag);
+      EXPECT_EQ(readBlobs[i].Details.Metadata, pagedBlobs[i].Details.Metadata);
+      EXPECT_EQ(readBlobs[i].BlobType, pagedBlobs[i].BlobType);
+    }
+  }
+
+  TEST_F(BlobContainerClientTest, ListBlobsConcurrently_LIVEONLY_)
+  {
+    auto containerClient = *m_blobContainerClient;
+    const std::string prefix = RandomString() + "-";
+
+    std::vector<std::string> blobNames;
+    for (const std::string directory : {"0", "A/", "a/", "a/b/", "z", "~"})
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        std::string blobName = prefix + directory + std::to_string(i);
+        auto blobClient = containerClient.GetBlockBlobClient(blobName);
+        auto content = Azure::Core::IO::MemoryBodyStream(nullptr, 0);
+        blobClient.Upload(content);
+        blobNames.push_back(blobName);
+      }
+    }
+    std::sort(blobNames.begin(), blobNames.end());
+
+    std::vector<Blobs::ListBlobsConcurrentlyOptions> optionsList;
+    {
+      Blobs::ListBlobsConcurrentlyOptions options;
+      options.Prefix = prefix;
+      options.PageSizeHint = 2;
+      optionsList.push_back(options);
+      options.Delimiter = "/";
+      optionsList.push_back(options);
+      // Unsorted, duplicated, and before the prefix.
+      options.PartitionBoundaries
+          = {prefix + "a/b", prefix + "A", prefix + "a/b", "", prefix + "~"};
+      optionsList.push_back(options);
+      options.Concurrency = 1;
+      optionsList.push_back(options);
+    }
+    for (auto options : optionsList)
+    {
+      for (bool preserveOrder : {false, true})
+      {
+        options.PreserveOrder = preserveOrder;
+        std::vector<std::string> listedNames;
+        containerClient.ListBlobsConcurrently(
+            [&](std::vector<Blobs::Models::BlobItem>& blobs) {
+              EXPECT_FALSE(blobs.empty());
+              for (const auto& blob : blobs)
+              {
+                listedNames.push_back(blob.Name);
+              }
+            },
+            options);
+        if (!preserveOrder)
+        {
+          std::sort(listedNames.begin(), listedNames.end());
+        }
+        EXPECT_EQ(listedNames, blobNames);
+      }
+    }
+
+    // The listing stops when the callback throws.
+    Blobs::ListBlobsConcurrentlyOptions options;
+    options.Prefix = prefix;
+    options.PageSizeHint = 1;
+    options.Concurrency = 8;
+    for (bool preserveOrder : {false, true})
+    {
+      options.PreserveOrder = preserveOrder;
+      int numCalls = 0;
+      EXPECT_THROW(
+          containerClient.ListBlobsConcurrently(
+              [&numCalls](std::vector<Blobs::Models::BlobItem>&) {
+                ++numCalls;
+                throw std::runtime_error("stop");
+              },
+              options),
+          std::runtime_error);
+      EXPECT_EQ(numCalls, 1);
+    }
+  }
+
   TEST_F(BlobContainerClientTest, ListBlobsByHierarchy)
   {
     auto containerClient = *m_blobContainerClient;
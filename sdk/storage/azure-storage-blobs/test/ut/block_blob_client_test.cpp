@@ -2038,6 +2038,246 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, MemoryMappedFileTransfer_LIVEONLY_)
+  {
+    const auto blobContent = RandomBuffer(static_cast<size_t>(3_MB + 123));
+    const std::string sourceFileName = RandomString();
+    const std::string destinationFileName = RandomString();
+    WriteFile(sourceFileName, blobContent);
+
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    for (int64_t singleUploadThreshold : {int64_t(0), int64_t(4_MB)})
+    {
+      Blobs::UploadBlockBlobFromOptions uploadOptions;
+      uploadOptions.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+      uploadOptions.TransferOptions.ChunkSize = 1_MB;
+      uploadOptions.TransferOptions.UseMemoryMappedFile = true;
+      blobClient.UploadFrom(sourceFileName, uploadOptions);
+
+      Blobs::DownloadBlobToOptions downloadOptions;
+      downloadOptions.TransferOptions.InitialChunkSize = 1_MB;
+      downloadOptions.TransferOptions.ChunkSize = 512_KB;
+      downloadOptions.TransferOptions.UseMemoryMappedFile = true;
+      auto downloadResult = blobClient.DownloadTo(destinationFileName, downloadOptions);
+      EXPECT_EQ(downloadResult.Value.BlobSize, static_cast<int64_t>(blobContent.size()));
+      EXPECT_EQ(ReadFile(destinationFileName), blobContent);
+
+      downloadOptions.Range = Core::Http::HttpRange();
+      downloadOptions.Range.Value().Offset = 1_MB + 7;
+      downloadOptions.Range.Value().Length = 1_MB;
+      blobClient.DownloadTo(destinationFileName, downloadOptions);
+      EXPECT_EQ(
+          ReadFile(destinationFileName),
+          std::vector<uint8_t>(
+              blobContent.begin() + static_cast<size_t>(1_MB + 7),
+              blobContent.begin() + static_cast<size_t>(2_MB + 7)));
+    }
+
+    WriteFile(sourceFileName, std::vector<uint8_t>());
+    Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.TransferOptions.UseMemoryMappedFile = true;
+    blobClient.UploadFrom(sourceFileName, uploadOptions);
+    Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.TransferOptions.UseMemoryMappedFile = true;
+    blobClient.DownloadTo(destinationFileName, downloadOptions);
+    EXPECT_TRUE(ReadFile(destinationFileName).empty());
+
+    DeleteFile(sourceFileName);
+    DeleteFile(destinationFileName);
+  }
+
+  TEST_F(BlockBlobClientTest, UploadFromStream_LIVEONLY_)
+  {
+    // A stream which can only be read once, and does not know its length.
+    class NonSeekableBodyStream final : public Azure::Core::IO::BodyStream {
+    public:
+      explicit NonSeekableBodyStream(const std::vector<uint8_t>& data) : m_data(data) {}
+      int64_t Length() const override { return -1; }
+
+    private:
+      size_t OnRead(uint8_t* buffer, size_t count, const Azure::Core::Context&) override
+      {
+        count = (std::min)({count, m_data.size() - m_offset, static_cast<size_t>(100_KB)});
+        std::copy(m_data.begin() + m_offset, m_data.begin() + m_offset + count, buffer);
+        m_offset += count;
+        return count;
+      }
+
+      const std::vector<uint8_t>& m_data;
+      size_t m_offset = 0;
+    };
+
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    auto bufferPool = std::make_shared<TransferBufferPool>(64_MB, 64_MB);
+    for (size_t size : {size_t(0), size_t(1_KB), size_t(1_MB), size_t(5_MB + 123)})
+    {
+      const auto blobContent = RandomBuffer(size);
+      Blobs::UploadBlockBlobFromOptions options;
+      options.TransferOptions.ChunkSize = 1_MB;
+      options.TransferOptions.Concurrency = 3;
+      options.TransferOptions.BufferPool = bufferPool;
+      options.Metadata = RandomMetadata();
+      NonSeekableBodyStream content(blobContent);
+      blobClient.UploadFrom(content, options);
+
+      auto downloadResult = blobClient.Download();
+      EXPECT_EQ(ReadBodyStream(downloadResult.Value.BodyStream), blobContent);
+      EXPECT_EQ(downloadResult.Value.Details.Metadata, options.Metadata);
+    }
+    // At most one block per worker is held at once.
+    EXPECT_LE(bufferPool->GetStatistics().PeakBytesInUse, 3_MB);
+    EXPECT_EQ(bufferPool->GetStatistics().BytesInUse, 0U);
+  }
+
+  TEST_F(BlockBlobClientTest, UploadFromWithTransactionalHash_LIVEONLY_)
+  {
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    const auto blobContent = RandomBuffer(static_cast<size_t>(3_MB + 123));
+    const std::string tempFileName = RandomString();
+    WriteFile(tempFileName, blobContent);
+    for (auto hashAlgorithm : {HashAlgorithm::Md5, HashAlgorithm::Crc64})
+    {
+      for (bool useMemoryMappedFile : {false, true})
+      {
+        for (int64_t singleUploadThreshold : {int64_t(0), int64_t(64_MB)})
+        {
+          Blobs::UploadBlockBlobFromOptions options;
+          options.TransferOptions.ChunkSize = 1_MB;
+          options.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+          options.TransferOptions.UseMemoryMappedFile = useMemoryMappedFile;
+          options.TransferOptions.TransactionalHashAlgorithm = hashAlgorithm;
+          blobClient.UploadFrom(tempFileName, options);
+          EXPECT_EQ(ReadBodyStream(blobClient.Download().Value.BodyStream), blobContent);
+          blobClient.UploadFrom(blobContent.data(), blobContent.size(), options);
+          EXPECT_EQ(ReadBodyStream(blobClient.Download().Value.BodyStream), blobContent);
+        }
+      }
+    }
+    DeleteFile(tempFileName);
+  }
+
+  TEST_F(BlockBlobClientTest, OutputStream_LIVEONLY_)
+  {
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    auto bufferPool = std::make_shared<TransferBufferPool>(64_MB, 64_MB);
+    for (size_t size : {size_t(0), size_t(1_KB), size_t(1_MB), size_t(5_MB + 123)})
+    {
+      const auto blobContent = RandomBuffer(size);
+      Blobs::GetBlockBlobOutputStreamOptions options;
+      options.TransferOptions.BlockSize = 1_MB;
+      options.TransferOptions.Concurrency = 2;
+      options.TransferOptions.BufferPool = bufferPool;
+      options.Metadata = RandomMetadata();
+      auto outputStream = blobClient.GetOutputStream(options);
+      for (size_t offset = 0; offset < size; offset += 100_KB)
+      {
+        outputStream.Write(
+            blobContent.data() + offset, (std::min)(static_cast<size_t>(100_KB), size - offset));
+      }
+      outputStream.Close();
+      outputStream.Close();
+      EXPECT_THROW(outputStream.Write(blobContent.data(), 0), std::runtime_error);
+
+      auto downloadResult = blobClient.Download();
+      EXPECT_EQ(ReadBodyStream(downloadResult.Value.BodyStream), blobContent);
+      EXPECT_EQ(downloadResult.Value.Details.Metadata, options.Metadata);
+    }
+    // The block being written, and up to three times Concurrency blocks being staged or waiting.
+    EXPECT_LE(bufferPool->GetStatistics().PeakBytesInUse, 7_MB);
+    EXPECT_EQ(bufferPool->GetStatistics().BytesInUse, 0U);
+
+    // Flushing commits the blocks written so far.
+    const auto blobContent = RandomBuffer(3_MB);
+    Blobs::GetBlockBlobOutputStreamOptions options;
+    options.TransferOptions.BlockSize = 1_MB;
+    {
+      auto outputStream = blobClient.GetOutputStream(options);
+      outputStream.Write(blobContent.data(), 1_MB + 1);
+      outputStream.Flush();
+      auto downloadResult = blobClient.Download();
+      EXPECT_EQ(
+          ReadBodyStream(downloadResult.Value.BodyStream),
+          std::vector<uint8_t>(blobContent.begin(), blobContent.begin() + 1_MB + 1));
+
+      // The blocks of a stream which is not closed are not committed.
+      outputStream.Write(blobContent.data() + 1_MB + 1, blobContent.size() - 1_MB - 1);
+    }
+    EXPECT_EQ(blobClient.GetProperties().Value.BlobSize, static_cast<int64_t>(1_MB + 1));
+  }
+
+  TEST_F(BlockBlobClientTest, InputStream_LIVEONLY_)
+  {
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    auto bufferPool = std::make_shared<TransferBufferPool>(64_MB, 64_MB);
+    for (size_t size : {size_t(0), size_t(1_KB), size_t(3_MB + 123)})
+    {
+      const auto blobContent = RandomBuffer(size);
+      blobClient.UploadFrom(blobContent.data(), blobContent.size());
+
+      Blobs::GetBlobInputStreamOptions options;
+      options.TransferOptions.BlockSize = 256_KB;
+      options.TransferOptions.Concurrency = 3;
+      options.TransferOptions.MaxCachedBlocks = 4;
+      options.TransferOptions.BufferPool = bufferPool;
+      auto inputStream = blobClient.GetInputStream(options);
+      EXPECT_EQ(inputStream.Length(), static_cast<int64_t>(size));
+      EXPECT_EQ(inputStream.ReadToEnd(), blobContent);
+      EXPECT_EQ(inputStream.GetPosition(), static_cast<int64_t>(size));
+
+      // Reads backward, across blocks.
+      const size_t readLength = 100_KB;
+      for (size_t offset = size; offset != 0;)
+      {
+        const size_t length = (std::min)(offset, readLength);
+        offset -= length;
+        inputStream.Seek(static_cast<int64_t>(offset));
+        std::vector<uint8_t> buffer(length);
+        EXPECT_EQ(inputStream.ReadToCount(buffer.data(), buffer.size()), length);
+        EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), blobContent.begin() + offset));
+      }
+      EXPECT_THROW(inputStream.Seek(static_cast<int64_t>(size) + 1), std::out_of_range);
+    }
+    EXPECT_EQ(bufferPool->GetStatistics().BytesInUse, 0U);
+
+    // The stream reads the version of the blob it was opened on.
+    auto inputStream = blobClient.GetInputStream();
+    blobClient.UploadFrom(RandomBuffer(1_KB).data(), 1_KB);
+    EXPECT_THROW(inputStream.ReadToEnd(), StorageException);
+  }
+
+  TEST_F(BlockBlobClientTest, InputStreamSmallBufferPool_LIVEONLY_)
+  {
+    auto blobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    const auto blobContent = RandomBuffer(1_MB);
+    blobClient.UploadFrom(blobContent.data(), blobContent.size());
+
+    // The budget of the pool only fits the blocks downloaded by a single stream at once.
+    auto bufferPool = std::make_shared<TransferBufferPool>(512_KB, 0);
+    Blobs::GetBlobInputStreamOptions options;
+    options.TransferOptions.BlockSize = 256_KB;
+    options.TransferOptions.Concurrency = 2;
+    options.TransferOptions.MaxCachedBlocks = 4;
+    options.TransferOptions.BufferPool = bufferPool;
+    std::vector<Blobs::BlobInputStream> inputStreams;
+    for (int i = 0; i < 4; ++i)
+    {
+      inputStreams.push_back(blobClient.GetInputStream(options));
+      EXPECT_EQ(inputStreams.back().ReadToEnd(), blobContent);
+    }
+
+    // The cached blocks of the open streams do not hold buffers of the pool.
+    EXPECT_EQ(bufferPool->GetStatistics().BytesInUse, 0U);
+    auto buffer = bufferPool->Acquire(512_KB);
+    EXPECT_EQ(buffer.GetSize(), 512_KB);
+    for (auto& inputStream : inputStreams)
+    {
+      inputStream.Seek(0);
+      std::vector<uint8_t> data(100_KB);
+      EXPECT_EQ(inputStream.ReadToCount(data.data(), data.size()), data.size());
+      EXPECT_TRUE(std::equal(data.begin(), data.end(), blobContent.begin()));
+    }
+  }
+
   TEST_F(BlockBlobClientTest, MaxUploadBlockSize)
   {
 #ifdef _WIN64
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "azure/storage/common/storage_common.hpp"
+
 #include <azure/core/base64.hpp>
 #include <azure/core/cryptography/hash.hpp>
 
@@ -37,10 +39,59 @@ namespace Azure { namespace Storage {
     std::vector<uint8_t> OnFinal(const uint8_t* data, size_t length) override;
   };
 
+  namespace _detail {
+    /**
+     * @brief The implementations of the CRC64 computation.
+     *
+     */
+    enum class Crc64Implementation
+    {
+      // Slice-by-32 lookup tables, supported everywhere.
+      LookupTable,
+      // 128-bit carry-less multiplications: PCLMULQDQ on x86-64, PMULL on ARMv8.
+      CarrylessMultiply,
+      // 512-bit carry-less multiplications: VPCLMULQDQ and AVX-512 on x86-64.
+      VectorCarrylessMultiply,
+    };
+
+    /**
+     * @brief Checks whether the build and the CPU support \p implementation.
+     *
+     */
+    bool IsCrc64ImplementationSupported(Crc64Implementation implementation);
+
+    /**
+     * @brief Appends \p data to the CRC64 \p crc with \p implementation, which must be supported.
+     *
+     * @remark #Azure::Storage::Crc64Hash uses the fastest supported implementation.
+     *
+     * @return The CRC64 of the data appended so far.
+     */
+    uint64_t Crc64Append(
+        uint64_t crc,
+        const uint8_t* data,
+        size_t length,
+        Crc64Implementation implementation);
+  } // namespace _detail
+
   namespace _internal {
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key);
+
+    /**
+     * @brief Computes the MD5 hash of \p data, reusing one hash context per thread.
+     *
+     */
+    std::vector<uint8_t> Md5(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Computes the hash of \p data with \p algorithm, to be sent as the transactional hash
+     * of a chunk.
+     *
+     */
+    ContentHash ComputeContentHash(const uint8_t* data, size_t length, HashAlgorithm algorithm);
+
     std::string UrlEncodeQueryParameter(const std::string& value);
     std::string UrlEncodePath(const std::string& value);
   } // namespace _internal
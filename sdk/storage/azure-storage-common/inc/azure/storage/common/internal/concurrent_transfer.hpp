@@ -3,66 +3,222 @@
 
 #pragma once
 
+#include "azure/storage/common/transfer_executor.hpp"
+
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <exception>
 #include <functional>
-#include <future>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
+  // Bounds of the chunk size of the transfers tuned by #TransferTuner, unless the transfer starts
+  // outside of them.
+  constexpr int64_t MinAdaptiveChunkSize = 1 * 1024 * 1024;
+  constexpr int64_t MaxAdaptiveChunkSize = 256 * 1024 * 1024;
+
+  /**
+   * @brief Transfers the chunks of a range from the calling thread, and from up to
+   * `concurrency - 1` tasks run by \p executor.
+   *
+   * @remark The calling thread only waits for the tasks that were started by \p executor, so the
+   * transfer does not block when the executor is busy, or when it is called from a task of the
+   * executor.
+   *
+   * @param executor The executor running the tasks. If null, the default executor, shared by the
+   * whole process, is used.
+   */
   inline void ConcurrentTransfer(
       int64_t offset,
       int64_t length,
       int64_t chunkSize,
       int concurrency,
       // offset, length, chunk ID, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<TransferExecutor> executor)
   {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
+    // Outlives the call, since the executor might run the tasks later.
+    struct TransferState final
+    {
+      std::atomic<int64_t> NextChunkId{0};
+      std::atomic<bool> Failed{false};
+
+      std::mutex Mutex;
+      std::condition_variable TaskCompleted;
+      int NumWorkingTasks = 0;
+      // Set once the calling thread is done with the chunks. The tasks starting afterwards return
+      // right away.
+      bool Closed = false;
+      std::exception_ptr Error;
+    };
+    auto state = std::make_shared<TransferState>();
 
     const auto numChunks = (length + chunkSize - 1) / chunkSize;
 
-    auto threadFunc = [&]() {
-      while (true)
+    // transferFunc is owned by the calling thread, which waits for the tasks using it.
+    auto transferChunks
+        = [&transferFunc, offset, length, chunkSize, numChunks](TransferState& transferState) {
+          while (true)
+          {
+            int64_t chunkId = transferState.NextChunkId.fetch_add(1);
+            if (chunkId >= numChunks || transferState.Failed)
+            {
+              break;
+            }
+            int64_t chunkOffset = offset + chunkSize * chunkId;
+            int64_t chunkLength = (std::min)(length - chunkSize * chunkId, chunkSize);
+            try
+            {
+              transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+            }
+            catch (...)
+            {
+              std::lock_guard<std::mutex> lock(transferState.Mutex);
+              if (!transferState.Failed.exchange(true))
+              {
+                transferState.Error = std::current_exception();
+              }
+              break;
+            }
+          }
+        };
+
+    if (!executor)
+    {
+      executor = WorkStealingTransferExecutor::GetDefault();
+    }
+    try
+    {
+      for (int i = 0; i < std::min<int64_t>(concurrency, numChunks) - 1; ++i)
       {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
-        {
-          break;
-        }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = (std::min)(length - chunkSize * chunkId, chunkSize);
-        try
-        {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
-        }
-        catch (const std::exception&)
-        {
-          if (failed.exchange(true) == false)
+        executor->Submit([state, transferChunks]() {
           {
-            numWorkingThreads.fetch_sub(1);
-            throw;
+            std::lock_guard<std::mutex> lock(state->Mutex);
+            if (state->Closed)
+            {
+              return;
+            }
+            ++state->NumWorkingTasks;
           }
-        }
+          transferChunks(*state);
+          {
+            std::lock_guard<std::mutex> lock(state->Mutex);
+            --state->NumWorkingTasks;
+          }
+          state->TaskCompleted.notify_all();
+        });
       }
-      numWorkingThreads.fetch_sub(1);
-    };
-
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < std::min<int64_t>(concurrency, numChunks) - 1; ++i)
+    }
+    catch (const std::exception&)
     {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
+      // The chunks not taken by a task are transferred by the calling thread.
     }
-    threadFunc();
-    for (auto& handle : threadHandles)
+    transferChunks(*state);
+
+    std::unique_lock<std::mutex> lock(state->Mutex);
+    state->Closed = true;
+    state->TaskCompleted.wait(lock, [&state]() { return state->NumWorkingTasks == 0; });
+    if (state->Error)
     {
-      handle.get();
+      std::rethrow_exception(state->Error);
     }
   }
 
+  /**
+   * @brief Adjusts the chunk size and the concurrency of a transfer to the throughput and the
+   * latency measured on the chunks transferred so far.
+   *
+   * @details The chunk size doubles while the chunks take less than a second to transfer, so that
+   * the round trip of each request is amortized, and halves when they take more than 4 seconds.
+   *
+   * The concurrency is adjusted after each round of chunks, like the TCP congestion window: it
+   * starts at 1 and doubles while the throughput of a round improves by 10%. Then it grows by one
+   * while the throughput keeps improving by 5%, and drops by a quarter when the throughput drops by
+   * 20%.
+   */
+  class TransferTuner final {
+  public:
+    /**
+     * @brief Constructs a `%TransferTuner`.
+     *
+     * @param initialChunkSize The size of the first chunks.
+     * @param minChunkSize The minimum chunk size.
+     * @param maxChunkSize The maximum chunk size.
+     * @param maxConcurrency The maximum number of chunks transferred at once.
+     */
+    TransferTuner(
+        int64_t initialChunkSize,
+        int64_t minChunkSize,
+        int64_t maxChunkSize,
+        int maxConcurrency);
+
+    /**
+     * @brief The size of the next chunks.
+     *
+     */
+    int64_t GetChunkSize() const { return m_chunkSize; }
+
+    /**
+     * @brief The number of chunks to transfer at once.
+     *
+     */
+    int GetConcurrency() const { return m_concurrency; }
+
+    /**
+     * @brief Registers a chunk transferred successfully.
+     *
+     * @param length The size of the chunk.
+     * @param startedOn When the transfer of the chunk started.
+     * @param completedOn When the transfer of the chunk completed.
+     */
+    void OnChunkTransferred(
+        int64_t length,
+        std::chrono::steady_clock::time_point startedOn,
+        std::chrono::steady_clock::time_point completedOn);
+
+  private:
+    int64_t m_chunkSize;
+    int64_t m_minChunkSize;
+    int64_t m_maxChunkSize;
+    int m_concurrency = 1;
+    int m_previousConcurrency = 1;
+    int m_maxConcurrency;
+    bool m_slowStart = true;
+    double m_bestThroughput = 0;
+
+    // The current round ends once as many chunks as the concurrency are transferred.
+    bool m_roundStarted = false;
+    std::chrono::steady_clock::time_point m_roundStartedOn;
+    int m_roundChunks = 0;
+    int64_t m_roundBytes = 0;
+  };
+
+  /**
+   * @brief Transfers the chunks of a range like #ConcurrentTransfer, with the chunk size and the
+   * concurrency adjusted during the transfer by a #TransferTuner.
+   *
+   * @remark Since the number of chunks is not known upfront, \p transferFunc gets -1 as the number
+   * of chunks, except for the last chunk, which gets the actual number of chunks.
+   *
+   * @param executor The executor running the tasks. If null, the default executor, shared by the
+   * whole process, is used.
+   */
+  void AdaptiveConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t initialChunkSize,
+      int64_t minChunkSize,
+      int64_t maxChunkSize,
+      int maxConcurrency,
+      // offset, length, chunk ID, number of chunks
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<TransferExecutor> executor);
+
 }}} // namespace Azure::Storage::_internal
@@ -45,4 +45,65 @@ namespace Azure { namespace Storage { namespace _internal {
     FileHandle m_handle;
   };
 
+  /**
+   * @brief A file mapped read-only into memory, so its content can be sent without being read into
+   * intermediate buffers.
+   */
+  class MappedFileReader final {
+  public:
+    explicit MappedFileReader(const std::string& filename);
+
+    MappedFileReader(const MappedFileReader&) = delete;
+    MappedFileReader& operator=(const MappedFileReader&) = delete;
+
+    ~MappedFileReader();
+
+    /**
+     * @brief Gets the content of the file, or null if the file is empty.
+     */
+    const uint8_t* GetData() const { return m_data; }
+
+    int64_t GetFileSize() const { return m_fileSize; }
+
+  private:
+    FileHandle m_handle;
+#if defined(AZ_PLATFORM_WINDOWS)
+    void* m_mappingHandle = nullptr;
+#endif
+    uint8_t* m_data = nullptr;
+    int64_t m_fileSize;
+  };
+
+  /**
+   * @brief A file created with a fixed size and mapped into memory, so data can be received
+   * straight into it.
+   *
+   * @remark The disk space is reserved upfront where the platform supports it. Other I/O errors on
+   * the mapped pages cannot be reported as exceptions.
+   */
+  class MappedFileWriter final {
+  public:
+    MappedFileWriter(const std::string& filename, int64_t fileSize);
+
+    MappedFileWriter(const MappedFileWriter&) = delete;
+    MappedFileWriter& operator=(const MappedFileWriter&) = delete;
+
+    ~MappedFileWriter();
+
+    /**
+     * @brief Gets the content of the file, or null if the file is empty.
+     */
+    uint8_t* GetData() const { return m_data; }
+
+    int64_t GetFileSize() const { return m_fileSize; }
+
+  private:
+    FileHandle m_handle;
+#if defined(AZ_PLATFORM_WINDOWS)
+    void* m_mappingHandle = nullptr;
+#endif
+    uint8_t* m_data = nullptr;
+    int64_t m_fileSize;
+  };
+
 }}} // namespace Azure::Storage::_internal
@@ -50,6 +50,8 @@ namespace Azure { namespace Storage { namespace _internal {
     int64_t m_retryOffset;
 
     size_t OnRead(uint8_t* buffer, size_t count, Azure::Core::Context const& context) override;
+    Azure::Core::IO::BodyStreamView OnReadView(size_t count, Azure::Core::Context const& context)
+        override;
 
   public:
     explicit ReliableStream(
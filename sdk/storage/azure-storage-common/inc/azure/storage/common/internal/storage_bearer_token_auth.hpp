@@ -28,6 +28,7 @@ namespace Azure { namespace Storage { namespace _internal {
           m_scopes(tokenRequestContext.Scopes), m_safeTenantId(tokenRequestContext.TenantId),
           m_enableTenantDiscovery(enableTenantDiscovery)
     {
+      EnableAsyncAuthorization();
     }
 
     ~StorageBearerTokenAuthenticationPolicy() override {}
@@ -66,10 +67,8 @@ namespace Azure { namespace Storage { namespace _internal {
     mutable SafeTenantId m_safeTenantId;
     bool m_enableTenantDiscovery;
 
-    std::unique_ptr<Azure::Core::Http::RawResponse> AuthorizeAndSendRequest(
-        Azure::Core::Http::Request& request,
-        Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
-        Azure::Core::Context const& context) const override;
+    void AuthorizeRequest(Azure::Core::Http::Request& request, Azure::Core::Context const& context)
+        const override;
 
     bool AuthorizeRequestOnChallenge(
         std::string const& challenge,
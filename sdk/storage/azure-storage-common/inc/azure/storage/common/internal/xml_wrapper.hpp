@@ -3,9 +3,18 @@
 
 #pragma once
 
+#include <azure/core/context.hpp>
+#include <azure/core/io/body_stream.hpp>
+
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <initializer_list>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
@@ -52,6 +61,241 @@ namespace Azure { namespace Storage { namespace _internal {
     std::unique_ptr<XmlReaderContext> m_context;
   };
 
+  /**
+   * @brief A string in the buffer parsed by an #XmlPullReader, which does not own it.
+   *
+   */
+  struct XmlStringView final
+  {
+    const char* Data = nullptr;
+    size_t Length = 0;
+
+    operator std::string() const { return std::string(Data, Length); }
+  };
+
+  inline bool operator==(const XmlStringView& lhs, const std::string& rhs)
+  {
+    return lhs.Length == rhs.length() && std::memcmp(lhs.Data, rhs.data(), lhs.Length) == 0;
+  }
+
+  inline bool operator==(const XmlStringView& lhs, const char* rhs)
+  {
+    return lhs.Length == std::strlen(rhs) && std::memcmp(lhs.Data, rhs, lhs.Length) == 0;
+  }
+
+  struct XmlNodeView final
+  {
+    XmlNodeType Type;
+    XmlStringView Name;
+    XmlStringView Value;
+  };
+
+  /**
+   * @brief Reads the nodes of an XML document without allocating memory for them, unlike
+   * #XmlReader. The names and values point into the document.
+   *
+   * @remark The entity references and the line breaks are decoded in place, so the document is
+   * modified, and must outlive the nodes. It handles the XML returned by the services: elements,
+   * attributes, text, CDATA sections, comments and processing instructions, but not DTDs.
+   * Whitespace is only reported as text when it is the whole content of an element.
+   *
+   * @remark A reader constructed from a body stream reads the document as it needs it, into a
+   * buffer reused for the whole document. The nodes then point into that buffer, and are only
+   * valid until the next call to #Read.
+   */
+  class XmlPullReader final {
+  public:
+    explicit XmlPullReader(char* data, size_t length);
+    explicit XmlPullReader(Core::IO::BodyStream& stream);
+
+    /**
+     * @brief Reads the next node of a document given as a buffer.
+     *
+     */
+    XmlNodeView Read();
+
+    /**
+     * @brief Reads the next node, reading more of the body stream if needed.
+     *
+     */
+    XmlNodeView Read(const Core::Context& context);
+
+  private:
+    // Thrown when the node being read continues past the data read from the body stream.
+    struct EndOfData final
+    {
+    };
+
+    XmlNodeView ReadNode();
+    XmlStringView ReadName();
+    XmlNodeView ReadInStartTag();
+    XmlNodeView ReadEndTag();
+    // Skips up to and including the next occurrence of terminator.
+    const char* SkipPast(const char* terminator);
+    // Throws EndOfData if more of the document can be read from the body stream, or a parse error.
+    [[noreturn]] void OnEndOfData() const;
+    // Moves the data not read yet to the beginning of the buffer, and reads more after it.
+    void Fill(const Core::Context& context);
+    // Decodes the entity references and the line breaks of [begin, end), and returns the end of the
+    // decoded string.
+    static char* Decode(char* begin, char* end, bool isAttribute);
+
+    char* m_position;
+    char* m_end;
+    Core::IO::BodyStream* m_stream = nullptr;
+    std::vector<char> m_buffer;
+    // Set once the whole document is in [m_position, m_end).
+    bool m_isComplete = true;
+    bool m_bomSkipped = false;
+    // The names of the open elements, back to back. They are copied, since the stream buffer is
+    // overwritten.
+    std::string m_openTagNames;
+    std::vector<size_t> m_openTagLengths;
+    bool m_inStartTag = false;
+    bool m_afterStartTag = false;
+    bool m_rootRead = false;
+  };
+
+  /**
+   * @brief Maps the tag names of an XML document to values, using a perfect hash table built once
+   * from the list of names.
+   *
+   * @tparam T The type of the values, whose default value is returned for the unknown names.
+   */
+  template <class T> class XmlTagMap final {
+  public:
+    XmlTagMap(std::initializer_list<std::pair<const char*, T>> tags)
+    {
+      // Grows the table until all the buckets find a displacement.
+      for (size_t tableSize = 2; !TryBuild(tags, tableSize); tableSize *= 2)
+      {
+        if (tableSize > (size_t(1) << 20))
+        {
+          throw std::logic_error("Duplicate XML tag names.");
+        }
+      }
+    }
+
+    T Find(const char* name, size_t length) const
+    {
+      const uint32_t hash = HashName(name, length);
+      const uint32_t displacement = m_displacements[Mix(hash, 0) & (m_displacements.size() - 1)];
+      const Entry& entry = m_entries[Mix(hash, displacement) & (m_entries.size() - 1)];
+      if (entry.Name != nullptr && entry.Length == length
+          && std::memcmp(entry.Name, name, length) == 0)
+      {
+        return entry.Value;
+      }
+      return T();
+    }
+
+    T Find(const XmlStringView& name) const { return Find(name.Data, name.Length); }
+    T Find(const std::string& name) const { return Find(name.data(), name.length()); }
+
+  private:
+    struct Entry final
+    {
+      const char* Name = nullptr;
+      size_t Length = 0;
+      T Value = T();
+    };
+
+    static uint32_t HashName(const char* name, size_t length)
+    {
+      uint32_t hash = 2166136261U;
+      for (size_t i = 0; i < length; ++i)
+      {
+        hash = (hash ^ static_cast<uint8_t>(name[i])) * 16777619U;
+      }
+      return hash;
+    }
+
+    static uint32_t Mix(uint32_t hash, uint32_t seed)
+    {
+      hash ^= seed * 0x9E3779B9U;
+      hash ^= hash >> 16;
+      hash *= 0x85EBCA6BU;
+      hash ^= hash >> 13;
+      hash *= 0xC2B2AE35U;
+      hash ^= hash >> 16;
+      return hash;
+    }
+
+    // Hash and displace: the names are grouped in buckets, and the names of each bucket are placed
+    // with the first seed that sends them all to free entries, starting with the largest buckets.
+    bool TryBuild(std::initializer_list<std::pair<const char*, T>> tags, size_t tableSize)
+    {
+      if (tableSize < tags.size() * 2)
+      {
+        return false;
+      }
+      const size_t numBuckets = (std::max)(tableSize / 4, size_t(1));
+      std::vector<std::vector<const std::pair<const char*, T>*>> buckets(numBuckets);
+      for (const auto& tag : tags)
+      {
+        buckets[Mix(HashName(tag.first, std::strlen(tag.first)), 0) & (numBuckets - 1)].push_back(
+            &tag);
+      }
+      std::vector<size_t> order(numBuckets);
+      for (size_t i = 0; i < numBuckets; ++i)
+      {
+        order[i] = i;
+      }
+      std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return buckets[lhs].size() > buckets[rhs].size();
+      });
+
+      m_entries.assign(tableSize, Entry());
+      m_displacements.assign(numBuckets, 0);
+      std::vector<size_t> slots;
+      for (size_t bucketIndex : order)
+      {
+        const auto& bucket = buckets[bucketIndex];
+        if (bucket.empty())
+        {
+          break;
+        }
+        bool placed = false;
+        for (uint32_t displacement = 1; displacement < 1024 && !placed; ++displacement)
+        {
+          slots.clear();
+          placed = true;
+          for (const auto* tag : bucket)
+          {
+            const size_t slot = Mix(HashName(tag->first, std::strlen(tag->first)), displacement)
+                & (tableSize - 1);
+            if (m_entries[slot].Name != nullptr
+                || std::find(slots.begin(), slots.end(), slot) != slots.end())
+            {
+              placed = false;
+              break;
+            }
+            slots.push_back(slot);
+          }
+          if (placed)
+          {
+            m_displacements[bucketIndex] = displacement;
+            for (size_t i = 0; i < bucket.size(); ++i)
+            {
+              Entry& entry = m_entries[slots[i]];
+              entry.Name = bucket[i]->first;
+              entry.Length = std::strlen(bucket[i]->first);
+              entry.Value = bucket[i]->second;
+            }
+          }
+        }
+        if (!placed)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::vector<Entry> m_entries;
+    std::vector<uint32_t> m_displacements;
+  };
+
   class XmlWriter final {
   public:
     explicit XmlWriter();
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Pool of the buffers holding the chunks of the concurrent upload and download operations.
+ */
+
+#pragma once
+
+#include <azure/core/context.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief Lends the buffers holding the chunks of the concurrent upload and download operations,
+   * and keeps them once they are returned, so that the next chunks, of the same or of other
+   * operations, reuse them instead of allocating new ones.
+   *
+   * @remark The buffers are grouped in size classes, four per power of two, so that a buffer can be
+   * reused for chunks of a slightly different size. The memory held by the pool, lent and idle,
+   * stays within a budget: a request that would exceed it waits until enough buffers are returned.
+   * A request larger than the budget is only served when no other buffer is lent.
+   */
+  class TransferBufferPool final {
+  private:
+    struct SharedState;
+
+  public:
+    /**
+     * @brief A buffer lent by a #Azure::Storage::TransferBufferPool, which is returned to the pool
+     * when it is destroyed.
+     */
+    class Buffer final {
+    public:
+      /**
+       * @brief Constructs an empty `%Buffer`.
+       *
+       */
+      Buffer() = default;
+
+      Buffer(Buffer&& other) noexcept = default;
+      Buffer& operator=(Buffer&& other) noexcept;
+
+      /**
+       * @brief Returns the buffer to its pool.
+       *
+       */
+      ~Buffer();
+
+      /**
+       * @brief Gets the first byte of the buffer, or null if the buffer is empty.
+       *
+       */
+      uint8_t* GetData() const { return m_data.get(); }
+
+      /**
+       * @brief Gets the number of bytes requested for the buffer.
+       *
+       */
+      size_t GetSize() const { return m_size; }
+
+    private:
+      friend class TransferBufferPool;
+
+      void Release();
+
+      std::shared_ptr<SharedState> m_state;
+      std::unique_ptr<uint8_t[]> m_data;
+      size_t m_size = 0;
+      // The size of the size class, which is the number of bytes allocated.
+      size_t m_capacity = 0;
+    };
+
+    /**
+     * @brief Memory usage of a #Azure::Storage::TransferBufferPool.
+     */
+    struct Statistics final
+    {
+      /**
+       * @brief Number of bytes of the buffers currently lent.
+       */
+      size_t BytesInUse = 0;
+
+      /**
+       * @brief Number of bytes of the buffers kept for reuse.
+       */
+      size_t BytesIdle = 0;
+
+      /**
+       * @brief The highest number of bytes lent at once.
+       */
+      size_t PeakBytesInUse = 0;
+
+      /**
+       * @brief The highest number of bytes held at once, lent and idle.
+       */
+      size_t PeakBytesAllocated = 0;
+
+      /**
+       * @brief Number of buffers allocated.
+       */
+      uint64_t AllocationCount = 0;
+
+      /**
+       * @brief Number of buffers lent again after being returned.
+       */
+      uint64_t ReuseCount = 0;
+
+      /**
+       * @brief Number of requests which waited for buffers to be returned, because the budget was
+       * reached.
+       */
+      uint64_t WaitCount = 0;
+    };
+
+    /**
+     * @brief Constructs a `%TransferBufferPool`.
+     *
+     * @param memoryBudget The maximum number of bytes held by the pool, lent and idle.
+     * @param maxIdleBytes The maximum number of bytes kept for reuse once returned.
+     */
+    TransferBufferPool(size_t memoryBudget, size_t maxIdleBytes);
+
+    TransferBufferPool(const TransferBufferPool&) = delete;
+    TransferBufferPool& operator=(const TransferBufferPool&) = delete;
+
+    /**
+     * @brief Frees the idle buffers. The lent ones are freed when they are returned.
+     *
+     */
+    ~TransferBufferPool();
+
+    /**
+     * @brief Lends a buffer of at least \p size bytes, waiting for other buffers to be returned if
+     * the budget would be exceeded.
+     *
+     * @remark The content of the buffer is unspecified.
+     *
+     * @param size The number of bytes needed.
+     * @param context Context for cancelling the wait for other buffers to be returned.
+     * @return The buffer, which is returned to the pool when it is destroyed.
+     * @throw Azure::Core::OperationCancelledException if \p context is cancelled while waiting.
+     */
+    Buffer Acquire(size_t size, const Azure::Core::Context& context = Azure::Core::Context());
+
+    /**
+     * @brief Gets the memory usage of the pool.
+     *
+     */
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Gets the pool shared by the upload and download operations that are not given one.
+     *
+     * @remark Its budget is 1 GiB, and it keeps up to 64 MiB of idle buffers.
+     */
+    static std::shared_ptr<TransferBufferPool> GetDefault();
+
+  private:
+    std::shared_ptr<SharedState> m_state;
+  };
+
+}} // namespace Azure::Storage
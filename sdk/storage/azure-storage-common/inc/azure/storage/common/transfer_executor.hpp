@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Executors running the chunks of the concurrent upload and download operations.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage {
+
+  /**
+   * @brief Runs the chunk transfers of the concurrent upload and download operations, such as
+   * `BlobClient::DownloadTo` or `ShareFileClient::UploadFrom`.
+   *
+   * @remark The thread calling the operation transfers chunks too, and only waits for the tasks
+   * that were started by the executor. The executor may delay or drop a task without blocking the
+   * operation.
+   */
+  class TransferExecutor {
+  public:
+    /**
+     * @brief Destructs `%TransferExecutor`.
+     *
+     */
+    virtual ~TransferExecutor() = default;
+
+    /**
+     * @brief Schedules \p task to run on a thread of the executor.
+     *
+     * @remark Must not wait for \p task to run. \p task does not throw.
+     *
+     * @param task The task to run.
+     */
+    virtual void Submit(std::function<void()> task) = 0;
+
+  protected:
+    TransferExecutor() = default;
+    TransferExecutor(TransferExecutor const&) = default;
+    TransferExecutor& operator=(TransferExecutor const&) = default;
+  };
+
+  /**
+   * @brief A #Azure::Storage::TransferExecutor running the tasks on a bounded number of threads,
+   * which take the tasks queued by the other threads when they run out of tasks.
+   *
+   * @remark The threads are started on demand, when a task is submitted and all of them are busy.
+   * Pending tasks are dropped when the executor is destroyed. It can be destroyed by one of its
+   * tasks, such as a task holding the last reference to it.
+   */
+  class WorkStealingTransferExecutor final : public TransferExecutor {
+  public:
+    /**
+     * @brief Constructs a `%WorkStealingTransferExecutor`.
+     *
+     * @param maxThreads The maximum number of threads running tasks. Values smaller than 1 are
+     * raised to 1.
+     */
+    explicit WorkStealingTransferExecutor(size_t maxThreads);
+
+    /**
+     * @brief Stops the threads once they are done with their current task.
+     *
+     */
+    ~WorkStealingTransferExecutor() override;
+
+    void Submit(std::function<void()> task) override;
+
+    /**
+     * @brief Gets the executor shared by the upload and download operations that are not given
+     * one.
+     *
+     * @remark It runs up to 64 tasks at once in the process.
+     */
+    static std::shared_ptr<WorkStealingTransferExecutor> GetDefault();
+
+  private:
+    struct Worker final
+    {
+      std::mutex Mutex;
+      std::deque<std::function<void()>> Tasks;
+      std::thread Thread;
+    };
+
+    void Run(size_t workerIndex);
+    // Takes a task from the queue of the worker, or from the other queues.
+    bool TryTakeTask(size_t workerIndex, std::function<void()>& task);
+
+    // The queues are allocated upfront, so that they can be accessed without holding m_mutex.
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<size_t> m_numWorkers{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_tasksChanged;
+    size_t m_pendingTasks = 0;
+    size_t m_idleWorkers = 0;
+    size_t m_nextQueue = 0;
+    bool m_stop = false;
+  };
+
+}} // namespace Azure::Storage
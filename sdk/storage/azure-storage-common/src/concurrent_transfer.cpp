@@ -0,0 +1,241 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/concurrent_transfer.hpp"
+
+#include <utility>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    // The chunks are grown when they take less time than this to transfer.
+    constexpr std::chrono::milliseconds MinChunkTransferDuration(1000);
+    // The chunks are shrunk when they take more time than this to transfer.
+    constexpr std::chrono::milliseconds MaxChunkTransferDuration(4000);
+
+    /**
+     * @brief State of an adaptive transfer, shared by the calling thread and the tasks run by the
+     * executor.
+     *
+     */
+    class AdaptiveTransfer final : public std::enable_shared_from_this<AdaptiveTransfer> {
+    public:
+      AdaptiveTransfer(
+          int64_t offset,
+          int64_t length,
+          TransferTuner tuner,
+          std::function<void(int64_t, int64_t, int64_t, int64_t)> const& transferFunc,
+          TransferExecutor& executor)
+          : m_tuner(std::move(tuner)), m_transferFunc(transferFunc), m_executor(executor),
+            m_nextOffset(offset), m_endOffset(offset + length)
+      {
+      }
+
+      // Transfers chunks from the calling thread, then waits for the tasks.
+      void Run()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        TransferChunks(lock, false);
+        m_closed = true;
+        m_taskCompleted.wait(lock, [this]() { return m_numWorkingTasks == 0; });
+        if (m_error)
+        {
+          std::rethrow_exception(m_error);
+        }
+      }
+
+    private:
+      void RunTask()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_closed)
+        {
+          ++m_numWorkingTasks;
+          TransferChunks(lock, true);
+          --m_numWorkingTasks;
+        }
+        --m_numWorkers;
+        lock.unlock();
+        m_taskCompleted.notify_all();
+      }
+
+      // Transfers chunks until none is left, or until the concurrency drops below the number of
+      // workers, for the tasks.
+      void TransferChunks(std::unique_lock<std::mutex>& lock, bool isTask)
+      {
+        while (!m_failed && m_nextOffset < m_endOffset
+               && !(isTask && m_numWorkers > m_tuner.GetConcurrency()))
+        {
+          const int64_t chunkOffset = m_nextOffset;
+          const int64_t chunkLength = (std::min)(m_tuner.GetChunkSize(), m_endOffset - chunkOffset);
+          const int64_t chunkId = m_nextChunkId++;
+          m_nextOffset += chunkLength;
+          const int64_t numChunks = m_nextOffset == m_endOffset ? m_nextChunkId : -1;
+
+          // Starts as many tasks as the concurrency allows, and as there are chunks left.
+          const int64_t remainingChunks
+              = (m_endOffset - m_nextOffset + m_tuner.GetChunkSize() - 1) / m_tuner.GetChunkSize();
+          const int numNewTasks = static_cast<int>((std::min)(
+              static_cast<int64_t>(m_tuner.GetConcurrency() - m_numWorkers), remainingChunks));
+          if (numNewTasks > 0)
+          {
+            m_numWorkers += numNewTasks;
+          }
+
+          lock.unlock();
+          for (int i = 0; i < numNewTasks; ++i)
+          {
+            auto self = shared_from_this();
+            try
+            {
+              m_executor.Submit([self]() { self->RunTask(); });
+            }
+            catch (const std::exception&)
+            {
+              // The chunks are transferred by the other workers.
+              std::lock_guard<std::mutex> guard(m_mutex);
+              --m_numWorkers;
+            }
+          }
+
+          const auto startedOn = std::chrono::steady_clock::now();
+          try
+          {
+            m_transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
+          }
+          catch (...)
+          {
+            lock.lock();
+            if (!m_failed)
+            {
+              m_failed = true;
+              m_error = std::current_exception();
+            }
+            return;
+          }
+          const auto completedOn = std::chrono::steady_clock::now();
+
+          lock.lock();
+          m_tuner.OnChunkTransferred(chunkLength, startedOn, completedOn);
+        }
+      }
+
+      std::mutex m_mutex;
+      std::condition_variable m_taskCompleted;
+      TransferTuner m_tuner;
+      // Owned by the calling thread, which waits for the tasks using them. The tasks must not keep
+      // the executor alive, since its last reference could be released by one of its threads.
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> const& m_transferFunc;
+      TransferExecutor& m_executor;
+
+      int64_t m_nextOffset;
+      int64_t m_endOffset;
+      int64_t m_nextChunkId = 0;
+      // The calling thread, and the tasks submitted to the executor that have not returned yet.
+      int m_numWorkers = 1;
+      int m_numWorkingTasks = 0;
+      // Set once the calling thread is done with the chunks. The tasks starting afterwards return
+      // right away.
+      bool m_closed = false;
+      bool m_failed = false;
+      std::exception_ptr m_error;
+    };
+  } // namespace
+
+  TransferTuner::TransferTuner(
+      int64_t initialChunkSize,
+      int64_t minChunkSize,
+      int64_t maxChunkSize,
+      int maxConcurrency)
+      : m_minChunkSize((std::max)(minChunkSize, int64_t(1))),
+        m_maxChunkSize((std::max)(maxChunkSize, m_minChunkSize)),
+        m_maxConcurrency((std::max)(maxConcurrency, 1))
+  {
+    m_chunkSize = (std::min)((std::max)(initialChunkSize, m_minChunkSize), m_maxChunkSize);
+  }
+
+  void TransferTuner::OnChunkTransferred(
+      int64_t length,
+      std::chrono::steady_clock::time_point startedOn,
+      std::chrono::steady_clock::time_point completedOn)
+  {
+    const auto elapsed = completedOn - startedOn;
+    // The last chunk of a transfer can be smaller, and tells nothing about the larger ones.
+    if (elapsed < MinChunkTransferDuration && length >= m_chunkSize)
+    {
+      m_chunkSize = (std::min)(m_chunkSize * 2, m_maxChunkSize);
+    }
+    else if (elapsed > MaxChunkTransferDuration)
+    {
+      m_chunkSize = (std::max)(m_chunkSize / 2, m_minChunkSize);
+    }
+
+    if (!m_roundStarted)
+    {
+      m_roundStarted = true;
+      m_roundStartedOn = startedOn;
+    }
+    m_roundBytes += length;
+    if (++m_roundChunks < m_concurrency)
+    {
+      return;
+    }
+
+    const double roundSeconds
+        = std::chrono::duration<double>(completedOn - m_roundStartedOn).count();
+    const double throughput = static_cast<double>(m_roundBytes) / (std::max)(roundSeconds, 1e-6);
+    if (m_slowStart)
+    {
+      if (throughput > m_bestThroughput * 1.1)
+      {
+        m_bestThroughput = throughput;
+        m_previousConcurrency = m_concurrency;
+        m_concurrency = (std::min)(m_concurrency * 2, m_maxConcurrency);
+      }
+      else
+      {
+        // The last increase did not pay off.
+        m_slowStart = false;
+        m_concurrency = m_previousConcurrency;
+      }
+    }
+    else if (throughput > m_bestThroughput * 1.05)
+    {
+      m_bestThroughput = throughput;
+      m_concurrency = (std::min)(m_concurrency + 1, m_maxConcurrency);
+    }
+    else if (throughput < m_bestThroughput * 0.8)
+    {
+      m_bestThroughput = throughput;
+      m_concurrency = (std::max)(m_concurrency - (std::max)(m_concurrency / 4, 1), 1);
+    }
+
+    m_roundStartedOn = completedOn;
+    m_roundChunks = 0;
+    m_roundBytes = 0;
+  }
+
+  void AdaptiveConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t initialChunkSize,
+      int64_t minChunkSize,
+      int64_t maxChunkSize,
+      int maxConcurrency,
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<TransferExecutor> executor)
+  {
+    if (!executor)
+    {
+      executor = WorkStealingTransferExecutor::GetDefault();
+    }
+    auto transfer = std::make_shared<AdaptiveTransfer>(
+        offset,
+        length,
+        TransferTuner(initialChunkSize, minChunkSize, maxChunkSize, maxConcurrency),
+        transferFunc,
+        *executor);
+    transfer->Run();
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -31,11 +31,33 @@
 #include "azure/storage/common/storage_common.hpp"
 
 #include <azure/core/http/http.hpp>
+#include <azure/core/internal/cpu_features.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 
+// The CRC64 is computed with carry-less multiplications when the CPU supports them: PCLMULQDQ or
+// VPCLMULQDQ on x86-64, detected at runtime, and PMULL on ARMv8, when the build targets the
+// cryptography extension.
+#if defined(_M_X64) || defined(__x86_64__)
+#define _azure_CRC64_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN) \
+    && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define _azure_CRC64_ARM
+#include <arm_neon.h>
+#endif
+
+#if defined(_azure_CRC64_X86) && (defined(__GNUC__) || defined(__clang__))
+#define _azure_CRC64_CLMUL_TARGET __attribute__((target("sse2,pclmul")))
+#define _azure_CRC64_VPCLMUL_TARGET __attribute__((target("sse2,pclmul,avx512f,vpclmulqdq")))
+#else
+#define _azure_CRC64_CLMUL_TARGET
+#define _azure_CRC64_VPCLMUL_TARGET
+#endif
+
 namespace Azure { namespace Storage {
 
   namespace _internal {
@@ -83,6 +105,21 @@ namespace Azure { namespace Storage {
       }();
       return Core::Url::Encode(value, DoNotEncodeCharacters);
     }
+
+    ContentHash ComputeContentHash(const uint8_t* data, size_t length, HashAlgorithm algorithm)
+    {
+      ContentHash hash;
+      hash.Algorithm = algorithm;
+      if (algorithm == HashAlgorithm::Md5)
+      {
+        hash.Value = Md5(data, length);
+      }
+      else
+      {
+        hash.Value = Crc64Hash().Final(data, length);
+      }
+      return hash;
+    }
   } // namespace _internal
 
 #if defined(AZ_PLATFORM_WINDOWS)
@@ -92,6 +129,7 @@ namespace Azure { namespace Storage {
     enum class AlgorithmType
     {
       HmacSha256,
+      Md5,
     };
 
     struct AlgorithmProviderInstance final
@@ -107,6 +145,10 @@ namespace Azure { namespace Storage {
         {
           algorithmId = BCRYPT_SHA256_ALGORITHM;
         }
+        else if (type == AlgorithmType::Md5)
+        {
+          algorithmId = BCRYPT_MD5_ALGORITHM;
+        }
         else
         {
           throw std::runtime_error("Unknown algorithm type.");
@@ -117,6 +159,10 @@ namespace Azure { namespace Storage {
         {
           algorithmFlags = BCRYPT_ALG_HANDLE_HMAC_FLAG;
         }
+        else if (type == AlgorithmType::Md5)
+        {
+          algorithmFlags = BCRYPT_HASH_REUSABLE_FLAG;
+        }
         NTSTATUS status
             = BCryptOpenAlgorithmProvider(&Handle, algorithmId, nullptr, algorithmFlags);
         if (!BCRYPT_SUCCESS(status))
@@ -203,6 +249,73 @@ namespace Azure { namespace Storage {
 
       return hash;
     }
+
+    namespace {
+      const AlgorithmProviderInstance& GetMd5AlgorithmProvider()
+      {
+        static AlgorithmProviderInstance instance(AlgorithmType::Md5);
+        return instance;
+      }
+
+      // A reusable hash object, which is reset by BCryptFinishHash.
+      struct Md5Context final
+      {
+        std::string Object;
+        BCRYPT_HASH_HANDLE Handle = nullptr;
+
+        Md5Context()
+        {
+          const auto& algorithmProvider = GetMd5AlgorithmProvider();
+          Object.resize(algorithmProvider.ContextSize);
+          NTSTATUS status = BCryptCreateHash(
+              algorithmProvider.Handle,
+              &Handle,
+              reinterpret_cast<PUCHAR>(&Object[0]),
+              static_cast<ULONG>(Object.size()),
+              nullptr,
+              0,
+              BCRYPT_HASH_REUSABLE_FLAG);
+          if (!BCRYPT_SUCCESS(status))
+          {
+            throw std::runtime_error("BCryptCreateHash failed.");
+          }
+        }
+
+        Md5Context(const Md5Context&) = delete;
+        Md5Context& operator=(const Md5Context&) = delete;
+
+        ~Md5Context() { BCryptDestroyHash(Handle); }
+      };
+    } // namespace
+
+    std::vector<uint8_t> Md5(const uint8_t* data, size_t length)
+    {
+      thread_local Md5Context context;
+
+      while (length != 0)
+      {
+        const ULONG bytesToHash = static_cast<ULONG>(
+            (std::min)(length, static_cast<size_t>((std::numeric_limits<ULONG>::max)())));
+        NTSTATUS status = BCryptHashData(
+            context.Handle, const_cast<PUCHAR>(data), bytesToHash, 0);
+        if (!BCRYPT_SUCCESS(status))
+        {
+          throw std::runtime_error("BCryptHashData failed.");
+        }
+        data += bytesToHash;
+        length -= bytesToHash;
+      }
+
+      std::vector<uint8_t> hash;
+      hash.resize(GetMd5AlgorithmProvider().HashLength);
+      NTSTATUS status = BCryptFinishHash(
+          context.Handle, reinterpret_cast<PUCHAR>(&hash[0]), static_cast<ULONG>(hash.size()), 0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptFinishHash failed.");
+      }
+      return hash;
+    }
   } // namespace _internal
 
 #elif defined(AZ_PLATFORM_POSIX)
@@ -227,6 +340,43 @@ namespace Azure { namespace Storage {
       return std::vector<uint8_t>(std::begin(hash), std::begin(hash) + hashLength);
     }
 
+    namespace {
+      struct Md5Context final
+      {
+        EVP_MD_CTX* Context;
+
+        Md5Context()
+        {
+          Context = EVP_MD_CTX_new();
+          if (Context == nullptr)
+          {
+            throw std::runtime_error("Crypto error while creating EVP context.");
+          }
+        }
+
+        Md5Context(const Md5Context&) = delete;
+        Md5Context& operator=(const Md5Context&) = delete;
+
+        ~Md5Context() { EVP_MD_CTX_free(Context); }
+      };
+    } // namespace
+
+    std::vector<uint8_t> Md5(const uint8_t* data, size_t length)
+    {
+      // Creating a context allocates, so each thread keeps one and reinitializes it.
+      thread_local Md5Context context;
+
+      unsigned int hashLength = 0;
+      uint8_t hash[EVP_MAX_MD_SIZE];
+      if (1 != EVP_DigestInit_ex(context.Context, EVP_md5(), nullptr)
+          || 1 != EVP_DigestUpdate(context.Context, data, length)
+          || 1 != EVP_DigestFinal_ex(context.Context, hash, &hashLength))
+      {
+        throw std::runtime_error("Crypto error while computing Md5.");
+      }
+      return std::vector<uint8_t>(std::begin(hash), std::begin(hash) + hashLength);
+    }
+
   } // namespace _internal
 
 #endif
@@ -862,12 +1012,9 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  // Appends data to the CRC register uCrc, with the lookup tables.
+  static uint64_t Crc64TableAppend(uint64_t uCrc, const uint8_t* data, size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
-
     uint64_t pData = 0;
 
     size_t uStop = length - (length % 32);
@@ -1007,7 +1154,275 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc;
+  }
+
+#if defined(_azure_CRC64_X86) || defined(_azure_CRC64_ARM)
+  // x^n mod P, bit-reflected like the CRC register.
+  static constexpr uint64_t Crc64XPowNModP(uint64_t n)
+  {
+    uint64_t r = 1ULL << 63;
+    for (uint64_t i = 0; i < n; ++i)
+    {
+      r = (r >> 1) ^ ((r & 1) != 0 ? Crc64Poly : 0);
+    }
+    return r;
+  }
+
+  /*
+   * The carry-less multiplication implementations fold the data 128 bits at a time. A 128-bit
+   * block X, whose first 64 bits are L and last 64 bits are H, is moved d bits further in the
+   * message as
+   *     X * x^d = L * x^(d+64) + H * x^d = L * (x^(d+63) mod P) * x + H * (x^(d-1) mod P) * x
+   * mod P, where the extra factor x comes from the carry-less multiplication of bit-reflected
+   * values. Several blocks are folded in parallel, then into each other, and the last block is
+   * reduced with the lookup tables.
+   */
+  struct Crc64FoldConstants final
+  {
+    // Multiplies the first 64 bits.
+    uint64_t First;
+    // Multiplies the last 64 bits.
+    uint64_t Last;
+  };
+
+  static constexpr Crc64FoldConstants Crc64FoldBy(uint64_t bits)
+  {
+    return {Crc64XPowNModP(bits + 63), Crc64XPowNModP(bits - 1)};
+  }
+
+  static constexpr Crc64FoldConstants Crc64Fold128 = Crc64FoldBy(128);
+  static constexpr Crc64FoldConstants Crc64Fold512 = Crc64FoldBy(512);
+  static constexpr Crc64FoldConstants Crc64Fold2048 = Crc64FoldBy(2048);
+
+  // Appends the folded 128-bit block, then the remaining data, to a cleared CRC register.
+  static uint64_t Crc64Reduce(const uint8_t* folded, const uint8_t* data, size_t length)
+  {
+    return Crc64TableAppend(Crc64TableAppend(0, folded, 16), data, length);
+  }
+#endif
+
+#if defined(_azure_CRC64_X86)
+  _azure_CRC64_CLMUL_TARGET static inline __m128i Crc64Fold(__m128i x, __m128i k)
+  {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+  }
+
+  _azure_CRC64_CLMUL_TARGET static inline __m128i Crc64LoadConstants(Crc64FoldConstants k)
+  {
+    return _mm_set_epi64x(static_cast<long long>(k.Last), static_cast<long long>(k.First));
+  }
+
+  // Folds 128-bit blocks until less than 16 bytes are left, then reduces.
+  _azure_CRC64_CLMUL_TARGET static uint64_t Crc64ClmulFinish(
+      __m128i x,
+      const uint8_t* data,
+      size_t length)
+  {
+    const __m128i k128 = Crc64LoadConstants(Crc64Fold128);
+    for (; length >= 16; data += 16, length -= 16)
+    {
+      x = _mm_xor_si128(
+          Crc64Fold(x, k128), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+    }
+    uint8_t folded[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x);
+    return Crc64Reduce(folded, data, length);
+  }
+
+  _azure_CRC64_CLMUL_TARGET static uint64_t Crc64ClmulAppend(
+      uint64_t uCrc,
+      const uint8_t* data,
+      size_t length)
+  {
+    if (length < 64)
+    {
+      return Crc64TableAppend(uCrc, data, length);
+    }
+
+    const __m128i k128 = Crc64LoadConstants(Crc64Fold128);
+    const __m128i k512 = Crc64LoadConstants(Crc64Fold512);
+    const __m128i* p = reinterpret_cast<const __m128i*>(data);
+    __m128i x0 = _mm_xor_si128(
+        _mm_loadu_si128(p), _mm_cvtsi64_si128(static_cast<long long>(uCrc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    for (data += 64, length -= 64; length >= 64; data += 64, length -= 64)
+    {
+      p = reinterpret_cast<const __m128i*>(data);
+      x0 = _mm_xor_si128(Crc64Fold(x0, k512), _mm_loadu_si128(p));
+      x1 = _mm_xor_si128(Crc64Fold(x1, k512), _mm_loadu_si128(p + 1));
+      x2 = _mm_xor_si128(Crc64Fold(x2, k512), _mm_loadu_si128(p + 2));
+      x3 = _mm_xor_si128(Crc64Fold(x3, k512), _mm_loadu_si128(p + 3));
+    }
+    __m128i x = _mm_xor_si128(Crc64Fold(x0, k128), x1);
+    x = _mm_xor_si128(Crc64Fold(x, k128), x2);
+    x = _mm_xor_si128(Crc64Fold(x, k128), x3);
+    return Crc64ClmulFinish(x, data, length);
+  }
+
+  _azure_CRC64_VPCLMUL_TARGET static inline __m512i Crc64Fold(__m512i x, __m512i k)
+  {
+    return _mm512_xor_si512(
+        _mm512_clmulepi64_epi128(x, k, 0x00), _mm512_clmulepi64_epi128(x, k, 0x11));
+  }
+
+  _azure_CRC64_VPCLMUL_TARGET static uint64_t Crc64VpclmulAppend(
+      uint64_t uCrc,
+      const uint8_t* data,
+      size_t length)
+  {
+    if (length < 256)
+    {
+      return Crc64ClmulAppend(uCrc, data, length);
+    }
+
+    const __m128i k128 = Crc64LoadConstants(Crc64Fold128);
+    const __m512i k512 = _mm512_broadcast_i32x4(Crc64LoadConstants(Crc64Fold512));
+    const __m512i k2048 = _mm512_broadcast_i32x4(Crc64LoadConstants(Crc64Fold2048));
+    __m512i z0 = _mm512_xor_si512(
+        _mm512_loadu_si512(data),
+        _mm512_inserti32x4(
+            _mm512_setzero_si512(), _mm_cvtsi64_si128(static_cast<long long>(uCrc)), 0));
+    __m512i z1 = _mm512_loadu_si512(data + 64);
+    __m512i z2 = _mm512_loadu_si512(data + 128);
+    __m512i z3 = _mm512_loadu_si512(data + 192);
+    for (data += 256, length -= 256; length >= 256; data += 256, length -= 256)
+    {
+      z0 = _mm512_xor_si512(Crc64Fold(z0, k2048), _mm512_loadu_si512(data));
+      z1 = _mm512_xor_si512(Crc64Fold(z1, k2048), _mm512_loadu_si512(data + 64));
+      z2 = _mm512_xor_si512(Crc64Fold(z2, k2048), _mm512_loadu_si512(data + 128));
+      z3 = _mm512_xor_si512(Crc64Fold(z3, k2048), _mm512_loadu_si512(data + 192));
+    }
+    __m512i z = _mm512_xor_si512(Crc64Fold(z0, k512), z1);
+    z = _mm512_xor_si512(Crc64Fold(z, k512), z2);
+    z = _mm512_xor_si512(Crc64Fold(z, k512), z3);
+
+    __m128i x = _mm512_extracti32x4_epi32(z, 0);
+    x = _mm_xor_si128(Crc64Fold(x, k128), _mm512_extracti32x4_epi32(z, 1));
+    x = _mm_xor_si128(Crc64Fold(x, k128), _mm512_extracti32x4_epi32(z, 2));
+    x = _mm_xor_si128(Crc64Fold(x, k128), _mm512_extracti32x4_epi32(z, 3));
+    return Crc64ClmulFinish(x, data, length);
+  }
+#elif defined(_azure_CRC64_ARM)
+  static inline uint64x2_t Crc64Fold(uint64x2_t x, Crc64FoldConstants k)
+  {
+    return veorq_u64(
+        vreinterpretq_u64_p128(vmull_p64(
+            static_cast<poly64_t>(vgetq_lane_u64(x, 0)), static_cast<poly64_t>(k.First))),
+        vreinterpretq_u64_p128(vmull_p64(
+            static_cast<poly64_t>(vgetq_lane_u64(x, 1)), static_cast<poly64_t>(k.Last))));
+  }
+
+  static inline uint64x2_t Crc64Load(const uint8_t* data)
+  {
+    return vreinterpretq_u64_u8(vld1q_u8(data));
+  }
+
+  static uint64_t Crc64ClmulAppend(uint64_t uCrc, const uint8_t* data, size_t length)
+  {
+    if (length < 64)
+    {
+      return Crc64TableAppend(uCrc, data, length);
+    }
+
+    uint64x2_t x0 = veorq_u64(Crc64Load(data), vsetq_lane_u64(uCrc, vdupq_n_u64(0), 0));
+    uint64x2_t x1 = Crc64Load(data + 16);
+    uint64x2_t x2 = Crc64Load(data + 32);
+    uint64x2_t x3 = Crc64Load(data + 48);
+    for (data += 64, length -= 64; length >= 64; data += 64, length -= 64)
+    {
+      x0 = veorq_u64(Crc64Fold(x0, Crc64Fold512), Crc64Load(data));
+      x1 = veorq_u64(Crc64Fold(x1, Crc64Fold512), Crc64Load(data + 16));
+      x2 = veorq_u64(Crc64Fold(x2, Crc64Fold512), Crc64Load(data + 32));
+      x3 = veorq_u64(Crc64Fold(x3, Crc64Fold512), Crc64Load(data + 48));
+    }
+    uint64x2_t x = veorq_u64(Crc64Fold(x0, Crc64Fold128), x1);
+    x = veorq_u64(Crc64Fold(x, Crc64Fold128), x2);
+    x = veorq_u64(Crc64Fold(x, Crc64Fold128), x3);
+    for (; length >= 16; data += 16, length -= 16)
+    {
+      x = veorq_u64(Crc64Fold(x, Crc64Fold128), Crc64Load(data));
+    }
+    uint8_t folded[16];
+    vst1q_u8(folded, vreinterpretq_u8_u64(x));
+    return Crc64Reduce(folded, data, length);
+  }
+#endif
+
+  namespace _detail {
+    bool IsCrc64ImplementationSupported(Crc64Implementation implementation)
+    {
+      switch (implementation)
+      {
+        case Crc64Implementation::LookupTable:
+          return true;
+#if defined(_azure_CRC64_X86)
+        case Crc64Implementation::CarrylessMultiply:
+          return Azure::Core::_internal::CpuFeatures::HasPclmulqdq();
+        case Crc64Implementation::VectorCarrylessMultiply:
+          return Azure::Core::_internal::CpuFeatures::HasPclmulqdq()
+              && Azure::Core::_internal::CpuFeatures::HasAvx512f()
+              && Azure::Core::_internal::CpuFeatures::HasVpclmulqdq();
+#elif defined(_azure_CRC64_ARM)
+        case Crc64Implementation::CarrylessMultiply:
+          return true;
+#endif
+        default:
+          return false;
+      }
+    }
+
+    uint64_t Crc64Append(
+        uint64_t crc,
+        const uint8_t* data,
+        size_t length,
+        Crc64Implementation implementation)
+    {
+      uint64_t uCrc = crc ^ ~0ULL;
+      switch (implementation)
+      {
+#if defined(_azure_CRC64_X86)
+        case Crc64Implementation::VectorCarrylessMultiply:
+          uCrc = Crc64VpclmulAppend(uCrc, data, length);
+          break;
+        case Crc64Implementation::CarrylessMultiply:
+          uCrc = Crc64ClmulAppend(uCrc, data, length);
+          break;
+#elif defined(_azure_CRC64_ARM)
+        case Crc64Implementation::CarrylessMultiply:
+          uCrc = Crc64ClmulAppend(uCrc, data, length);
+          break;
+#endif
+        default:
+          uCrc = Crc64TableAppend(uCrc, data, length);
+          break;
+      }
+      return uCrc ^ ~0ULL;
+    }
+  } // namespace _detail
+
+  static _detail::Crc64Implementation GetFastestCrc64Implementation()
+  {
+    for (auto implementation :
+         {_detail::Crc64Implementation::VectorCarrylessMultiply,
+          _detail::Crc64Implementation::CarrylessMultiply})
+    {
+      if (_detail::IsCrc64ImplementationSupported(implementation))
+      {
+        return implementation;
+      }
+    }
+    return _detail::Crc64Implementation::LookupTable;
+  }
+
+  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  {
+    static const _detail::Crc64Implementation implementation = GetFastestCrc64Implementation();
+
+    m_length += length;
+    m_context = _detail::Crc64Append(m_context, data, length, implementation);
   }
 
   void Crc64Hash::Concatenate(const Crc64Hash& other)
@@ -9,6 +9,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #endif
@@ -23,57 +24,116 @@
 #include <windows.h>
 #endif
 
+#include <cerrno>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 
 namespace Azure { namespace Storage { namespace _internal {
 
 #if defined(AZ_PLATFORM_WINDOWS)
-  FileReader::FileReader(const std::string& filename)
-  {
-    int sizeNeeded = MultiByteToWideChar(
-        CP_UTF8,
-        MB_ERR_INVALID_CHARS,
-        filename.data(),
-        static_cast<int>(filename.length()),
-        nullptr,
-        0);
-    if (sizeNeeded == 0)
+  namespace {
+    HANDLE CreateFileHandle(
+        const std::string& filename,
+        DWORD desiredAccess,
+        DWORD shareMode,
+        DWORD creationDisposition)
     {
-      throw std::runtime_error("Invalid filename.");
+      int sizeNeeded = MultiByteToWideChar(
+          CP_UTF8,
+          MB_ERR_INVALID_CHARS,
+          filename.data(),
+          static_cast<int>(filename.length()),
+          nullptr,
+          0);
+      if (sizeNeeded == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+      std::wstring filenameW(sizeNeeded, L'\0');
+      if (MultiByteToWideChar(
+              CP_UTF8,
+              MB_ERR_INVALID_CHARS,
+              filename.data(),
+              static_cast<int>(filename.length()),
+              &filenameW[0],
+              sizeNeeded)
+          == 0)
+      {
+        throw std::runtime_error("Invalid filename.");
+      }
+
+      HANDLE fileHandle;
+
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+      fileHandle = CreateFileW(
+          filenameW.data(),
+          desiredAccess,
+          shareMode,
+          nullptr,
+          creationDisposition,
+          FILE_ATTRIBUTE_NORMAL,
+          NULL);
+#else
+      fileHandle = CreateFile2(
+          filenameW.data(), desiredAccess, shareMode, creationDisposition, NULL);
+#endif
+      if (fileHandle == INVALID_HANDLE_VALUE)
+      {
+        throw std::runtime_error("Failed to open file.");
+      }
+      return fileHandle;
     }
-    std::wstring filenameW(sizeNeeded, L'\0');
-    if (MultiByteToWideChar(
-            CP_UTF8,
-            MB_ERR_INVALID_CHARS,
-            filename.data(),
-            static_cast<int>(filename.length()),
-            &filenameW[0],
-            sizeNeeded)
-        == 0)
+
+    // Maps the whole file, whose size is fileSize. Returns the mapping handle, and the view in
+    // data.
+    HANDLE MapFile(HANDLE fileHandle, int64_t fileSize, bool writable, uint8_t*& data)
     {
-      throw std::runtime_error("Invalid filename.");
-    }
+      if (static_cast<uint64_t>(fileSize) > (std::numeric_limits<size_t>::max)())
+      {
+        throw std::runtime_error("File is too large to be mapped.");
+      }
+      const DWORD protection = writable ? PAGE_READWRITE : PAGE_READONLY;
+      const DWORD desiredAccess = writable ? FILE_MAP_WRITE : FILE_MAP_READ;
 
-    HANDLE fileHandle;
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+      HANDLE mappingHandle = CreateFileMappingW(
+          fileHandle,
+          nullptr,
+          protection,
+          static_cast<DWORD>(static_cast<uint64_t>(fileSize) >> 32),
+          static_cast<DWORD>(static_cast<uint64_t>(fileSize)),
+          nullptr);
+#else
+      HANDLE mappingHandle = CreateFileMappingFromApp(
+          fileHandle, nullptr, protection, static_cast<ULONG64>(fileSize), nullptr);
+#endif
+      if (mappingHandle == NULL)
+      {
+        throw std::runtime_error("Failed to map file.");
+      }
 
 #if !defined(WINAPI_PARTITION_DESKTOP) \
     || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
-    fileHandle = CreateFileW(
-        filenameW.data(),
-        GENERIC_READ,
-        FILE_SHARE_READ,
-        nullptr,
-        OPEN_EXISTING,
-        FILE_ATTRIBUTE_NORMAL,
-        NULL);
+      void* view = MapViewOfFile(mappingHandle, desiredAccess, 0, 0, 0);
 #else
-    fileHandle = CreateFile2(filenameW.data(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, NULL);
+      void* view = MapViewOfFileFromApp(mappingHandle, desiredAccess, 0, 0);
 #endif
-    if (fileHandle == INVALID_HANDLE_VALUE)
-    {
-      throw std::runtime_error("Failed to open file.");
+      if (view == nullptr)
+      {
+        CloseHandle(mappingHandle);
+        throw std::runtime_error("Failed to map file.");
+      }
+      data = static_cast<uint8_t*>(view);
+      return mappingHandle;
     }
+  } // namespace
+
+  FileReader::FileReader(const std::string& filename)
+  {
+    HANDLE fileHandle = CreateFileHandle(filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING);
 
     LARGE_INTEGER fileSize;
     BOOL ret = GetFileSizeEx(fileHandle, &fileSize);
@@ -90,50 +150,8 @@ namespace Azure { namespace Storage { namespace _internal {
 
   FileWriter::FileWriter(const std::string& filename)
   {
-    int sizeNeeded = MultiByteToWideChar(
-        CP_UTF8,
-        MB_ERR_INVALID_CHARS,
-        filename.data(),
-        static_cast<int>(filename.length()),
-        nullptr,
-        0);
-    if (sizeNeeded == 0)
-    {
-      throw std::runtime_error("Invalid filename.");
-    }
-    std::wstring filenameW(sizeNeeded, L'\0');
-    if (MultiByteToWideChar(
-            CP_UTF8,
-            MB_ERR_INVALID_CHARS,
-            filename.data(),
-            static_cast<int>(filename.length()),
-            &filenameW[0],
-            sizeNeeded)
-        == 0)
-    {
-      throw std::runtime_error("Invalid filename.");
-    }
-
-    HANDLE fileHandle;
-
-#if !defined(WINAPI_PARTITION_DESKTOP) \
-    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
-    fileHandle = CreateFileW(
-        filenameW.data(),
-        GENERIC_WRITE,
-        FILE_SHARE_READ | FILE_SHARE_WRITE,
-        nullptr,
-        CREATE_ALWAYS,
-        FILE_ATTRIBUTE_NORMAL,
-        NULL);
-#else
-    fileHandle = CreateFile2(
-        filenameW.data(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, CREATE_ALWAYS, NULL);
-#endif
-    if (fileHandle == INVALID_HANDLE_VALUE)
-    {
-      throw std::runtime_error("Failed to open file.");
-    }
+    HANDLE fileHandle = CreateFileHandle(
+        filename, GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, CREATE_ALWAYS);
     m_handle = static_cast<void*>(fileHandle);
   }
 
@@ -163,6 +181,78 @@ namespace Azure { namespace Storage { namespace _internal {
       throw std::runtime_error("Failed to write file.");
     }
   }
+
+  MappedFileReader::MappedFileReader(const std::string& filename)
+  {
+    HANDLE fileHandle = CreateFileHandle(filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+      CloseHandle(fileHandle);
+      throw std::runtime_error("Failed to get size of file.");
+    }
+    // Empty files cannot be mapped.
+    if (fileSize.QuadPart != 0)
+    {
+      try
+      {
+        m_mappingHandle = MapFile(fileHandle, fileSize.QuadPart, false, m_data);
+      }
+      catch (...)
+      {
+        CloseHandle(fileHandle);
+        throw;
+      }
+    }
+    m_handle = static_cast<void*>(fileHandle);
+    m_fileSize = fileSize.QuadPart;
+  }
+
+  MappedFileReader::~MappedFileReader()
+  {
+    if (m_data != nullptr)
+    {
+      UnmapViewOfFile(m_data);
+      CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
+
+  MappedFileWriter::MappedFileWriter(const std::string& filename, int64_t fileSize)
+  {
+    HANDLE fileHandle = CreateFileHandle(
+        filename,
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        CREATE_ALWAYS);
+
+    // Creating the mapping extends the file to its size.
+    if (fileSize != 0)
+    {
+      try
+      {
+        m_mappingHandle = MapFile(fileHandle, fileSize, true, m_data);
+      }
+      catch (...)
+      {
+        CloseHandle(fileHandle);
+        throw;
+      }
+    }
+    m_handle = static_cast<void*>(fileHandle);
+    m_fileSize = fileSize;
+  }
+
+  MappedFileWriter::~MappedFileWriter()
+  {
+    if (m_data != nullptr)
+    {
+      UnmapViewOfFile(m_data);
+      CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
 #elif defined(AZ_PLATFORM_POSIX)
   FileReader::FileReader(const std::string& filename)
   {
@@ -205,6 +295,121 @@ namespace Azure { namespace Storage { namespace _internal {
       throw std::runtime_error("Failed to write file.");
     }
   }
+
+  namespace {
+    uint8_t* MapFile(int fileHandle, int64_t fileSize, bool writable)
+    {
+      if (static_cast<uint64_t>(fileSize) > (std::numeric_limits<size_t>::max)())
+      {
+        throw std::runtime_error("File is too large to be mapped.");
+      }
+      void* data = mmap(
+          nullptr,
+          static_cast<size_t>(fileSize),
+          writable ? PROT_READ | PROT_WRITE : PROT_READ,
+          MAP_SHARED,
+          fileHandle,
+          0);
+      if (data == MAP_FAILED)
+      {
+        throw std::runtime_error("Failed to map file.");
+      }
+      // Chunks are transferred front to back, so the kernel can read ahead. This is only a hint.
+      posix_madvise(data, static_cast<size_t>(fileSize), POSIX_MADV_SEQUENTIAL);
+      return static_cast<uint8_t*>(data);
+    }
+  } // namespace
+
+  MappedFileReader::MappedFileReader(const std::string& filename)
+  {
+    m_handle = open(filename.data(), O_RDONLY);
+    if (m_handle == -1)
+    {
+      throw std::runtime_error("Failed to open file.");
+    }
+    m_fileSize = lseek(m_handle, 0, SEEK_END);
+    if (m_fileSize == -1)
+    {
+      close(m_handle);
+      throw std::runtime_error("Failed to get size of file.");
+    }
+    // Empty files cannot be mapped.
+    if (m_fileSize != 0)
+    {
+      try
+      {
+        m_data = MapFile(m_handle, m_fileSize, false);
+      }
+      catch (...)
+      {
+        close(m_handle);
+        throw;
+      }
+    }
+  }
+
+  MappedFileReader::~MappedFileReader()
+  {
+    if (m_data != nullptr)
+    {
+      munmap(m_data, static_cast<size_t>(m_fileSize));
+    }
+    close(m_handle);
+  }
+
+  MappedFileWriter::MappedFileWriter(const std::string& filename, int64_t fileSize)
+      : m_fileSize(fileSize)
+  {
+    if (fileSize > static_cast<int64_t>((std::numeric_limits<off_t>::max)()))
+    {
+      throw std::runtime_error("Failed to write file.");
+    }
+    m_handle = open(
+        filename.data(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_handle == -1)
+    {
+      throw std::runtime_error("Failed to open file.");
+    }
+    if (fileSize == 0)
+    {
+      return;
+    }
+
+    // Writing to a page of the mapping the file system has no space for raises SIGBUS, so the
+    // space is allocated upfront where the file system supports it.
+    int ret = -1;
+#if defined(__linux__)
+    ret = posix_fallocate(m_handle, 0, static_cast<off_t>(fileSize));
+    if (ret != 0 && ret != EINVAL && ret != EOPNOTSUPP)
+    {
+      close(m_handle);
+      throw std::runtime_error("Failed to write file.");
+    }
+#endif
+    if (ret != 0 && ftruncate(m_handle, static_cast<off_t>(fileSize)) != 0)
+    {
+      close(m_handle);
+      throw std::runtime_error("Failed to write file.");
+    }
+    try
+    {
+      m_data = MapFile(m_handle, fileSize, true);
+    }
+    catch (...)
+    {
+      close(m_handle);
+      throw;
+    }
+  }
+
+  MappedFileWriter::~MappedFileWriter()
+  {
+    if (m_data != nullptr)
+    {
+      munmap(m_data, static_cast<size_t>(m_fileSize));
+    }
+    close(m_handle);
+  }
 #endif
 
 }}} // namespace Azure::Storage::_internal
@@ -58,5 +58,31 @@ namespace Azure { namespace Storage {
         }
       }
     }
+
+    Azure::Core::IO::BodyStreamView ReliableStream::OnReadView(size_t count, Context const& context)
+    {
+      for (int64_t intent = 1;; intent++)
+      {
+        if (this->m_inner == nullptr)
+        {
+          this->m_inner = this->m_streamReconnector(this->m_retryOffset, context);
+        }
+        try
+        {
+          auto const view = this->m_inner->ReadView(count, context);
+          this->m_retryOffset += view.Size;
+          return view;
+        }
+        catch (std::runtime_error const&)
+        {
+          // Same as OnRead(), the read is resumed from a new inner stream.
+          this->m_inner.reset();
+          if (intent == this->m_options.MaxRetryRequests || !g_reliableStreamEnabled)
+          {
+            throw;
+          }
+        }
+      }
+    }
   } // namespace _internal
 }} // namespace Azure::Storage
@@ -8,10 +8,8 @@
 
 namespace Azure { namespace Storage { namespace _internal {
 
-  std::unique_ptr<Azure::Core::Http::RawResponse>
-  StorageBearerTokenAuthenticationPolicy::AuthorizeAndSendRequest(
+  void StorageBearerTokenAuthenticationPolicy::AuthorizeRequest(
       Azure::Core::Http::Request& request,
-      Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
       Azure::Core::Context const& context) const
   {
     std::string tenantId = m_safeTenantId.Get();
@@ -22,7 +20,6 @@ namespace Azure { namespace Storage { namespace _internal {
       tokenRequestContext.TenantId = tenantId;
       AuthenticateAndAuthorizeRequest(request, tokenRequestContext, context);
     }
-    return nextPolicy.Send(request, context);
   }
 
   bool StorageBearerTokenAuthenticationPolicy::AuthorizeRequestOnChallenge(
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/transfer_buffer_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    constexpr size_t DefaultMemoryBudget = 1024 * 1024 * 1024;
+    constexpr size_t DefaultMaxIdleBytes = 64 * 1024 * 1024;
+    // Smaller requests share the smallest size class.
+    constexpr size_t MinSizeClass = 64 * 1024;
+    // The threads waiting for a buffer to be returned wake up at this interval to check for
+    // cancellation.
+    constexpr std::chrono::milliseconds CancellationCheckInterval(100);
+
+    // Rounds size up to its size class. There are four classes per power of two, so at most a
+    // quarter of a buffer is wasted.
+    size_t GetSizeClass(size_t size)
+    {
+      if (size <= MinSizeClass)
+      {
+        return MinSizeClass;
+      }
+      size_t powerOfTwo = MinSizeClass;
+      while (powerOfTwo <= size / 2)
+      {
+        powerOfTwo *= 2;
+      }
+      const size_t step = powerOfTwo / 4;
+      const size_t numSteps = (size - powerOfTwo + step - 1) / step;
+      if (numSteps > ((std::numeric_limits<size_t>::max)() - powerOfTwo) / step)
+      {
+        return size;
+      }
+      return powerOfTwo + numSteps * step;
+    }
+  } // namespace
+
+  struct TransferBufferPool::SharedState final
+  {
+    std::mutex Mutex;
+    std::condition_variable BufferReturned;
+    size_t MemoryBudget;
+    size_t MaxIdleBytes;
+    // The idle buffers, by size class.
+    std::map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> IdleBuffers;
+    Statistics Stats;
+  };
+
+  TransferBufferPool::Buffer& TransferBufferPool::Buffer::operator=(Buffer&& other) noexcept
+  {
+    if (this != &other)
+    {
+      Release();
+      m_state = std::move(other.m_state);
+      m_data = std::move(other.m_data);
+      m_size = other.m_size;
+      m_capacity = other.m_capacity;
+      other.m_size = 0;
+      other.m_capacity = 0;
+    }
+    return *this;
+  }
+
+  TransferBufferPool::Buffer::~Buffer() { Release(); }
+
+  void TransferBufferPool::Buffer::Release()
+  {
+    if (!m_data)
+    {
+      return;
+    }
+    // Freed outside of the lock, if the pool does not keep it.
+    std::unique_ptr<uint8_t[]> data = std::move(m_data);
+    {
+      std::lock_guard<std::mutex> lock(m_state->Mutex);
+      auto& stats = m_state->Stats;
+      stats.BytesInUse -= m_capacity;
+      if (stats.BytesIdle + m_capacity <= m_state->MaxIdleBytes
+          && stats.BytesInUse + stats.BytesIdle + m_capacity <= m_state->MemoryBudget)
+      {
+        m_state->IdleBuffers[m_capacity].push_back(std::move(data));
+        stats.BytesIdle += m_capacity;
+      }
+    }
+    m_state->BufferReturned.notify_all();
+    m_state.reset();
+    m_size = 0;
+    m_capacity = 0;
+  }
+
+  TransferBufferPool::TransferBufferPool(size_t memoryBudget, size_t maxIdleBytes)
+      : m_state(std::make_shared<SharedState>())
+  {
+    m_state->MemoryBudget = memoryBudget;
+    m_state->MaxIdleBytes = (std::min)(maxIdleBytes, memoryBudget);
+  }
+
+  TransferBufferPool::~TransferBufferPool()
+  {
+    // The lent buffers keep the state alive, and are freed when they are returned.
+    std::lock_guard<std::mutex> lock(m_state->Mutex);
+    m_state->MaxIdleBytes = 0;
+    m_state->IdleBuffers.clear();
+    m_state->Stats.BytesIdle = 0;
+  }
+
+  TransferBufferPool::Buffer TransferBufferPool::Acquire(
+      size_t size,
+      const Azure::Core::Context& context)
+  {
+    Buffer buffer;
+    buffer.m_size = size;
+    buffer.m_capacity = GetSizeClass(size);
+    const size_t capacity = buffer.m_capacity;
+
+    std::vector<std::unique_ptr<uint8_t[]>> evictedBuffers;
+    {
+      std::unique_lock<std::mutex> lock(m_state->Mutex);
+      auto& stats = m_state->Stats;
+      bool waited = false;
+      while (true)
+      {
+        auto idleBuffers = m_state->IdleBuffers.find(capacity);
+        if (idleBuffers != m_state->IdleBuffers.end())
+        {
+          buffer.m_data = std::move(idleBuffers->second.back());
+          idleBuffers->second.pop_back();
+          if (idleBuffers->second.empty())
+          {
+            m_state->IdleBuffers.erase(idleBuffers);
+          }
+          stats.BytesIdle -= capacity;
+          ++stats.ReuseCount;
+          break;
+        }
+        if (stats.BytesInUse == 0 || stats.BytesInUse + capacity <= m_state->MemoryBudget)
+        {
+          // Idle buffers of the other size classes make room for the new one, the largest first.
+          while (stats.BytesIdle != 0
+                 && stats.BytesInUse + stats.BytesIdle + capacity > m_state->MemoryBudget)
+          {
+            auto largest = std::prev(m_state->IdleBuffers.end());
+            stats.BytesIdle -= largest->first;
+            evictedBuffers.push_back(std::move(largest->second.back()));
+            largest->second.pop_back();
+            if (largest->second.empty())
+            {
+              m_state->IdleBuffers.erase(largest);
+            }
+          }
+          ++stats.AllocationCount;
+          break;
+        }
+        context.ThrowIfCancelled();
+        if (!waited)
+        {
+          ++stats.WaitCount;
+          waited = true;
+        }
+        m_state->BufferReturned.wait_for(lock, CancellationCheckInterval);
+      }
+      stats.BytesInUse += capacity;
+      stats.PeakBytesInUse = (std::max)(stats.PeakBytesInUse, stats.BytesInUse);
+      stats.PeakBytesAllocated
+          = (std::max)(stats.PeakBytesAllocated, stats.BytesInUse + stats.BytesIdle);
+    }
+    evictedBuffers.clear();
+
+    if (!buffer.m_data)
+    {
+      try
+      {
+        buffer.m_data = std::unique_ptr<uint8_t[]>(new uint8_t[capacity]);
+      }
+      catch (...)
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_state->Mutex);
+          m_state->Stats.BytesInUse -= capacity;
+        }
+        m_state->BufferReturned.notify_all();
+        throw;
+      }
+    }
+    buffer.m_state = m_state;
+    return buffer;
+  }
+
+  TransferBufferPool::Statistics TransferBufferPool::GetStatistics() const
+  {
+    std::lock_guard<std::mutex> lock(m_state->Mutex);
+    return m_state->Stats;
+  }
+
+  std::shared_ptr<TransferBufferPool> TransferBufferPool::GetDefault()
+  {
+    // Since C++11: If multiple threads attempt to initialize the same static local variable
+    // concurrently, the initialization occurs exactly once.
+    static std::shared_ptr<TransferBufferPool> instance
+        = std::make_shared<TransferBufferPool>(DefaultMemoryBudget, DefaultMaxIdleBytes);
+    return instance;
+  }
+
+}} // namespace Azure::Storage
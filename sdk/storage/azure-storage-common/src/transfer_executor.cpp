@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/transfer_executor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    // Maximum number of tasks run at once by the default executor.
+    constexpr size_t DefaultTransferExecutorMaxThreads = 64;
+
+    // Set on the threads of the executors, so that the tasks they submit are queued on their own
+    // worker.
+    thread_local WorkStealingTransferExecutor const* t_currentExecutor = nullptr;
+    thread_local size_t t_currentWorkerIndex = 0;
+  } // namespace
+
+  WorkStealingTransferExecutor::WorkStealingTransferExecutor(size_t maxThreads)
+  {
+    maxThreads = (std::max)(maxThreads, size_t(1));
+    m_workers.reserve(maxThreads);
+    for (size_t i = 0; i < maxThreads; ++i)
+    {
+      m_workers.emplace_back(std::make_unique<Worker>());
+    }
+  }
+
+  WorkStealingTransferExecutor::~WorkStealingTransferExecutor()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_tasksChanged.notify_all();
+    for (auto& worker : m_workers)
+    {
+      if (!worker->Thread.joinable())
+      {
+        continue;
+      }
+      if (worker->Thread.get_id() == std::this_thread::get_id())
+      {
+        // Destroyed by a task releasing the last reference to the executor. The thread returns
+        // once the task is destroyed, without touching the executor.
+        t_currentExecutor = nullptr;
+        worker->Thread.detach();
+      }
+      else
+      {
+        worker->Thread.join();
+      }
+    }
+  }
+
+  std::shared_ptr<WorkStealingTransferExecutor> WorkStealingTransferExecutor::GetDefault()
+  {
+    // Since C++11: If multiple threads attempt to initialize the same static local variable
+    // concurrently, the initialization occurs exactly once.
+    static std::shared_ptr<WorkStealingTransferExecutor> instance
+        = std::make_shared<WorkStealingTransferExecutor>(DefaultTransferExecutorMaxThreads);
+    return instance;
+  }
+
+  void WorkStealingTransferExecutor::Submit(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_stop)
+      {
+        return;
+      }
+
+      size_t numWorkers = m_numWorkers.load();
+      // A thread is started when there are not enough idle threads to take the pending tasks.
+      if (m_pendingTasks >= m_idleWorkers && numWorkers < m_workers.size())
+      {
+        m_workers[numWorkers]->Thread = std::thread([this, numWorkers]() { Run(numWorkers); });
+        m_numWorkers.store(++numWorkers);
+      }
+
+      size_t queueIndex;
+      if (t_currentExecutor == this)
+      {
+        queueIndex = t_currentWorkerIndex;
+      }
+      else
+      {
+        queueIndex = m_nextQueue++ % numWorkers;
+      }
+      {
+        std::lock_guard<std::mutex> queueLock(m_workers[queueIndex]->Mutex);
+        m_workers[queueIndex]->Tasks.emplace_back(std::move(task));
+      }
+      ++m_pendingTasks;
+    }
+    m_tasksChanged.notify_one();
+  }
+
+  bool WorkStealingTransferExecutor::TryTakeTask(size_t workerIndex, std::function<void()>& task)
+  {
+    // The most recent task of its own queue, which is the most likely to have its data in the
+    // cache.
+    {
+      auto& worker = *m_workers[workerIndex];
+      std::lock_guard<std::mutex> lock(worker.Mutex);
+      if (!worker.Tasks.empty())
+      {
+        task = std::move(worker.Tasks.back());
+        worker.Tasks.pop_back();
+        return true;
+      }
+    }
+
+    // Otherwise, the oldest task of another queue.
+    const size_t numWorkers = m_numWorkers.load();
+    for (size_t i = 1; i < numWorkers; ++i)
+    {
+      auto& worker = *m_workers[(workerIndex + i) % numWorkers];
+      std::lock_guard<std::mutex> lock(worker.Mutex);
+      if (!worker.Tasks.empty())
+      {
+        task = std::move(worker.Tasks.front());
+        worker.Tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WorkStealingTransferExecutor::Run(size_t workerIndex)
+  {
+    t_currentExecutor = this;
+    t_currentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+      std::function<void()> task;
+      if (TryTakeTask(workerIndex, task))
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          --m_pendingTasks;
+          if (m_stop)
+          {
+            return;
+          }
+        }
+        task();
+        // The task can hold the last reference to the executor, which is then destroyed here.
+        task = nullptr;
+        if (t_currentExecutor != this)
+        {
+          return;
+        }
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(m_mutex);
+      ++m_idleWorkers;
+      m_tasksChanged.wait(lock, [this]() { return m_stop || m_pendingTasks != 0; });
+      --m_idleWorkers;
+      if (m_stop)
+      {
+        return;
+      }
+    }
+  }
+
+}} // namespace Azure::Storage
@@ -3,8 +3,10 @@
 
 #include "azure/storage/common/internal/xml_wrapper.hpp"
 
+#include <azure/core/azure_assert.hpp>
 #include <azure/core/platform.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <memory>
@@ -621,4 +623,505 @@ namespace Azure { namespace Storage { namespace _internal {
 
 #endif
 
+  namespace {
+    // The initial size of the buffer of the readers reading a body stream.
+    constexpr size_t StreamBufferSize = 64 * 1024;
+
+    bool IsXmlWhitespace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    bool IsXmlNameEnd(char c) { return IsXmlWhitespace(c) || c == '/' || c == '>' || c == '='; }
+
+    bool StartsWith(const char* position, const char* end, const char* prefix)
+    {
+      const size_t length = std::strlen(prefix);
+      return static_cast<size_t>(end - position) >= length
+          && std::memcmp(position, prefix, length) == 0;
+    }
+
+    bool IsEntity(const char* entity, size_t length, const char* name)
+    {
+      return length == std::strlen(name) && std::memcmp(entity, name, length) == 0;
+    }
+
+    [[noreturn]] void ThrowXmlParseError() { throw std::runtime_error("Failed to parse xml."); }
+
+    char* AppendUtf8(char* output, uint32_t codePoint)
+    {
+      if (codePoint < 0x80)
+      {
+        *output++ = static_cast<char>(codePoint);
+      }
+      else if (codePoint < 0x800)
+      {
+        *output++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else if (codePoint < 0x10000)
+      {
+        *output++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else
+      {
+        *output++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      return output;
+    }
+  } // namespace
+
+  XmlPullReader::XmlPullReader(char* data, size_t length) : m_position(data), m_end(data + length)
+  {
+    m_openTagLengths.reserve(16);
+  }
+
+  XmlPullReader::XmlPullReader(Core::IO::BodyStream& stream)
+      : m_stream(&stream), m_buffer(StreamBufferSize), m_isComplete(false)
+  {
+    m_position = m_buffer.data();
+    m_end = m_position;
+    m_openTagLengths.reserve(16);
+  }
+
+  XmlNodeView XmlPullReader::Read()
+  {
+    AZURE_ASSERT_MSG(m_stream == nullptr, "The reader of a body stream needs a context.");
+    return ReadNode();
+  }
+
+  XmlNodeView XmlPullReader::Read(const Core::Context& context)
+  {
+    while (!m_isComplete)
+    {
+      // The state changed by a node that is not complete yet, which is read again after Fill().
+      char* const position = m_position;
+      const bool inStartTag = m_inStartTag;
+      const bool afterStartTag = m_afterStartTag;
+      const bool bomSkipped = m_bomSkipped;
+      try
+      {
+        return ReadNode();
+      }
+      catch (const EndOfData&)
+      {
+        m_position = position;
+        m_inStartTag = inStartTag;
+        m_afterStartTag = afterStartTag;
+        m_bomSkipped = bomSkipped;
+      }
+      Fill(context);
+    }
+    return ReadNode();
+  }
+
+  XmlNodeView XmlPullReader::ReadNode()
+  {
+    if (!m_bomSkipped)
+    {
+      if (m_end - m_position < 3)
+      {
+        // Not an error yet, the document may be shorter than the byte order mark.
+        if (!m_isComplete)
+        {
+          OnEndOfData();
+        }
+      }
+      // UTF-8 byte order mark.
+      if (StartsWith(m_position, m_end, "\xEF\xBB\xBF"))
+      {
+        m_position += 3;
+      }
+      m_bomSkipped = true;
+    }
+    if (m_inStartTag)
+    {
+      return ReadInStartTag();
+    }
+
+    while (m_position != m_end)
+    {
+      if (*m_position != '<')
+      {
+        char* textBegin = m_position;
+        char* textEnd = static_cast<char*>(
+            std::memchr(m_position, '<', static_cast<size_t>(m_end - m_position)));
+        if (textEnd == nullptr)
+        {
+          if (!m_isComplete)
+          {
+            OnEndOfData();
+          }
+          textEnd = m_end;
+        }
+        m_position = textEnd;
+
+        const bool isWhitespace = std::all_of(textBegin, textEnd, IsXmlWhitespace);
+        if (m_openTagLengths.empty())
+        {
+          if (!isWhitespace)
+          {
+            ThrowXmlParseError();
+          }
+          continue;
+        }
+        if (isWhitespace && m_afterStartTag && m_end - m_position < 2)
+        {
+          OnEndOfData();
+        }
+        // Whitespace between elements is not content.
+        if (isWhitespace && !(m_afterStartTag && StartsWith(m_position, m_end, "</")))
+        {
+          continue;
+        }
+        m_afterStartTag = false;
+        textEnd = Decode(textBegin, textEnd, false);
+        return XmlNodeView{
+            XmlNodeType::Text,
+            XmlStringView(),
+            XmlStringView{textBegin, static_cast<size_t>(textEnd - textBegin)}};
+      }
+
+      // Enough to tell the kinds of markup apart.
+      if (m_end - m_position < 9 && !m_isComplete)
+      {
+        OnEndOfData();
+      }
+      if (StartsWith(m_position, m_end, "</"))
+      {
+        m_afterStartTag = false;
+        return ReadEndTag();
+      }
+      else if (StartsWith(m_position, m_end, "<!--"))
+      {
+        SkipPast("-->");
+      }
+      else if (StartsWith(m_position, m_end, "<?"))
+      {
+        SkipPast("?>");
+      }
+      else if (StartsWith(m_position, m_end, "<![CDATA["))
+      {
+        if (m_openTagLengths.empty())
+        {
+          ThrowXmlParseError();
+        }
+        m_position += 9;
+        char* textBegin = m_position;
+        const char* textEnd = SkipPast("]]>");
+        m_afterStartTag = false;
+        return XmlNodeView{
+            XmlNodeType::Text,
+            XmlStringView(),
+            XmlStringView{textBegin, static_cast<size_t>(textEnd - textBegin)}};
+      }
+      else if (StartsWith(m_position, m_end, "<!"))
+      {
+        // DTDs are not supported.
+        ThrowXmlParseError();
+      }
+      else
+      {
+        if (m_openTagLengths.empty() && m_rootRead)
+        {
+          ThrowXmlParseError();
+        }
+        ++m_position;
+        const XmlStringView name = ReadName();
+        m_openTagNames.append(name.Data, name.Length);
+        m_openTagLengths.push_back(name.Length);
+        m_rootRead = true;
+        m_inStartTag = true;
+        m_afterStartTag = false;
+        return XmlNodeView{XmlNodeType::StartTag, name, XmlStringView()};
+      }
+    }
+
+    if (!m_isComplete)
+    {
+      OnEndOfData();
+    }
+    if (!m_rootRead || !m_openTagLengths.empty())
+    {
+      ThrowXmlParseError();
+    }
+    return XmlNodeView{XmlNodeType::End, XmlStringView(), XmlStringView()};
+  }
+
+  XmlStringView XmlPullReader::ReadName()
+  {
+    const char* nameBegin = m_position;
+    while (m_position != m_end && !IsXmlNameEnd(*m_position))
+    {
+      ++m_position;
+    }
+    if (m_position == m_end)
+    {
+      OnEndOfData();
+    }
+    if (m_position == nameBegin)
+    {
+      ThrowXmlParseError();
+    }
+    return XmlStringView{nameBegin, static_cast<size_t>(m_position - nameBegin)};
+  }
+
+  XmlNodeView XmlPullReader::ReadInStartTag()
+  {
+    while (m_position != m_end && IsXmlWhitespace(*m_position))
+    {
+      ++m_position;
+    }
+    // The shortest remainder of a well-formed document is "/>".
+    if (m_end - m_position < 2)
+    {
+      OnEndOfData();
+    }
+    if (StartsWith(m_position, m_end, "/>"))
+    {
+      m_position += 2;
+      m_inStartTag = false;
+      m_openTagNames.resize(m_openTagNames.size() - m_openTagLengths.back());
+      m_openTagLengths.pop_back();
+      return XmlNodeView{XmlNodeType::EndTag, XmlStringView(), XmlStringView()};
+    }
+    if (StartsWith(m_position, m_end, ">"))
+    {
+      ++m_position;
+      m_inStartTag = false;
+      m_afterStartTag = true;
+      return ReadNode();
+    }
+
+    const XmlStringView name = ReadName();
+    while (m_position != m_end && IsXmlWhitespace(*m_position))
+    {
+      ++m_position;
+    }
+    if (m_position == m_end)
+    {
+      OnEndOfData();
+    }
+    if (*m_position != '=')
+    {
+      ThrowXmlParseError();
+    }
+    ++m_position;
+    while (m_position != m_end && IsXmlWhitespace(*m_position))
+    {
+      ++m_position;
+    }
+    if (m_position == m_end)
+    {
+      OnEndOfData();
+    }
+    if (*m_position != '"' && *m_position != '\'')
+    {
+      ThrowXmlParseError();
+    }
+    const char quote = *m_position++;
+    char* valueBegin = m_position;
+    char* valueEnd = static_cast<char*>(
+        std::memchr(m_position, quote, static_cast<size_t>(m_end - m_position)));
+    if (valueEnd == nullptr)
+    {
+      OnEndOfData();
+    }
+    m_position = valueEnd + 1;
+    valueEnd = Decode(valueBegin, valueEnd, true);
+    return XmlNodeView{
+        XmlNodeType::Attribute,
+        name,
+        XmlStringView{valueBegin, static_cast<size_t>(valueEnd - valueBegin)}};
+  }
+
+  XmlNodeView XmlPullReader::ReadEndTag()
+  {
+    m_position += 2;
+    const XmlStringView name = ReadName();
+    while (m_position != m_end && IsXmlWhitespace(*m_position))
+    {
+      ++m_position;
+    }
+    if (m_position == m_end)
+    {
+      OnEndOfData();
+    }
+    if (*m_position != '>' || m_openTagLengths.empty() || m_openTagLengths.back() != name.Length
+        || std::memcmp(
+               m_openTagNames.data() + m_openTagNames.size() - name.Length,
+               name.Data,
+               name.Length)
+            != 0)
+    {
+      ThrowXmlParseError();
+    }
+    ++m_position;
+    m_openTagNames.resize(m_openTagNames.size() - name.Length);
+    m_openTagLengths.pop_back();
+    return XmlNodeView{XmlNodeType::EndTag, XmlStringView(), XmlStringView()};
+  }
+
+  const char* XmlPullReader::SkipPast(const char* terminator)
+  {
+    const size_t length = std::strlen(terminator);
+    for (char* position = m_position; position != m_end; ++position)
+    {
+      if (StartsWith(position, m_end, terminator))
+      {
+        m_position = position + length;
+        return position;
+      }
+    }
+    OnEndOfData();
+  }
+
+  void XmlPullReader::OnEndOfData() const
+  {
+    if (!m_isComplete)
+    {
+      throw EndOfData();
+    }
+    ThrowXmlParseError();
+  }
+
+  void XmlPullReader::Fill(const Core::Context& context)
+  {
+    const size_t remaining = static_cast<size_t>(m_end - m_position);
+    if (m_position != m_buffer.data())
+    {
+      std::memmove(m_buffer.data(), m_position, remaining);
+    }
+    // Grows the buffer when a node fills more than half of it.
+    if (remaining > m_buffer.size() / 2)
+    {
+      m_buffer.resize(m_buffer.size() * 2);
+    }
+    // Waits for half of the free space to be filled, or for the end of the stream, so that the node
+    // is not read again for each small chunk of the stream.
+    const size_t freeSpace = m_buffer.size() - remaining;
+    size_t bytesRead = 0;
+    m_isComplete = false;
+    while (bytesRead < freeSpace / 2)
+    {
+      const size_t chunkSize = m_stream->Read(
+          reinterpret_cast<uint8_t*>(m_buffer.data() + remaining + bytesRead),
+          freeSpace - bytesRead,
+          context);
+      if (chunkSize == 0)
+      {
+        m_isComplete = true;
+        break;
+      }
+      bytesRead += chunkSize;
+    }
+    m_position = m_buffer.data();
+    m_end = m_position + remaining + bytesRead;
+  }
+
+  char* XmlPullReader::Decode(char* begin, char* end, bool isAttribute)
+  {
+    char* output = begin;
+    for (char* input = begin; input != end;)
+    {
+      const char c = *input;
+      if (c == '&')
+      {
+        char* semicolon
+            = static_cast<char*>(std::memchr(input, ';', static_cast<size_t>(end - input)));
+        if (semicolon == nullptr)
+        {
+          ThrowXmlParseError();
+        }
+        const char* entity = input + 1;
+        const size_t entityLength = static_cast<size_t>(semicolon - entity);
+        if (IsEntity(entity, entityLength, "lt"))
+        {
+          *output++ = '<';
+        }
+        else if (IsEntity(entity, entityLength, "gt"))
+        {
+          *output++ = '>';
+        }
+        else if (IsEntity(entity, entityLength, "amp"))
+        {
+          *output++ = '&';
+        }
+        else if (IsEntity(entity, entityLength, "quot"))
+        {
+          *output++ = '"';
+        }
+        else if (IsEntity(entity, entityLength, "apos"))
+        {
+          *output++ = '\'';
+        }
+        else if (entityLength >= 2 && entity[0] == '#')
+        {
+          const bool isHex = entity[1] == 'x';
+          const size_t digitsBegin = isHex ? 2 : 1;
+          uint32_t codePoint = 0;
+          for (size_t i = digitsBegin; i < entityLength; ++i)
+          {
+            const char digit = entity[i];
+            uint32_t value;
+            if (digit >= '0' && digit <= '9')
+            {
+              value = static_cast<uint32_t>(digit - '0');
+            }
+            else if (isHex && digit >= 'a' && digit <= 'f')
+            {
+              value = static_cast<uint32_t>(digit - 'a' + 10);
+            }
+            else if (isHex && digit >= 'A' && digit <= 'F')
+            {
+              value = static_cast<uint32_t>(digit - 'A' + 10);
+            }
+            else
+            {
+              ThrowXmlParseError();
+            }
+            codePoint = codePoint * (isHex ? 16 : 10) + value;
+            if (codePoint > 0x10FFFF)
+            {
+              ThrowXmlParseError();
+            }
+          }
+          if (entityLength == digitsBegin || codePoint == 0
+              || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+          {
+            ThrowXmlParseError();
+          }
+          // The reference is longer than the UTF-8 sequence it stands for.
+          output = AppendUtf8(output, codePoint);
+        }
+        else
+        {
+          ThrowXmlParseError();
+        }
+        input = semicolon + 1;
+      }
+      else if (c == '\r')
+      {
+        *output++ = isAttribute ? ' ' : '\n';
+        ++input;
+        if (input != end && *input == '\n')
+        {
+          ++input;
+        }
+      }
+      else if (isAttribute && (c == '\n' || c == '\t'))
+      {
+        *output++ = ' ';
+        ++input;
+      }
+      else
+      {
+        *output++ = *input++;
+      }
+    }
+    return output;
+  }
+
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    constexpr int64_t MB = 1024 * 1024;
+  }
+
+  TEST(TransferTunerTest, ChunkSize)
+  {
+    _internal::TransferTuner tuner(4 * MB, 1 * MB, 16 * MB, 1);
+    EXPECT_EQ(tuner.GetChunkSize(), 4 * MB);
+
+    auto now = std::chrono::steady_clock::now();
+    // Fast chunks grow, up to the maximum.
+    tuner.OnChunkTransferred(4 * MB, now, now + std::chrono::milliseconds(100));
+    EXPECT_EQ(tuner.GetChunkSize(), 8 * MB);
+    tuner.OnChunkTransferred(8 * MB, now, now + std::chrono::milliseconds(100));
+    EXPECT_EQ(tuner.GetChunkSize(), 16 * MB);
+    tuner.OnChunkTransferred(16 * MB, now, now + std::chrono::milliseconds(100));
+    EXPECT_EQ(tuner.GetChunkSize(), 16 * MB);
+    // A small last chunk does not count.
+    _internal::TransferTuner tailTuner(4 * MB, 1 * MB, 16 * MB, 1);
+    tailTuner.OnChunkTransferred(1 * MB, now, now + std::chrono::milliseconds(100));
+    EXPECT_EQ(tailTuner.GetChunkSize(), 4 * MB);
+
+    // Slow chunks shrink, down to the minimum.
+    tuner.OnChunkTransferred(16 * MB, now, now + std::chrono::seconds(5));
+    EXPECT_EQ(tuner.GetChunkSize(), 8 * MB);
+    tuner.OnChunkTransferred(8 * MB, now, now + std::chrono::seconds(5));
+    tuner.OnChunkTransferred(4 * MB, now, now + std::chrono::seconds(5));
+    tuner.OnChunkTransferred(2 * MB, now, now + std::chrono::seconds(5));
+    tuner.OnChunkTransferred(1 * MB, now, now + std::chrono::seconds(5));
+    EXPECT_EQ(tuner.GetChunkSize(), 1 * MB);
+
+    // The initial chunk size is bounded too.
+    EXPECT_EQ(_internal::TransferTuner(64 * MB, 1 * MB, 16 * MB, 1).GetChunkSize(), 16 * MB);
+    EXPECT_EQ(_internal::TransferTuner(1024, 1 * MB, 16 * MB, 1).GetChunkSize(), 1 * MB);
+  }
+
+  TEST(TransferTunerTest, Concurrency)
+  {
+    _internal::TransferTuner tuner(1 * MB, 1 * MB, 1 * MB, 8);
+    EXPECT_EQ(tuner.GetConcurrency(), 1);
+
+    auto now = std::chrono::steady_clock::now();
+    auto transferRound = [&](int numChunks, std::chrono::milliseconds duration) {
+      auto startedOn = now;
+      now += duration;
+      for (int i = 0; i < numChunks; ++i)
+      {
+        tuner.OnChunkTransferred(1 * MB, startedOn, now);
+      }
+    };
+
+    // 1 MB/s, then 2 MB/s: the concurrency doubles while the throughput improves.
+    transferRound(1, std::chrono::milliseconds(1000));
+    EXPECT_EQ(tuner.GetConcurrency(), 2);
+    transferRound(2, std::chrono::milliseconds(1000));
+    EXPECT_EQ(tuner.GetConcurrency(), 4);
+    // Still 2 MB/s: back to the previous concurrency.
+    transferRound(4, std::chrono::milliseconds(2000));
+    EXPECT_EQ(tuner.GetConcurrency(), 2);
+    // 2.2 MB/s: grows by one.
+    transferRound(2, std::chrono::milliseconds(900));
+    EXPECT_EQ(tuner.GetConcurrency(), 3);
+    // About the same throughput: no change.
+    transferRound(3, std::chrono::milliseconds(1400));
+    EXPECT_EQ(tuner.GetConcurrency(), 3);
+    // 1 MB/s: drops.
+    transferRound(3, std::chrono::milliseconds(3000));
+    EXPECT_EQ(tuner.GetConcurrency(), 2);
+  }
+
+  TEST(TransferTunerTest, AdaptiveConcurrentTransfer)
+  {
+    const int64_t offset = 10;
+    const int64_t length = 10 * MB + 123;
+    auto executor = std::make_shared<WorkStealingTransferExecutor>(4);
+
+    std::mutex mutex;
+    std::map<int64_t, std::pair<int64_t, int64_t>> chunks;
+    std::vector<int64_t> numChunksReceived;
+    _internal::AdaptiveConcurrentTransfer(
+        offset,
+        length,
+        1 * MB,
+        1 * MB,
+        4 * MB,
+        4,
+        [&](int64_t chunkOffset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+          std::lock_guard<std::mutex> lock(mutex);
+          EXPECT_TRUE(chunks.emplace(chunkId, std::make_pair(chunkOffset, chunkLength)).second);
+          numChunksReceived.push_back(numChunks);
+        },
+        executor);
+
+    // The chunks cover the range, in the order of their ID.
+    int64_t nextOffset = offset;
+    int64_t nextChunkId = 0;
+    for (const auto& chunk : chunks)
+    {
+      EXPECT_EQ(chunk.first, nextChunkId++);
+      EXPECT_EQ(chunk.second.first, nextOffset);
+      EXPECT_GT(chunk.second.second, 0);
+      EXPECT_LE(chunk.second.second, 4 * MB);
+      nextOffset += chunk.second.second;
+    }
+    EXPECT_EQ(nextOffset, offset + length);
+
+    // Only the last chunk knows the number of chunks.
+    const auto numChunks = static_cast<int64_t>(chunks.size());
+    EXPECT_EQ(std::count(numChunksReceived.begin(), numChunksReceived.end(), numChunks), 1);
+    EXPECT_EQ(std::count(numChunksReceived.begin(), numChunksReceived.end(), -1), numChunks - 1);
+  }
+
+  TEST(TransferTunerTest, AdaptiveConcurrentTransferFailure)
+  {
+    EXPECT_THROW(
+        _internal::AdaptiveConcurrentTransfer(
+            0,
+            100,
+            1,
+            1,
+            1,
+            3,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+            },
+            nullptr),
+        std::runtime_error);
+  }
+
+}}} // namespace Azure::Storage::Test
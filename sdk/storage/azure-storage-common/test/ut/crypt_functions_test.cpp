@@ -31,6 +31,29 @@ namespace Azure { namespace Storage { namespace Test {
         "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
   }
 
+  TEST_F(CryptFunctionsTest, Md5)
+  {
+    EXPECT_EQ(
+        Azure::Core::Convert::Base64Encode(_internal::Md5(nullptr, 0)),
+        "1B2M2Y8AsgTpgAmY7PhCfg==");
+    // The context of the thread is reused.
+    for (int i = 0; i < 2; ++i)
+    {
+      const auto data = ToBinaryVector("Hello Azure!");
+      EXPECT_EQ(
+          _internal::Md5(data.data(), data.size()),
+          Azure::Core::Cryptography::Md5Hash().Final(data.data(), data.size()));
+    }
+
+    const auto data = RandomBuffer(1024 * 1024 + 3);
+    auto hash = _internal::ComputeContentHash(data.data(), data.size(), HashAlgorithm::Md5);
+    EXPECT_EQ(hash.Algorithm, HashAlgorithm::Md5);
+    EXPECT_EQ(hash.Value, Azure::Core::Cryptography::Md5Hash().Final(data.data(), data.size()));
+    hash = _internal::ComputeContentHash(data.data(), data.size(), HashAlgorithm::Crc64);
+    EXPECT_EQ(hash.Algorithm, HashAlgorithm::Crc64);
+    EXPECT_EQ(hash.Value, Crc64Hash().Final(data.data(), data.size()));
+  }
+
   static std::vector<uint8_t> ComputeHash(const std::string& data)
   {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
@@ -114,6 +137,40 @@ namespace Azure { namespace Storage { namespace Test {
         crc64Single.Final(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST_F(CryptFunctionsTest, Crc64Hash_Implementations)
+  {
+    using _detail::Crc64Implementation;
+
+    auto data = RandomBuffer(static_cast<size_t>(1_MB + 4096));
+    for (auto implementation :
+         {Crc64Implementation::CarrylessMultiply, Crc64Implementation::VectorCarrylessMultiply})
+    {
+      if (!_detail::IsCrc64ImplementationSupported(implementation))
+      {
+        continue;
+      }
+      // All the alignments, and the lengths around the block sizes of the implementations.
+      for (size_t offset = 0; offset < 64; ++offset)
+      {
+        for (size_t length = 0; length < 1100; length += (offset == 0 ? 1 : 37))
+        {
+          const uint64_t crc = static_cast<uint64_t>(RandomInt(0, 1_MB)) * 0x9E3779B97F4A7C15ULL;
+          EXPECT_EQ(
+              _detail::Crc64Append(crc, &data[offset], length, implementation),
+              _detail::Crc64Append(
+                  crc, &data[offset], length, Crc64Implementation::LookupTable));
+        }
+      }
+      EXPECT_EQ(
+          _detail::Crc64Append(0, data.data(), data.size(), implementation),
+          _detail::Crc64Append(0, data.data(), data.size(), Crc64Implementation::LookupTable));
+      EXPECT_EQ(
+          _detail::Crc64Append(0, &data[3], data.size() - 3, implementation),
+          _detail::Crc64Append(
+              0, &data[3], data.size() - 3, Crc64Implementation::LookupTable));
+    }
+  }
+
   TEST_F(CryptFunctionsTest, Crc64Hash_CtorDtor)
   {
     {
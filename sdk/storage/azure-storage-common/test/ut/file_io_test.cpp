@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::vector<uint8_t> MakeContent(size_t length)
+    {
+      std::vector<uint8_t> content(length);
+      for (size_t i = 0; i < length; ++i)
+      {
+        content[i] = static_cast<uint8_t>(i * 7 + i / 251);
+      }
+      return content;
+    }
+
+    std::vector<uint8_t> ReadFileContent(const std::string& fileName)
+    {
+      std::ifstream f(fileName, std::ifstream::binary);
+      return std::vector<uint8_t>(
+          std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+
+    void WriteFileContent(const std::string& fileName, const std::vector<uint8_t>& content)
+    {
+      std::ofstream f(fileName, std::ofstream::binary);
+      f.write(reinterpret_cast<const char*>(content.data()), content.size());
+    }
+  } // namespace
+
+  TEST(FileIoTest, MappedFileWriter)
+  {
+    const std::string fileName = "FileIoTest.MappedFileWriter";
+    const auto content = MakeContent(3 * 1024 * 1024 + 123);
+    {
+      _internal::MappedFileWriter writer(fileName, static_cast<int64_t>(content.size()));
+      EXPECT_EQ(writer.GetFileSize(), static_cast<int64_t>(content.size()));
+      // Written out of order, like concurrently downloaded chunks.
+      const size_t half = content.size() / 2;
+      std::copy(content.begin() + half, content.end(), writer.GetData() + half);
+      std::copy(content.begin(), content.begin() + half, writer.GetData());
+    }
+    EXPECT_EQ(ReadFileContent(fileName), content);
+
+    // An existing file is truncated.
+    {
+      _internal::MappedFileWriter writer(fileName, 0);
+      EXPECT_EQ(writer.GetData(), nullptr);
+    }
+    EXPECT_TRUE(ReadFileContent(fileName).empty());
+    std::remove(fileName.data());
+  }
+
+  TEST(FileIoTest, MappedFileReader)
+  {
+    const std::string fileName = "FileIoTest.MappedFileReader";
+    const auto content = MakeContent(1024 * 1024 + 45);
+    WriteFileContent(fileName, content);
+    {
+      _internal::MappedFileReader reader(fileName);
+      ASSERT_EQ(reader.GetFileSize(), static_cast<int64_t>(content.size()));
+      EXPECT_TRUE(std::equal(content.begin(), content.end(), reader.GetData()));
+    }
+
+    WriteFileContent(fileName, std::vector<uint8_t>());
+    {
+      _internal::MappedFileReader reader(fileName);
+      EXPECT_EQ(reader.GetFileSize(), 0);
+      EXPECT_EQ(reader.GetData(), nullptr);
+    }
+    std::remove(fileName.data());
+
+    EXPECT_THROW(_internal::MappedFileReader{fileName}, std::runtime_error);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/transfer_buffer_pool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    constexpr size_t KB = 1024;
+    constexpr size_t MB = 1024 * 1024;
+  } // namespace
+
+  TEST(TransferBufferPoolTest, SizeClasses)
+  {
+    TransferBufferPool pool(64 * MB, 64 * MB);
+    {
+      auto buffer = pool.Acquire(10);
+      EXPECT_NE(buffer.GetData(), nullptr);
+      EXPECT_EQ(buffer.GetSize(), 10U);
+      EXPECT_EQ(pool.GetStatistics().BytesInUse, 64 * KB);
+    }
+    {
+      // 4 MB + 1 is in the 5 MB class.
+      auto buffer = pool.Acquire(4 * MB + 1);
+      EXPECT_EQ(pool.GetStatistics().BytesInUse, 5 * MB);
+    }
+    {
+      // Reuses the 5 MB buffer.
+      auto buffer = pool.Acquire(5 * MB);
+      auto stats = pool.GetStatistics();
+      EXPECT_EQ(stats.BytesInUse, 5 * MB);
+      EXPECT_EQ(stats.BytesIdle, 64 * KB);
+      EXPECT_EQ(stats.AllocationCount, 2U);
+      EXPECT_EQ(stats.ReuseCount, 1U);
+    }
+    auto stats = pool.GetStatistics();
+    EXPECT_EQ(stats.BytesInUse, 0U);
+    EXPECT_EQ(stats.BytesIdle, 5 * MB + 64 * KB);
+    EXPECT_EQ(stats.PeakBytesInUse, 5 * MB);
+    EXPECT_EQ(stats.PeakBytesAllocated, 5 * MB + 64 * KB);
+  }
+
+  TEST(TransferBufferPoolTest, IdleBuffers)
+  {
+    TransferBufferPool pool(16 * MB, 2 * MB);
+    {
+      auto buffer1 = pool.Acquire(1 * MB);
+      auto buffer2 = pool.Acquire(1 * MB);
+      auto buffer3 = pool.Acquire(1 * MB);
+    }
+    // Only 2 MB are kept.
+    EXPECT_EQ(pool.GetStatistics().BytesIdle, 2 * MB);
+
+    // The idle buffers are freed to make room for buffers of another size class.
+    {
+      auto buffer = pool.Acquire(15 * MB);
+      auto stats = pool.GetStatistics();
+      // 15 MB is in the 16 MB class.
+      EXPECT_EQ(stats.BytesInUse, 16 * MB);
+      EXPECT_EQ(stats.BytesIdle, 0U);
+    }
+
+    // Moving a buffer moves its ownership.
+    auto buffer1 = pool.Acquire(1 * MB);
+    auto data = buffer1.GetData();
+    TransferBufferPool::Buffer buffer2;
+    buffer2 = std::move(buffer1);
+    EXPECT_EQ(buffer2.GetData(), data);
+    EXPECT_EQ(pool.GetStatistics().BytesInUse, 1 * MB);
+    buffer2 = TransferBufferPool::Buffer();
+    EXPECT_EQ(pool.GetStatistics().BytesInUse, 0U);
+  }
+
+  TEST(TransferBufferPoolTest, MemoryBudget)
+  {
+    TransferBufferPool pool(4 * MB, 4 * MB);
+
+    // Larger than the budget, but nothing else is lent.
+    {
+      auto buffer = pool.Acquire(8 * MB);
+      EXPECT_EQ(pool.GetStatistics().BytesInUse, 8 * MB);
+    }
+
+    std::vector<TransferBufferPool::Buffer> buffers;
+    for (int i = 0; i < 4; ++i)
+    {
+      buffers.push_back(pool.Acquire(1 * MB));
+    }
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&]() {
+      auto buffer = pool.Acquire(1 * MB);
+      acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(acquired.load());
+    buffers.pop_back();
+    waiter.join();
+    EXPECT_TRUE(acquired.load());
+
+    auto stats = pool.GetStatistics();
+    EXPECT_EQ(stats.WaitCount, 1U);
+    EXPECT_EQ(stats.PeakBytesInUse, 8 * MB);
+    EXPECT_LE(stats.BytesInUse + stats.BytesIdle, 4 * MB);
+  }
+
+  TEST(TransferBufferPoolTest, CancelWait)
+  {
+    TransferBufferPool pool(1 * MB, 1 * MB);
+    auto buffer = pool.Acquire(1 * MB);
+
+    // The wait is cancelled with the context.
+    Azure::Core::Context context;
+    auto waiter = std::async(std::launch::async, [&]() { return pool.Acquire(1 * MB, context); });
+    EXPECT_EQ(waiter.wait_for(std::chrono::milliseconds(200)), std::future_status::timeout);
+    context.Cancel();
+    EXPECT_THROW(waiter.get(), Azure::Core::OperationCancelledException);
+
+    // And when its deadline passes.
+    auto deadlineContext = Azure::Core::Context().WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(200));
+    EXPECT_THROW(pool.Acquire(1 * MB, deadlineContext), Azure::Core::OperationCancelledException);
+
+    // A cancelled context doesn't prevent getting a buffer without waiting.
+    EXPECT_EQ(pool.GetStatistics().BytesInUse, 1 * MB);
+    buffer = TransferBufferPool::Buffer();
+    EXPECT_NE(pool.Acquire(1 * MB, context).GetData(), nullptr);
+    EXPECT_EQ(pool.GetStatistics().WaitCount, 2U);
+  }
+
+  TEST(TransferBufferPoolTest, OutlivesPool)
+  {
+    TransferBufferPool::Buffer buffer;
+    {
+      TransferBufferPool pool(4 * MB, 4 * MB);
+      buffer = pool.Acquire(1 * MB);
+    }
+    buffer.GetData()[0] = 1;
+    EXPECT_NE(TransferBufferPool::GetDefault(), nullptr);
+    EXPECT_EQ(TransferBufferPool::GetDefault(), TransferBufferPool::GetDefault());
+  }
+
+}}} // namespace Azure::Storage::Test
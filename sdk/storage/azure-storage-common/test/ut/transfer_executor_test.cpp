@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+#include <azure/storage/common/transfer_executor.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferExecutorTest, ConcurrentTransferChunks)
+  {
+    const int64_t offset = 100;
+    const int64_t length = 1000;
+    const int64_t chunkSize = 64;
+    const int64_t expectedNumChunks = (length + chunkSize - 1) / chunkSize;
+
+    for (auto executor : std::vector<std::shared_ptr<TransferExecutor>>{
+             nullptr, std::make_shared<WorkStealingTransferExecutor>(3)})
+    {
+      std::mutex mutex;
+      std::vector<int> transferred(static_cast<size_t>(length));
+      std::vector<int> chunkIds;
+      _internal::ConcurrentTransfer(
+          offset,
+          length,
+          chunkSize,
+          4,
+          [&](int64_t chunkOffset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_EQ(numChunks, expectedNumChunks);
+            EXPECT_EQ(chunkOffset, offset + chunkId * chunkSize);
+            for (int64_t i = chunkOffset; i < chunkOffset + chunkLength; ++i)
+            {
+              ++transferred[static_cast<size_t>(i - offset)];
+            }
+            chunkIds.push_back(static_cast<int>(chunkId));
+          },
+          executor);
+
+      EXPECT_TRUE(
+          std::all_of(transferred.begin(), transferred.end(), [](int n) { return n == 1; }));
+      std::sort(chunkIds.begin(), chunkIds.end());
+      ASSERT_EQ(chunkIds.size(), static_cast<size_t>(expectedNumChunks));
+      for (size_t i = 0; i < chunkIds.size(); ++i)
+      {
+        EXPECT_EQ(chunkIds[i], static_cast<int>(i));
+      }
+    }
+  }
+
+  TEST(TransferExecutorTest, ConcurrentTransferFailure)
+  {
+    auto executor = std::make_shared<WorkStealingTransferExecutor>(2);
+    std::atomic<int> numTransferred{0};
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            100,
+            1,
+            3,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+              ++numTransferred;
+            },
+            executor),
+        std::runtime_error);
+    // The other chunks are not transferred once one of them failed.
+    EXPECT_LT(numTransferred.load(), 99);
+  }
+
+  TEST(TransferExecutorTest, NestedConcurrentTransfers)
+  {
+    // The transfers run from the only thread of the executor do not wait for it.
+    auto executor = std::make_shared<WorkStealingTransferExecutor>(1);
+    std::atomic<int> numTransferred{0};
+    _internal::ConcurrentTransfer(
+        0,
+        4,
+        1,
+        4,
+        [&](int64_t, int64_t, int64_t, int64_t) {
+          _internal::ConcurrentTransfer(
+              0, 4, 1, 4, [&](int64_t, int64_t, int64_t, int64_t) { ++numTransferred; }, executor);
+        },
+        executor);
+    EXPECT_EQ(numTransferred.load(), 16);
+  }
+
+  TEST(TransferExecutorTest, MaxThreads)
+  {
+    std::mutex mutex;
+    std::condition_variable allDone;
+    int numRunning = 0;
+    int maxRunning = 0;
+    int numDone = 0;
+    const int numTasks = 16;
+
+    // Destroyed first, so that its threads are done with the task state.
+    auto executor = std::make_shared<WorkStealingTransferExecutor>(2);
+    for (int i = 0; i < numTasks; ++i)
+    {
+      executor->Submit([&]() {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          maxRunning = (std::max)(maxRunning, ++numRunning);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::lock_guard<std::mutex> lock(mutex);
+        --numRunning;
+        ++numDone;
+        allDone.notify_all();
+      });
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [&]() { return numDone == numTasks; });
+    EXPECT_LE(maxRunning, 2);
+  }
+
+  TEST(TransferExecutorTest, DestroyedByTask)
+  {
+    std::promise<void> released;
+    std::shared_future<void> releasedFuture = released.get_future().share();
+    auto executor = std::make_shared<WorkStealingTransferExecutor>(2);
+    std::weak_ptr<WorkStealingTransferExecutor> weakExecutor = executor;
+
+    // The task holds the last reference to the executor, which is destroyed on its thread.
+    executor->Submit([executor, releasedFuture]() { releasedFuture.wait(); });
+    executor.reset();
+    released.set_value();
+    for (int i = 0; i < 500 && !weakExecutor.expired(); ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_TRUE(weakExecutor.expired());
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,362 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::string ToString(_internal::XmlNodeType type)
+    {
+      switch (type)
+      {
+        case _internal::XmlNodeType::StartTag:
+          return "StartTag";
+        case _internal::XmlNodeType::EndTag:
+          return "EndTag";
+        case _internal::XmlNodeType::Text:
+          return "Text";
+        case _internal::XmlNodeType::Attribute:
+          return "Attribute";
+        default:
+          return "End";
+      }
+    }
+
+    std::vector<std::string> ReadAll(_internal::XmlReader& reader)
+    {
+      std::vector<std::string> nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        // XmlReader reports the attributes of the elements again after their end tag.
+        if (node.Type == _internal::XmlNodeType::Attribute && !nodes.empty()
+            && nodes.back().compare(0, 6, "EndTag") == 0)
+        {
+          while (node.Type == _internal::XmlNodeType::Attribute)
+          {
+            node = reader.Read();
+          }
+        }
+        nodes.push_back(ToString(node.Type) + " " + node.Name + " " + node.Value);
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          return nodes;
+        }
+      }
+    }
+
+    // Returns at most a given number of bytes per read.
+    class ChunkedBodyStream final : public Core::IO::BodyStream {
+    public:
+      ChunkedBodyStream(const std::string& data, size_t chunkSize)
+          : m_data(data), m_chunkSize(chunkSize)
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_data.size()); }
+
+      void Rewind() override { m_offset = 0; }
+
+    private:
+      size_t OnRead(uint8_t* buffer, size_t count, const Core::Context&) override
+      {
+        count = (std::min)({count, m_chunkSize, m_data.size() - m_offset});
+        std::copy(m_data.begin() + m_offset, m_data.begin() + m_offset + count, buffer);
+        m_offset += count;
+        return count;
+      }
+
+      const std::string& m_data;
+      size_t m_chunkSize;
+      size_t m_offset = 0;
+    };
+
+    std::vector<std::string> ReadAll(_internal::XmlPullReader& reader, bool isStream = false)
+    {
+      std::vector<std::string> nodes;
+      while (true)
+      {
+        auto node = isStream ? reader.Read(Core::Context()) : reader.Read();
+        nodes.push_back(
+            ToString(node.Type) + " " + std::string(node.Name) + " " + std::string(node.Value));
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          return nodes;
+        }
+      }
+    }
+
+    std::vector<std::string> PullAll(std::string document)
+    {
+      _internal::XmlPullReader reader(&document[0], document.size());
+      return ReadAll(reader);
+    }
+
+    std::vector<std::string> PullAll(const std::string& document, size_t chunkSize)
+    {
+      ChunkedBodyStream stream(document, chunkSize);
+      _internal::XmlPullReader reader(stream);
+      return ReadAll(reader, true);
+    }
+  } // namespace
+
+  TEST(XmlTest, PullReaderMatchesReader)
+  {
+    // cspell:disable
+    const std::string document = "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n"
+                                 "<EnumerationResults ServiceEndpoint=\"https://a.blob.core/\" "
+                                 "ContainerName='c&amp;1'>\r\n"
+                                 "  <Prefix />\n"
+                                 "  <Blobs>\n"
+                                 "    <Blob>\n"
+                                 "      <Name Encoded=\"true\">"
+                                 "a%2Fb &lt;&#65;&#x42;&#xe9;&gt;</Name>\n"
+                                 "      <Properties><Etag>0x8D</Etag><Content-Length>1024"
+                                 "</Content-Length></Properties>\n"
+                                 "      <Metadata><key1>line1\r\nline2</key1><key3></key3>"
+                                 "</Metadata>\n"
+                                 "    </Blob>\n"
+                                 "  </Blobs>\n"
+                                 "  <NextMarker>&quot;m&apos;</NextMarker>\n"
+                                 "</EnumerationResults>\n";
+    // cspell:enable
+
+    _internal::XmlReader reader(document.data(), document.size());
+    const auto expected = ReadAll(reader);
+    const auto nodes = PullAll(document);
+    EXPECT_EQ(nodes, expected);
+
+    EXPECT_EQ(nodes[1], "Attribute ServiceEndpoint https://a.blob.core/");
+    EXPECT_EQ(nodes[2], "Attribute ContainerName c&1");
+    EXPECT_NE(
+        std::find(nodes.begin(), nodes.end(), "Text  a%2Fb <AB\xC3\xA9>"), // cspell:disable-line
+        nodes.end());
+    EXPECT_NE(std::find(nodes.begin(), nodes.end(), "Text  line1\nline2"), nodes.end());
+  }
+
+  TEST(XmlTest, PullReaderWhitespaceAndCData)
+  {
+    // Whitespace is only content when it is the whole content of an element.
+    EXPECT_EQ(
+        PullAll("<a> <b> </b> <!-- c --> <![CDATA[<x>]]></a>"),
+        (std::vector<std::string>{
+            "StartTag a ",
+            "StartTag b ",
+            "Text   ",
+            "EndTag  ",
+            "Text  <x>",
+            "EndTag  ",
+            "End  "}));
+  }
+
+  TEST(XmlTest, PullReaderStream)
+  {
+    // cspell:disable
+    std::string document = "\xEF\xBB\xBF<?xml version=\"1.0\"?>\r\n"
+                           "<EnumerationResults a=\"x > y\" b = 'c&amp;1'>\r\n"
+                           "  <!-- comment -->\n"
+                           "  <Blobs>\n"
+                           "    <Blob><Name Encoded=\"true\">a &lt;&#65;&#xe9;&gt;</Name>"
+                           "<Empty /><Space> </Space><Data><![CDATA[<x>]]></Data></Blob>\n"
+                           "    <Blob><Name>";
+    // cspell:enable
+    // Longer than the initial buffer of the reader.
+    document += std::string(200 * 1024, 'n') + "</Name></Blob>\n";
+    document += "  </Blobs >\n</EnumerationResults>\n";
+    const auto expected = PullAll(document);
+    for (size_t chunkSize : {1, 2, 3, 7, 64, 4096, 1024 * 1024})
+    {
+      EXPECT_EQ(PullAll(document, chunkSize), expected) << chunkSize;
+    }
+    EXPECT_EQ(PullAll("<a/>", 1), PullAll("<a/>"));
+  }
+
+  TEST(XmlTest, PullReaderInvalidDocuments)
+  {
+    for (const std::string document : {
+             "",
+             " ",
+             "<a>",
+             "<a></b>",
+             "<a></a><b></b>",
+             "text<a></a>",
+             "<a>&unknown;</a>",
+             "<a>&#0;</a>",
+             "<a>&#x110000;</a>",
+             "<a>&amp</a>",
+             "<a b=c></a>",
+             "<a b=\"c></a>",
+             "<!DOCTYPE a><a></a>",
+             "<a><!-- </a>",
+         })
+    {
+      EXPECT_THROW(PullAll(document), std::runtime_error) << document;
+      EXPECT_THROW(PullAll(document, 1), std::runtime_error) << document;
+    }
+  }
+
+  TEST(XmlTest, TagMap)
+  {
+    enum class Tag
+    {
+      Unknown,
+      EnumerationResults,
+      Prefix,
+      Blob,
+      Name,
+      ContentLength,
+    };
+    const _internal::XmlTagMap<Tag> tags{
+        {"EnumerationResults", Tag::EnumerationResults},
+        {"Prefix", Tag::Prefix},
+        {"Blob", Tag::Blob},
+        {"Name", Tag::Name},
+        {"Content-Length", Tag::ContentLength},
+    };
+    EXPECT_EQ(tags.Find(std::string("EnumerationResults")), Tag::EnumerationResults);
+    EXPECT_EQ(tags.Find(std::string("Prefix")), Tag::Prefix);
+    EXPECT_EQ(tags.Find(std::string("Blob")), Tag::Blob);
+    EXPECT_EQ(tags.Find(std::string("Name")), Tag::Name);
+    EXPECT_EQ(tags.Find(std::string("Content-Length")), Tag::ContentLength);
+    EXPECT_EQ(tags.Find(std::string("Blobs")), Tag::Unknown);
+    EXPECT_EQ(tags.Find(std::string("")), Tag::Unknown);
+    EXPECT_EQ(tags.Find(std::string("name")), Tag::Unknown);
+
+    // The tags of a list blobs response.
+    const std::vector<std::string> names{
+        "EnumerationResults",
+        "Prefix",
+        "NextMarker",
+        "Blobs",
+        "Blob",
+        "Name",
+        "Deleted",
+        "Snapshot",
+        "VersionId",
+        "IsCurrentVersion",
+        "Properties",
+        "Creation-Time",
+        "Last-Modified",
+        "Etag",
+        "x-ms-blob-sequence-number",
+        "LeaseStatus",
+        "LeaseState",
+        "LeaseDuration",
+        "CopyId",
+        "CopyStatus",
+        "CopySource",
+        "CopyProgress",
+        "CopyCompletionTime",
+        "CopyStatusDescription",
+        "ServerEncrypted",
+        "IncrementalCopy",
+        "CopyDestinationSnapshot",
+        "DeletedTime",
+        "RemainingRetentionDays",
+        "AccessTier",
+        "AccessTierInferred",
+        "ArchiveStatus",
+        "CustomerProvidedKeySha256",
+        "EncryptionScope",
+        "AccessTierChangeTime",
+        "Expiry-Time",
+        "Sealed",
+        "RehydratePriority",
+        "LastAccessTime",
+        "LegalHold",
+        "Content-Type",
+        "Content-Encoding",
+        "Content-Language",
+        "Content-MD5",
+        "Content-Disposition",
+        "Cache-Control",
+        "Metadata",
+        "Tags",
+        "TagSet",
+        "Tag",
+        "Key",
+        "Value",
+        "OrMetadata",
+        "ImmutabilityPolicyUntilDate",
+        "ImmutabilityPolicyMode",
+        "HasVersionsOnly",
+        "Content-Length",
+        "BlobType",
+        "DeletionId",
+    };
+    const _internal::XmlTagMap<int> listBlobsTags{
+        {"EnumerationResults", 1},
+        {"Prefix", 2},
+        {"NextMarker", 3},
+        {"Blobs", 4},
+        {"Blob", 5},
+        {"Name", 6},
+        {"Deleted", 7},
+        {"Snapshot", 8},
+        {"VersionId", 9},
+        {"IsCurrentVersion", 10},
+        {"Properties", 11},
+        {"Creation-Time", 12},
+        {"Last-Modified", 13},
+        {"Etag", 14},
+        {"x-ms-blob-sequence-number", 15},
+        {"LeaseStatus", 16},
+        {"LeaseState", 17},
+        {"LeaseDuration", 18},
+        {"CopyId", 19},
+        {"CopyStatus", 20},
+        {"CopySource", 21},
+        {"CopyProgress", 22},
+        {"CopyCompletionTime", 23},
+        {"CopyStatusDescription", 24},
+        {"ServerEncrypted", 25},
+        {"IncrementalCopy", 26},
+        {"CopyDestinationSnapshot", 27},
+        {"DeletedTime", 28},
+        {"RemainingRetentionDays", 29},
+        {"AccessTier", 30},
+        {"AccessTierInferred", 31},
+        {"ArchiveStatus", 32},
+        {"CustomerProvidedKeySha256", 33},
+        {"EncryptionScope", 34},
+        {"AccessTierChangeTime", 35},
+        {"Expiry-Time", 36},
+        {"Sealed", 37},
+        {"RehydratePriority", 38},
+        {"LastAccessTime", 39},
+        {"LegalHold", 40},
+        {"Content-Type", 41},
+        {"Content-Encoding", 42},
+        {"Content-Language", 43},
+        {"Content-MD5", 44},
+        {"Content-Disposition", 45},
+        {"Cache-Control", 46},
+        {"Metadata", 47},
+        {"Tags", 48},
+        {"TagSet", 49},
+        {"Tag", 50},
+        {"Key", 51},
+        {"Value", 52},
+        {"OrMetadata", 53},
+        {"ImmutabilityPolicyUntilDate", 54},
+        {"ImmutabilityPolicyMode", 55},
+        {"HasVersionsOnly", 56},
+        {"Content-Length", 57},
+        {"BlobType", 58},
+        {"DeletionId", 59},
+    };
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+      EXPECT_EQ(listBlobsTags.Find(names[i]), static_cast<int>(i + 1));
+      EXPECT_EQ(listBlobsTags.Find(names[i] + "x"), 0);
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
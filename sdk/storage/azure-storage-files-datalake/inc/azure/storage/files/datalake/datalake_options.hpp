@@ -9,6 +9,8 @@
 #include <azure/core/nullable.hpp>
 #include <azure/storage/blobs/blob_options.hpp>
 #include <azure/storage/common/access_conditions.hpp>
+#include <azure/storage/common/transfer_buffer_pool.hpp>
+#include <azure/storage/common/transfer_executor.hpp>
 
 #include <cstdint>
 #include <memory>
@@ -977,6 +979,34 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
        * The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * If true, the source file is mapped into memory, so the chunks are sent straight from the
+       * mapped pages instead of being read into intermediate buffers. The file must not be
+       * truncated during the upload.
+       */
+      bool UseMemoryMappedFile = false;
+
+      /**
+       * If set, the hash of each chunk is computed with this algorithm on the transfer workers and
+       * sent with the chunk, for the service to verify its integrity. When uploading from a file
+       * that is not mapped into memory, the chunks are read into buffers borrowed from BufferPool
+       * to be hashed, and a file larger than a chunk is always uploaded in blocks.
+       */
+      Azure::Nullable<HashAlgorithm> TransactionalHashAlgorithm;
+
+      /**
+       * The executor running the concurrent transfers. If null, an executor shared by the
+       * whole process, which bounds the number of threads used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferExecutor> Executor;
+
+      /**
+       * The pool lending the buffers the chunks are read into when uploading from a file with
+       * TransactionalHashAlgorithm. If null, a pool shared by the whole process, which bounds the
+       * memory used by all the transfers, is used.
+       */
+      std::shared_ptr<TransferBufferPool> BufferPool;
     } TransferOptions;
   };
 
@@ -260,6 +260,11 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         = options.TransferOptions.SingleUploadThreshold;
     blobOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
     blobOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+    blobOptions.TransferOptions.UseMemoryMappedFile = options.TransferOptions.UseMemoryMappedFile;
+    blobOptions.TransferOptions.Executor = options.TransferOptions.Executor;
+    blobOptions.TransferOptions.TransactionalHashAlgorithm
+        = options.TransferOptions.TransactionalHashAlgorithm;
+    blobOptions.TransferOptions.BufferPool = options.TransferOptions.BufferPool;
     blobOptions.HttpHeaders = options.HttpHeaders;
     blobOptions.Metadata = options.Metadata;
     return m_blobClient.AsBlockBlobClient().UploadFrom(fileName, blobOptions, context);
@@ -276,6 +281,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         = options.TransferOptions.SingleUploadThreshold;
     blobOptions.TransferOptions.ChunkSize = options.TransferOptions.ChunkSize;
     blobOptions.TransferOptions.Concurrency = options.TransferOptions.Concurrency;
+    blobOptions.TransferOptions.Executor = options.TransferOptions.Executor;
+    blobOptions.TransferOptions.TransactionalHashAlgorithm
+        = options.TransferOptions.TransactionalHashAlgorithm;
     blobOptions.HttpHeaders = options.HttpHeaders;
     blobOptions.Metadata = options.Metadata;
     return m_blobClient.AsBlockBlobClient().UploadFrom(buffer, bufferSize, blobOptions, context);
@@ -1074,4 +1074,35 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(DataLakeFileClientTest, UploadFromWithTransactionalHash_LIVEONLY_)
+  {
+    auto fileClient = m_fileSystemClient->GetFileClient(RandomString());
+    const auto fileContent = RandomBuffer(static_cast<size_t>(3_MB + 123));
+    const std::string tempFileName = RandomString();
+    WriteFile(tempFileName, fileContent);
+    for (auto hashAlgorithm : {HashAlgorithm::Md5, HashAlgorithm::Crc64})
+    {
+      for (bool useMemoryMappedFile : {false, true})
+      {
+        for (int64_t singleUploadThreshold : {int64_t(0), int64_t(64_MB)})
+        {
+          Files::DataLake::UploadFileFromOptions options;
+          options.TransferOptions.ChunkSize = 1_MB;
+          options.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+          options.TransferOptions.UseMemoryMappedFile = useMemoryMappedFile;
+          options.TransferOptions.TransactionalHashAlgorithm = hashAlgorithm;
+          fileClient.UploadFrom(tempFileName, options);
+          std::vector<uint8_t> downloadBuffer(fileContent.size());
+          fileClient.DownloadTo(downloadBuffer.data(), downloadBuffer.size());
+          EXPECT_EQ(downloadBuffer, fileContent);
+          fileClient.UploadFrom(fileContent.data(), fileContent.size(), options);
+          downloadBuffer.assign(fileContent.size(), 0);
+          fileClient.DownloadTo(downloadBuffer.data(), downloadBuffer.size());
+          EXPECT_EQ(downloadBuffer, fileContent);
+        }
+      }
+    }
+    DeleteFile(tempFileName);
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,442 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "list_files_and_directories.hpp"
+
+#include <azure/core/http/http.hpp>
+#include <azure/core/io/body_stream.hpp>
+#include <azure/storage/common/crypt.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+#include <azure/storage/common/storage_exception.hpp>
+
+namespace Azure { namespace Storage { namespace Files { namespace Shares { namespace _detail {
+
+  namespace {
+    std::string ListFilesIncludeFlagsToString(
+        const Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags& val)
+    {
+      const Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags valueList[] = {
+          Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags::Timestamps,
+          Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags::ETag,
+          Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags::Attributes,
+          Azure::Storage::Files::Shares::Models::ListFilesIncludeFlags::PermissionKey,
+      };
+      const char* stringList[] = {
+          "Timestamps",
+          "Etag",
+          "Attributes",
+          "PermissionKey",
+      };
+      std::string ret;
+      for (size_t i = 0; i < 4; ++i)
+      {
+        if ((val & valueList[i]) == valueList[i])
+        {
+          if (!ret.empty())
+          {
+            ret += ",";
+          }
+          ret += stringList[i];
+        }
+      }
+      return ret;
+    }
+  } // namespace
+
+  Response<Models::_detail::ListFilesAndDirectoriesSegmentResponse> ListFilesAndDirectoriesSegment(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const DirectoryClient::ListDirectoryFilesAndDirectoriesSegmentOptions& options,
+      const Core::Context& context)
+  {
+    auto request = Core::Http::Request(Core::Http::HttpMethod::Get, url);
+    request.GetUrl().AppendQueryParameter("restype", "directory");
+    request.GetUrl().AppendQueryParameter("comp", "list");
+    if (options.Prefix.HasValue() && !options.Prefix.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "prefix", _internal::UrlEncodeQueryParameter(options.Prefix.Value()));
+    }
+    if (options.Sharesnapshot.HasValue() && !options.Sharesnapshot.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "sharesnapshot", _internal::UrlEncodeQueryParameter(options.Sharesnapshot.Value()));
+    }
+    if (options.Marker.HasValue() && !options.Marker.Value().empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "marker", _internal::UrlEncodeQueryParameter(options.Marker.Value()));
+    }
+    if (options.MaxResults.HasValue())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "maxresults", std::to_string(options.MaxResults.Value()));
+    }
+    request.SetHeader("x-ms-version", "2026-02-06");
+    if (options.Include.HasValue()
+        && !ListFilesIncludeFlagsToString(options.Include.Value()).empty())
+    {
+      request.GetUrl().AppendQueryParameter(
+          "include",
+          _internal::UrlEncodeQueryParameter(
+              ListFilesIncludeFlagsToString(options.Include.Value())));
+    }
+    if (options.IncludeExtendedInfo.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-file-extended-info", options.IncludeExtendedInfo.Value() ? "true" : "false");
+    }
+    if (options.AllowTrailingDot.HasValue())
+    {
+      request.SetHeader(
+          "x-ms-allow-trailing-dot", options.AllowTrailingDot.Value() ? "true" : "false");
+    }
+    if (options.FileRequestIntent.HasValue()
+        && !options.FileRequestIntent.Value().ToString().empty())
+    {
+      request.SetHeader("x-ms-file-request-intent", options.FileRequestIntent.Value().ToString());
+    }
+    auto pRawResponse = pipeline.Send(request, context);
+    auto httpStatusCode = pRawResponse->GetStatusCode();
+    if (httpStatusCode != Core::Http::HttpStatusCode::Ok)
+    {
+      throw StorageException::CreateFromResponse(std::move(pRawResponse));
+    }
+    Models::_detail::ListFilesAndDirectoriesSegmentResponse response;
+    {
+      // The reader decodes the document in its own buffer, so that the body of the raw response
+      // is left intact.
+      Core::IO::MemoryBodyStream responseBody(pRawResponse->GetBody());
+      _internal::XmlPullReader reader(responseBody);
+      enum class XmlTagEnum
+      {
+        kUnknown,
+        kEnumerationResults,
+        kPrefix,
+        kMarker,
+        kMaxResults,
+        kEntries,
+        kDirectory,
+        kName,
+        kProperties,
+        kLastAccessTime,
+        kLastModified,
+        kEtag,
+        kPermissionKey,
+        kAttributes,
+        kCreationTime,
+        kLastWriteTime,
+        kChangeTime,
+        kFileId,
+        kFile,
+        kContentLength,
+        kNextMarker,
+        kDirectoryId,
+      };
+      static const _internal::XmlTagMap<XmlTagEnum> XmlTagEnumMap{
+          {"EnumerationResults", XmlTagEnum::kEnumerationResults},
+          {"Prefix", XmlTagEnum::kPrefix},
+          {"Marker", XmlTagEnum::kMarker},
+          {"MaxResults", XmlTagEnum::kMaxResults},
+          {"Entries", XmlTagEnum::kEntries},
+          {"Directory", XmlTagEnum::kDirectory},
+          {"Name", XmlTagEnum::kName},
+          {"Properties", XmlTagEnum::kProperties},
+          {"LastAccessTime", XmlTagEnum::kLastAccessTime},
+          {"Last-Modified", XmlTagEnum::kLastModified},
+          {"Etag", XmlTagEnum::kEtag},
+          {"PermissionKey", XmlTagEnum::kPermissionKey},
+          {"Attributes", XmlTagEnum::kAttributes},
+          {"CreationTime", XmlTagEnum::kCreationTime},
+          {"LastWriteTime", XmlTagEnum::kLastWriteTime},
+          {"ChangeTime", XmlTagEnum::kChangeTime},
+          {"FileId", XmlTagEnum::kFileId},
+          {"File", XmlTagEnum::kFile},
+          {"Content-Length", XmlTagEnum::kContentLength},
+          {"NextMarker", XmlTagEnum::kNextMarker},
+          {"DirectoryId", XmlTagEnum::kDirectoryId},
+      };
+      std::vector<XmlTagEnum> xmlPath;
+      Models::_detail::DirectoryItem vectorElement1;
+      Models::_detail::FileItem vectorElement2;
+      while (true)
+      {
+        auto node = reader.Read(context);
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          break;
+        }
+        else if (node.Type == _internal::XmlNodeType::StartTag)
+        {
+          xmlPath.push_back(XmlTagEnumMap.Find(node.Name));
+        }
+        else if (node.Type == _internal::XmlNodeType::Text)
+        {
+          if (xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kPrefix)
+          {
+            response.Prefix.Content = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kMarker)
+          {
+            response.Marker = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kMaxResults)
+          {
+            response.MaxResults = std::stoi(node.Value);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kName)
+          {
+            vectorElement1.Name.Content = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLastAccessTime)
+          {
+            vectorElement1.Details.LastAccessedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLastModified)
+          {
+            vectorElement1.Details.LastModified
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kEtag)
+          {
+            vectorElement1.Details.Etag = ETag(node.Value);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kPermissionKey)
+          {
+            vectorElement1.Details.SmbProperties.PermissionKey = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kAttributes)
+          {
+            vectorElement1.Details.SmbProperties.Attributes = Models::FileAttributes(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCreationTime)
+          {
+            vectorElement1.Details.SmbProperties.CreatedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLastWriteTime)
+          {
+            vectorElement1.Details.SmbProperties.LastWrittenOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kChangeTime)
+          {
+            vectorElement1.Details.SmbProperties.ChangedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kFileId)
+          {
+            vectorElement1.Details.SmbProperties.FileId = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kName)
+          {
+            vectorElement2.Name.Content = node.Value;
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kContentLength)
+          {
+            vectorElement2.Details.FileSize = std::stoll(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLastAccessTime)
+          {
+            vectorElement2.Details.LastAccessedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kLastModified)
+          {
+            vectorElement2.Details.LastModified
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc1123);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kEtag)
+          {
+            vectorElement2.Details.Etag = ETag(node.Value);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kPermissionKey)
+          {
+            vectorElement2.Details.SmbProperties.PermissionKey = node.Value;
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kAttributes)
+          {
+            vectorElement2.Details.SmbProperties.Attributes = Models::FileAttributes(node.Value);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kCreationTime)
+          {
+            vectorElement2.Details.SmbProperties.CreatedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties
+              && xmlPath[4] == XmlTagEnum::kLastWriteTime)
+          {
+            vectorElement2.Details.SmbProperties.LastWrittenOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 5 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kProperties && xmlPath[4] == XmlTagEnum::kChangeTime)
+          {
+            vectorElement2.Details.SmbProperties.ChangedOn
+                = DateTime::Parse(node.Value, Azure::DateTime::DateFormat::Rfc3339);
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kFileId)
+          {
+            vectorElement2.Details.SmbProperties.FileId = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kNextMarker)
+          {
+            response.NextMarker = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kDirectoryId)
+          {
+            response.DirectoryId = node.Value;
+          }
+        }
+        else if (node.Type == _internal::XmlNodeType::Attribute)
+        {
+          if (xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "ServiceEndpoint")
+          {
+            response.ServiceEndpoint = node.Value;
+          }
+          else if (
+              xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "ShareName")
+          {
+            response.ShareName = node.Value;
+          }
+          else if (
+              xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "ShareSnapshot")
+          {
+            response.ShareSnapshot = node.Value;
+          }
+          else if (
+              xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "Encoded")
+          {
+            response.Encoded = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 1 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && node.Name == "DirectoryPath")
+          {
+            response.DirectoryPath = node.Value;
+          }
+          else if (
+              xmlPath.size() == 2 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kPrefix && node.Name == "Encoded")
+          {
+            response.Prefix.Encoded = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory
+              && xmlPath[3] == XmlTagEnum::kName && node.Name == "Encoded")
+          {
+            vectorElement1.Name.Encoded = node.Value == std::string("true");
+          }
+          else if (
+              xmlPath.size() == 4 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile
+              && xmlPath[3] == XmlTagEnum::kName && node.Name == "Encoded")
+          {
+            vectorElement2.Name.Encoded = node.Value == std::string("true");
+          }
+        }
+        else if (node.Type == _internal::XmlNodeType::EndTag)
+        {
+          if (xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kDirectory)
+          {
+            response.Segment.DirectoryItems.push_back(std::move(vectorElement1));
+            vectorElement1 = Models::_detail::DirectoryItem();
+          }
+          else if (
+              xmlPath.size() == 3 && xmlPath[0] == XmlTagEnum::kEnumerationResults
+              && xmlPath[1] == XmlTagEnum::kEntries && xmlPath[2] == XmlTagEnum::kFile)
+          {
+            response.Segment.FileItems.push_back(std::move(vectorElement2));
+            vectorElement2 = Models::_detail::FileItem();
+          }
+          xmlPath.pop_back();
+        }
+      }
+    }
+    return Response<Models::_detail::ListFilesAndDirectoriesSegmentResponse>(
+        std::move(response), std::move(pRawResponse));
+  }
+
+}}}}} // namespace Azure::Storage::Files::Shares::_detail
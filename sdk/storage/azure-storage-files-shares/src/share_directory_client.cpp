@@ -4,6 +4,7 @@
 #include "azure/storage/files/shares/share_directory_client.hpp"
 
 #include "azure/storage/files/shares/share_file_client.hpp"
+#include "private/list_files_and_directories.hpp"
 #include "private/package_version.hpp"
 
 #include <azure/core/credentials/credentials.hpp>
@@ -521,7 +522,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     protocolLayerOptions.IncludeExtendedInfo = options.IncludeExtendedInfo;
     protocolLayerOptions.AllowTrailingDot = m_allowTrailingDot;
     protocolLayerOptions.FileRequestIntent = m_shareTokenIntent;
-    auto response = _detail::DirectoryClient::ListFilesAndDirectoriesSegment(
+    auto response = _detail::ListFilesAndDirectoriesSegment(
         *m_pipeline, m_shareDirectoryUrl, protocolLayerOptions, context);
 
     ListFilesAndDirectoriesPagedResponse pagedResponse;
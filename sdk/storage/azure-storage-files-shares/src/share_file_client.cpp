@@ -21,8 +21,23 @@
 #include <azure/storage/common/storage_common.hpp>
 #include <azure/storage/common/storage_exception.hpp>
 
+#include <stdexcept>
+
 namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
+  namespace {
+    // The service only accepts MD5 as the transactional hash of a range.
+    void ValidateTransactionalHashAlgorithm(const UploadFileFromOptions& options)
+    {
+      if (options.TransferOptions.TransactionalHashAlgorithm.HasValue()
+          && options.TransferOptions.TransactionalHashAlgorithm.Value() != HashAlgorithm::Md5)
+      {
+        throw std::invalid_argument(
+            "Only MD5 is supported as the transactional hash algorithm of file ranges.");
+      }
+    }
+  } // namespace
+
   ShareFileClient ShareFileClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& shareName,
@@ -1033,7 +1048,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        options.TransferOptions.Executor);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1082,29 +1098,90 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
     firstChunkLength = (std::min)(firstChunkLength, fileRangeSize);
 
-    auto bodyStreamToFile = [](Azure::Core::IO::BodyStream& stream,
-                               _internal::FileWriter& fileWriter,
-                               int64_t offset,
-                               int64_t length,
-                               const Azure::Core::Context& context) {
+    const auto bufferPool = options.TransferOptions.BufferPool
+        ? options.TransferOptions.BufferPool
+        : TransferBufferPool::GetDefault();
+    auto bodyStreamToFile = [&bufferPool](
+                                Azure::Core::IO::BodyStream& stream,
+                                _internal::FileWriter& fileWriter,
+                                int64_t offset,
+                                int64_t length,
+                                const Azure::Core::Context& context) {
       constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
+      // Data borrowed from the stream is written to the file directly when there is at least this
+      // much of it, instead of being copied to the buffer first. Socket-backed streams hand out
+      // their receive buffer, 4 KB by default, so after the first smaller view the rest is read
+      // straight into the buffer, without views.
+      constexpr size_t minDirectWriteSize = 64 * 1024;
+      bool readViews = true;
+      TransferBufferPool::Buffer buffer;
       while (length > 0)
       {
         size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
+        Azure::Core::IO::BodyStreamView view;
+        if (readViews)
+        {
+          view = stream.ReadView(readSize, context);
+          if (view.Size == 0)
+          {
+            throw Azure::Core::RequestFailedException("Error when reading body stream.");
+          }
+          if (view.Size == readSize || view.Size >= minDirectWriteSize)
+          {
+            fileWriter.Write(view.Data, view.Size, offset);
+            length -= view.Size;
+            offset += view.Size;
+            continue;
+          }
+          readViews = false;
+        }
+
+        // The file is written in large blocks from the buffer, which is filled straight from the
+        // stream.
+        if (!buffer.GetData())
+        {
+          buffer = bufferPool->Acquire(bufferSize, context);
+        }
+        std::copy(view.Data, view.Data + view.Size, buffer.GetData());
+        size_t bytesRead = view.Size
+            + stream.ReadToCount(buffer.GetData() + view.Size, readSize - view.Size, context);
         if (bytesRead != readSize)
         {
           throw Azure::Core::RequestFailedException("Error when reading body stream.");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        fileWriter.Write(buffer.GetData(), bytesRead, offset);
         length -= bytesRead;
         offset += bytesRead;
       }
     };
 
-    _internal::FileWriter fileWriter(fileName);
-    bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
+    std::unique_ptr<_internal::FileWriter> fileWriter;
+    std::unique_ptr<_internal::MappedFileWriter> mappedFileWriter;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      mappedFileWriter = std::make_unique<_internal::MappedFileWriter>(fileName, fileRangeSize);
+    }
+    else
+    {
+      fileWriter = std::make_unique<_internal::FileWriter>(fileName);
+    }
+    auto writeChunk = [&](Azure::Core::IO::BodyStream& stream, int64_t offset, int64_t length) {
+      if (mappedFileWriter)
+      {
+        // Read straight into the pages of the file.
+        const size_t readSize = static_cast<size_t>(length);
+        if (stream.ReadToCount(mappedFileWriter->GetData() + offset, readSize, context)
+            != readSize)
+        {
+          throw Azure::Core::RequestFailedException("Error when reading body stream.");
+        }
+      }
+      else
+      {
+        bodyStreamToFile(stream, *fileWriter, offset, length, context);
+      }
+    };
+    writeChunk(*(firstChunk.Value.BodyStream), 0, firstChunkLength);
     firstChunk.Value.BodyStream.reset();
 
     auto returnTypeConverter = [](Azure::Response<Models::DownloadFileResult>& response) {
@@ -1130,12 +1207,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
               throw Azure::Core::RequestFailedException(
                   "File was modified in the middle of download.");
             }
-            bodyStreamToFile(
+            writeChunk(
                 *(chunk.Value.BodyStream),
-                fileWriter,
                 offset - firstChunkOffset,
-                chunkOptions.Range.Value().Length.Value(),
-                context);
+                chunkOptions.Range.Value().Length.Value());
 
             if (chunkId == numChunks - 1)
             {
@@ -1151,7 +1226,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        options.TransferOptions.Executor);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1163,6 +1239,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const UploadFileFromOptions& options,
       const Azure::Core::Context& context) const
   {
+    ValidateTransactionalHashAlgorithm(options);
+
     _detail::FileClient::CreateFileOptions protocolLayerOptions;
     protocolLayerOptions.FileContentLength = bufferSize;
     protocolLayerOptions.FileAttributes = options.SmbProperties.Attributes.ToString();
@@ -1248,6 +1326,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         uploadRangeOptions.FileLastWrittenMode
             = Azure::Storage::Files::Shares::Models::FileLastWrittenMode::Preserve;
       }
+      if (options.TransferOptions.TransactionalHashAlgorithm.HasValue())
+      {
+        uploadRangeOptions.TransactionalContentHash = _internal::ComputeContentHash(
+            buffer + offset,
+            static_cast<size_t>(length),
+            options.TransferOptions.TransactionalHashAlgorithm.Value());
+      }
       UploadRange(offset, contentStream, uploadRangeOptions, context);
     };
 
@@ -1260,7 +1345,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (bufferSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          options.TransferOptions.Executor);
     }
 
     Models::UploadFileFromResult result;
@@ -1274,10 +1364,23 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       const UploadFileFromOptions& options,
       const Azure::Core::Context& context) const
   {
-    _internal::FileReader fileReader(fileName);
+    ValidateTransactionalHashAlgorithm(options);
+
+    std::unique_ptr<_internal::FileReader> fileReader;
+    std::unique_ptr<_internal::MappedFileReader> mappedFileReader;
+    if (options.TransferOptions.UseMemoryMappedFile)
+    {
+      mappedFileReader = std::make_unique<_internal::MappedFileReader>(fileName);
+    }
+    else
+    {
+      fileReader = std::make_unique<_internal::FileReader>(fileName);
+    }
+    const int64_t fileSize
+        = mappedFileReader ? mappedFileReader->GetFileSize() : fileReader->GetFileSize();
 
     _detail::FileClient::CreateFileOptions protocolLayerOptions;
-    protocolLayerOptions.FileContentLength = fileReader.GetFileSize();
+    protocolLayerOptions.FileContentLength = fileSize;
     protocolLayerOptions.FileAttributes = options.SmbProperties.Attributes.ToString();
 
     if (options.SmbProperties.CreatedOn.HasValue())
@@ -1349,21 +1452,61 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto createResult
         = _detail::FileClient::Create(*m_pipeline, m_shareFileUrl, protocolLayerOptions, context);
 
+    const auto& hashAlgorithm = options.TransferOptions.TransactionalHashAlgorithm;
+    // The chunks of a file which is not mapped are read into buffers to be hashed.
+    std::shared_ptr<TransferBufferPool> bufferPool;
+    if (hashAlgorithm.HasValue() && !mappedFileReader)
+    {
+      bufferPool = options.TransferOptions.BufferPool ? options.TransferOptions.BufferPool
+                                                      : TransferBufferPool::GetDefault();
+    }
+
     auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       (void)chunkId;
       (void)numChunks;
-      Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
-          fileReader.GetHandle(), offset, length);
+      std::unique_ptr<Azure::Core::IO::BodyStream> contentStream;
+      TransferBufferPool::Buffer buffer;
+      const uint8_t* data = nullptr;
+      if (mappedFileReader)
+      {
+        data = mappedFileReader->GetData() + offset;
+      }
+      else if (bufferPool)
+      {
+        buffer = bufferPool->Acquire(static_cast<size_t>(length), context);
+        Azure::Core::IO::_internal::RandomAccessFileBodyStream fileStream(
+            fileReader->GetHandle(), offset, length);
+        if (fileStream.ReadToCount(buffer.GetData(), static_cast<size_t>(length), context)
+            != static_cast<size_t>(length))
+        {
+          throw std::runtime_error("Failed to read file.");
+        }
+        data = buffer.GetData();
+      }
+      if (data)
+      {
+        contentStream = std::make_unique<Azure::Core::IO::MemoryBodyStream>(
+            data, static_cast<size_t>(length));
+      }
+      else
+      {
+        contentStream = std::make_unique<Azure::Core::IO::_internal::RandomAccessFileBodyStream>(
+            fileReader->GetHandle(), offset, length);
+      }
       UploadFileRangeOptions uploadRangeOptions;
       if (options.SmbProperties.LastWrittenOn.HasValue())
       {
         uploadRangeOptions.FileLastWrittenMode
             = Azure::Storage::Files::Shares::Models::FileLastWrittenMode::Preserve;
       }
-      UploadRange(offset, contentStream, uploadRangeOptions, context);
+      if (hashAlgorithm.HasValue())
+      {
+        uploadRangeOptions.TransactionalContentHash = _internal::ComputeContentHash(
+            data, static_cast<size_t>(length), hashAlgorithm.Value());
+      }
+      UploadRange(offset, *contentStream, uploadRangeOptions, context);
     };
 
-    const int64_t fileSize = fileReader.GetFileSize();
     int64_t chunkSize = options.TransferOptions.ChunkSize;
     if (fileSize < options.TransferOptions.SingleUploadThreshold)
     {
@@ -1373,7 +1516,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (fileSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          fileSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          options.TransferOptions.Executor);
     }
 
     Models::UploadFileFromResult result;
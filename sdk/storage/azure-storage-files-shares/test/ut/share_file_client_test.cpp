@@ -469,6 +469,41 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(FileShareFileClientTest, UploadFromWithTransactionalHash_LIVEONLY_)
+  {
+    auto fileClient = m_shareClient->GetRootDirectoryClient().GetFileClient(RandomString());
+    const auto fileContent = RandomBuffer(static_cast<size_t>(3_MB + 123));
+    const std::string tempFileName = RandomString();
+    WriteFile(tempFileName, fileContent);
+    for (bool useMemoryMappedFile : {false, true})
+    {
+      for (int64_t singleUploadThreshold : {int64_t(0), int64_t(64_MB)})
+      {
+        Files::Shares::UploadFileFromOptions options;
+        options.TransferOptions.ChunkSize = 1_MB;
+        options.TransferOptions.SingleUploadThreshold = singleUploadThreshold;
+        options.TransferOptions.UseMemoryMappedFile = useMemoryMappedFile;
+        options.TransferOptions.TransactionalHashAlgorithm = HashAlgorithm::Md5;
+        fileClient.UploadFrom(tempFileName, options);
+        std::vector<uint8_t> downloadBuffer(fileContent.size());
+        fileClient.DownloadTo(downloadBuffer.data(), downloadBuffer.size());
+        EXPECT_EQ(downloadBuffer, fileContent);
+        fileClient.UploadFrom(fileContent.data(), fileContent.size(), options);
+        downloadBuffer.assign(fileContent.size(), 0);
+        fileClient.DownloadTo(downloadBuffer.data(), downloadBuffer.size());
+        EXPECT_EQ(downloadBuffer, fileContent);
+
+        // The ranges of a file can only be hashed with MD5.
+        options.TransferOptions.TransactionalHashAlgorithm = HashAlgorithm::Crc64;
+        EXPECT_THROW(fileClient.UploadFrom(tempFileName, options), std::invalid_argument);
+        EXPECT_THROW(
+            fileClient.UploadFrom(fileContent.data(), fileContent.size(), options),
+            std::invalid_argument);
+      }
+    }
+    DeleteFile(tempFileName);
+  }
+
   TEST_F(FileShareFileClientTest, ConcurrentDownload_LIVEONLY_)
   {
     auto fileContent = RandomBuffer(8 * 1024 * 1024);
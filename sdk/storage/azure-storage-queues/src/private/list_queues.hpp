@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/storage/queues/rest_client.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/core/response.hpp>
+#include <azure/core/url.hpp>
+
+namespace Azure { namespace Storage { namespace Queues { namespace _detail {
+
+  /**
+   * @brief Sends the same request as ServiceClient::ListQueuesSegment, and deserializes the
+   * response with the pull parser instead of the generated XmlReader code.
+   */
+  Response<Models::_detail::ListQueuesResult> ListQueuesSegment(
+      Core::Http::_internal::HttpPipeline& pipeline,
+      const Core::Url& url,
+      const ServiceClient::ListServiceQueuesSegmentOptions& options,
+      const Core::Context& context);
+
+}}}} // namespace Azure::Storage::Queues::_detail
@@ -3,6 +3,7 @@
 
 #include "azure/storage/queues/queue_service_client.hpp"
 
+#include "private/list_queues.hpp"
 #include "private/package_version.hpp"
 
 #include <azure/core/http/policies/policy.hpp>
@@ -126,7 +127,7 @@ namespace Azure { namespace Storage { namespace Queues {
     protocolLayerOptions.Marker = options.ContinuationToken;
     protocolLayerOptions.MaxResults = options.PageSizeHint;
     protocolLayerOptions.Include = options.Include;
-    auto response = _detail::ServiceClient::ListQueuesSegment(
+    auto response = _detail::ListQueuesSegment(
         *m_pipeline, m_serviceUrl, protocolLayerOptions, _internal::WithReplicaStatus(context));
 
     ListQueuesPagedResponse pagedResponse;
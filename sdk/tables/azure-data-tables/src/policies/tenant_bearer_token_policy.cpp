@@ -7,10 +7,8 @@
 
 namespace Azure { namespace Data { namespace Tables { namespace _detail { namespace Policies {
 
-  std::unique_ptr<Azure::Core::Http::RawResponse>
-  TenantBearerTokenAuthenticationPolicy::AuthorizeAndSendRequest(
+  void TenantBearerTokenAuthenticationPolicy::AuthorizeRequest(
       Azure::Core::Http::Request& request,
-      Azure::Core::Http::Policies::NextHttpPolicy& nextPolicy,
       Azure::Core::Context const& context) const
   {
     std::string tenantId = m_safeTenantId.Get();
@@ -21,7 +19,6 @@ namespace Azure { namespace Data { namespace Tables { namespace _detail { namesp
       tokenRequestContext.TenantId = tenantId;
       AuthenticateAndAuthorizeRequest(request, tokenRequestContext, context);
     }
-    return nextPolicy.Send(request, context);
   }
 
   bool TenantBearerTokenAuthenticationPolicy::AuthorizeRequestOnChallenge(